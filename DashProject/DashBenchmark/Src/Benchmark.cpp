@@ -0,0 +1,163 @@
+#include "PCH.h"
+#include "Benchmark.h"
+
+#include "Utility/CpuFeatures.h"
+
+#include <cstdio>
+#include <ctime>
+
+namespace Dash
+{
+	static std::string EscapeJson(const std::string& value)
+	{
+		std::string result;
+		result.reserve(value.size());
+
+		for (char c : value)
+		{
+			if (c == '"' || c == '\\')
+			{
+				result += '\\';
+			}
+			result += c;
+		}
+
+		return result;
+	}
+
+	static const char* GetCompilerName()
+	{
+#if defined(__clang__)
+		return "clang " __clang_version__;
+#elif defined(__GNUC__)
+		return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+		return "msvc";
+#else
+		return "unknown";
+#endif
+	}
+
+	// Which Math code paths the benchmark was compiled with, results are only comparable within a variant.
+	static std::string GetBuildVariant()
+	{
+#if defined(USE_SSE)
+		std::string variant = "sse";
+#else
+		std::string variant = "scalar";
+#endif
+#if defined(FAST_APPROX)
+		variant += "+fast_approx";
+#endif
+		return variant;
+	}
+
+	bool FBenchmarkRunner::WriteJson(const std::string& path) const
+	{
+		std::ofstream file(path, std::ios::out | std::ios::trunc);
+		if (!file.is_open())
+		{
+			return false;
+		}
+
+		const FCpuFeatures& cpu = FCpuFeatures::Get();
+
+		char date[32] = {};
+		const std::time_t now = std::time(nullptr);
+		std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+		file << "{\n";
+		file << "  \"context\": {\n";
+		file << "    \"date\": \"" << date << "\",\n";
+		file << "    \"variant\": \"" << GetBuildVariant() << "\",\n";
+		file << "    \"compiler\": \"" << EscapeJson(GetCompilerName()) << "\",\n";
+		file << "    \"cpu\": \"" << EscapeJson(cpu.GetBrand()) << "\",\n";
+		file << "    \"isa\": \"" << FCpuFeatures::GetIsaName(cpu.GetIsa()) << "\",\n";
+		file << "    \"samples\": " << mOptions.SampleCount << ",\n";
+		file << "    \"min_sample_seconds\": " << mOptions.MinSampleSeconds << "\n";
+		file << "  },\n";
+		file << "  \"benchmarks\": [";
+
+		char number[64];
+		for (std::size_t i = 0; i < mResults.size(); ++i)
+		{
+			const FBenchmarkResult& result = mResults[i];
+
+			file << (i == 0 ? "\n" : ",\n");
+			file << "    { \"name\": \"" << EscapeJson(result.Name) << "\"";
+			file << ", \"size\": " << result.Size;
+			file << ", \"iterations\": " << result.Iterations;
+			std::snprintf(number, sizeof(number), "%.4f", result.NsPerItem);
+			file << ", \"ns_per_item\": " << number;
+			std::snprintf(number, sizeof(number), "%.4f", result.MinNsPerItem);
+			file << ", \"min_ns_per_item\": " << number;
+			std::snprintf(number, sizeof(number), "%.6g", result.ItemsPerSecond);
+			file << ", \"items_per_second\": " << number << " }";
+		}
+
+		file << "\n  ]\n}\n";
+
+		return file.good();
+	}
+
+	bool FBenchmarkRunner::IsFiltered(const std::string& name) const
+	{
+		return !mOptions.Filter.empty() && name.find(mOptions.Filter) == std::string::npos;
+	}
+
+	void FBenchmarkRunner::AddResult(const std::string& name, std::size_t size, std::size_t itemCount, uint64 iterations, std::vector<double>& sampleSeconds)
+	{
+		std::sort(sampleSeconds.begin(), sampleSeconds.end());
+
+		const double items = double(iterations) * double(std::max<std::size_t>(itemCount, 1));
+		const double median = sampleSeconds[sampleSeconds.size() / 2];
+
+		FBenchmarkResult result;
+		result.Name = name;
+		result.Size = size;
+		result.Iterations = iterations;
+		result.NsPerItem = median * 1e9 / items;
+		result.MinNsPerItem = sampleSeconds.front() * 1e9 / items;
+		result.ItemsPerSecond = median > 0.0 ? items / median : 0.0;
+
+		mResults.push_back(result);
+		std::printf("%-48s %10zu %14.3f ns/item\n", name.c_str(), size, result.NsPerItem);
+	}
+
+	FBenchmarkRegistry& FBenchmarkRegistry::Get()
+	{
+		static FBenchmarkRegistry Registry;
+		return Registry;
+	}
+
+	void FBenchmarkRegistry::Add(const char* name, FBenchmarkGroupFunction function)
+	{
+		mGroups[name] = function;
+	}
+
+	void FBenchmarkRegistry::RunAll(FBenchmarkRunner& runner) const
+	{
+		for (const auto& [name, function] : mGroups)
+		{
+			function(runner);
+		}
+	}
+
+	void FBenchmarkRegistry::AddCheck(const char* name, FBenchmarkCheckFunction function)
+	{
+		mChecks[name] = function;
+	}
+
+	bool FBenchmarkRegistry::RunChecks() const
+	{
+		bool passed = true;
+		for (const auto& [name, function] : mChecks)
+		{
+			const bool checkPassed = function();
+			std::printf("%-48s %s\n", name.c_str(), checkPassed ? "passed" : "FAILED");
+			passed = passed && checkPassed;
+		}
+
+		return passed;
+	}
+}
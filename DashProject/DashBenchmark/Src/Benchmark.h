@@ -0,0 +1,167 @@
+#pragma once
+
+namespace Dash
+{
+	// Keeps the compiler from discarding a value that is computed only to be measured.
+	template<typename T>
+	FORCEINLINE void DoNotOptimize(const T& value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		const volatile char* sink = reinterpret_cast<const volatile char*>(&value);
+		(void)*sink;
+		_ReadWriteBarrier();
+#endif
+	}
+
+	struct FBenchmarkOptions
+	{
+		// Only benchmarks whose name contains Filter are run.
+		std::string Filter;
+
+		// Each sample repeats the body until it runs at least this long, the reported time is the median sample.
+		double MinSampleSeconds = 0.01;
+		uint32 SampleCount = 7;
+	};
+
+	struct FBenchmarkResult
+	{
+		std::string Name;
+		std::size_t Size = 0;
+		uint64 Iterations = 0;
+		double NsPerItem = 0.0;
+		double MinNsPerItem = 0.0;
+		double ItemsPerSecond = 0.0;
+	};
+
+	class FBenchmarkRunner
+	{
+	public:
+		explicit FBenchmarkRunner(const FBenchmarkOptions& options) : mOptions(options) {}
+
+		// Times body, which processes itemCount items per call. size is the input size reported with the result,
+		// for most benchmarks it equals itemCount.
+		template<typename Body>
+		void Run(const std::string& name, std::size_t size, std::size_t itemCount, Body&& body);
+
+		template<typename Body>
+		void Run(const std::string& name, std::size_t size, Body&& body) { Run(name, size, size, std::forward<Body>(body)); }
+
+		const std::vector<FBenchmarkResult>& GetResults() const { return mResults; }
+
+		bool WriteJson(const std::string& path) const;
+
+	private:
+		bool IsFiltered(const std::string& name) const;
+		void AddResult(const std::string& name, std::size_t size, std::size_t itemCount, uint64 iterations, std::vector<double>& sampleSeconds);
+
+		FBenchmarkOptions mOptions;
+		std::vector<FBenchmarkResult> mResults;
+	};
+
+	// Benchmark groups register themselves at static initialization and are run in name order.
+	using FBenchmarkGroupFunction = void(*)(FBenchmarkRunner& runner);
+
+	// Checks compare an optimized code path against its reference, they run instead of the benchmarks with --check.
+	// A check prints what it measured and returns false if the results are outside its tolerance.
+	using FBenchmarkCheckFunction = bool(*)();
+
+	class FBenchmarkRegistry
+	{
+	public:
+		static FBenchmarkRegistry& Get();
+
+		void Add(const char* name, FBenchmarkGroupFunction function);
+		void RunAll(FBenchmarkRunner& runner) const;
+
+		void AddCheck(const char* name, FBenchmarkCheckFunction function);
+
+		/**
+		 * @returns true if every check passed.
+		 */
+		bool RunChecks() const;
+
+	private:
+		std::map<std::string, FBenchmarkGroupFunction> mGroups;
+		std::map<std::string, FBenchmarkCheckFunction> mChecks;
+	};
+
+	struct FBenchmarkGroupRegistrar
+	{
+		FBenchmarkGroupRegistrar(const char* name, FBenchmarkGroupFunction function)
+		{
+			FBenchmarkRegistry::Get().Add(name, function);
+		}
+	};
+
+	struct FBenchmarkCheckRegistrar
+	{
+		FBenchmarkCheckRegistrar(const char* name, FBenchmarkCheckFunction function)
+		{
+			FBenchmarkRegistry::Get().AddCheck(name, function);
+		}
+	};
+
+#define DASH_BENCHMARK_GROUP(Name) \
+	static void Benchmark##Name(FBenchmarkRunner& runner); \
+	static FBenchmarkGroupRegistrar BenchmarkRegistrar##Name(#Name, &Benchmark##Name); \
+	static void Benchmark##Name(FBenchmarkRunner& runner)
+
+#define DASH_BENCHMARK_CHECK(Name) \
+	static bool Check##Name(); \
+	static FBenchmarkCheckRegistrar CheckRegistrar##Name(#Name, &Check##Name); \
+	static bool Check##Name()
+
+
+
+
+
+
+	// Member Function
+
+	// --Implementation-- //
+
+	template<typename Body>
+	void FBenchmarkRunner::Run(const std::string& name, std::size_t size, std::size_t itemCount, Body&& body)
+	{
+		if (IsFiltered(name))
+		{
+			return;
+		}
+
+		using FClock = std::chrono::steady_clock;
+
+		// Warm up the caches and find an iteration count that fills a sample.
+		uint64 iterations = 1;
+		for (;;)
+		{
+			const FClock::time_point start = FClock::now();
+			for (uint64 i = 0; i < iterations; ++i)
+			{
+				body();
+			}
+			const double seconds = std::chrono::duration<double>(FClock::now() - start).count();
+
+			if (seconds >= mOptions.MinSampleSeconds || iterations >= (uint64(1) << 40))
+			{
+				break;
+			}
+
+			iterations = seconds > 0.0 ? std::max(iterations * 2, uint64(iterations * mOptions.MinSampleSeconds * 1.2 / seconds)) : iterations * 16;
+		}
+
+		std::vector<double> sampleSeconds(std::max(mOptions.SampleCount, 1u));
+		for (double& sample : sampleSeconds)
+		{
+			const FClock::time_point start = FClock::now();
+			for (uint64 i = 0; i < iterations; ++i)
+			{
+				body();
+			}
+			sample = std::chrono::duration<double>(FClock::now() - start).count();
+		}
+
+		AddResult(name, size, itemCount, iterations, sampleSeconds);
+	}
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <random>
+
+namespace Dash
+{
+	// Input sizes shared by the benchmarks: fits in L1, fits in L2, streams from L3 / memory.
+	inline constexpr std::size_t BenchmarkSizes[] = { 64, 1024, 16384 };
+
+	// Deterministic random inputs, every run and every build variant measures the same data.
+	class FBenchmarkRandom
+	{
+	public:
+		explicit FBenchmarkRandom(uint32 seed = 0x1234567u) : mEngine(seed) {}
+
+		float Float(float lower = -1.0f, float upper = 1.0f)
+		{
+			return std::uniform_real_distribution<float>(lower, upper)(mEngine);
+		}
+
+		uint32 UInt(uint32 upper)
+		{
+			return std::uniform_int_distribution<uint32>(0, upper - 1)(mEngine);
+		}
+
+		FVector3f Vector3(float lower = -1.0f, float upper = 1.0f)
+		{
+			return FVector3f{ Float(lower, upper), Float(lower, upper), Float(lower, upper) };
+		}
+
+		FVector4f Vector4(float lower = -1.0f, float upper = 1.0f)
+		{
+			return FVector4f{ Float(lower, upper), Float(lower, upper), Float(lower, upper), Float(lower, upper) };
+		}
+
+		FQuaternion UnitQuaternion()
+		{
+			float x = Float(), y = Float(), z = Float(), w = Float();
+			const float invLength = 1.0f / std::sqrt(x * x + y * y + z * z + w * w + 1e-12f);
+			return FQuaternion{ x * invLength, y * invLength, z * invLength, w * invLength };
+		}
+
+		FTransform Transform()
+		{
+			return FTransform{ Vector3(0.5f, 2.0f), UnitQuaternion(), Vector3(-10.0f, 10.0f) };
+		}
+
+	private:
+		std::mt19937 mEngine;
+	};
+}
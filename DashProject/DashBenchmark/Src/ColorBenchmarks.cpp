@@ -0,0 +1,83 @@
+#include "PCH.h"
+#include "Benchmark.h"
+#include "BenchmarkData.h"
+
+namespace Dash
+{
+	// Per pixel FColor / FLinearColor conversions against the FMath span versions, items are pixels.
+	DASH_BENCHMARK_GROUP(Color)
+	{
+		for (std::size_t size : BenchmarkSizes)
+		{
+			FBenchmarkRandom random;
+			std::vector<FColor> colors(size), colorsOut(size), rgbe(size);
+			std::vector<FLinearColor> linear(size), linearOut(size);
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				colors[i] = FColor(static_cast<uint8>(random.UInt(256)), static_cast<uint8>(random.UInt(256)), static_cast<uint8>(random.UInt(256)), static_cast<uint8>(random.UInt(256)));
+				linear[i] = FLinearColor(random.Float(0.0f, 1.0f), random.Float(0.0f, 1.0f), random.Float(0.0f, 1.0f), random.Float(0.0f, 1.0f));
+				rgbe[i] = FLinearColor(random.Float(0.0f, 64.0f), random.Float(0.0f, 64.0f), random.Float(0.0f, 64.0f), 1.0f).ToRGBE();
+			}
+
+			runner.Run("Color/SRGBToLinear/Scalar", size, [&]()
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					linearOut[i] = FLinearColor::FromSRGBColor(colors[i]);
+				}
+				DoNotOptimize(linearOut.data());
+			});
+
+			runner.Run("Color/SRGBToLinear/Batch", size, [&]()
+			{
+				FMath::SRGBToLinear(colors, linearOut);
+				DoNotOptimize(linearOut.data());
+			});
+
+			runner.Run("Color/LinearToSRGB8/Scalar", size, [&]()
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					colorsOut[i] = linear[i].ToFColor(true);
+				}
+				DoNotOptimize(colorsOut.data());
+			});
+
+			runner.Run("Color/LinearToSRGB8/Batch", size, [&]()
+			{
+				FMath::LinearToFColor(linear, colorsOut, true);
+				DoNotOptimize(colorsOut.data());
+			});
+
+			runner.Run("Color/RGBEEncode/Scalar", size, [&]()
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					colorsOut[i] = linear[i].ToRGBE();
+				}
+				DoNotOptimize(colorsOut.data());
+			});
+
+			runner.Run("Color/RGBEEncode/Batch", size, [&]()
+			{
+				FMath::LinearToRGBE(linear, colorsOut);
+				DoNotOptimize(colorsOut.data());
+			});
+
+			runner.Run("Color/RGBEDecode/Scalar", size, [&]()
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					linearOut[i] = rgbe[i].FromRGBE();
+				}
+				DoNotOptimize(linearOut.data());
+			});
+
+			runner.Run("Color/RGBEDecode/Batch", size, [&]()
+			{
+				FMath::RGBEToLinear(rgbe, linearOut);
+				DoNotOptimize(linearOut.data());
+			});
+		}
+	}
+}
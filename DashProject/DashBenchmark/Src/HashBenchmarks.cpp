@@ -0,0 +1,72 @@
+#include "PCH.h"
+#include "Benchmark.h"
+#include "BenchmarkData.h"
+
+#include "Utility/Hash.h"
+
+namespace Dash
+{
+	// Items are bytes, so items/s is the hashing bandwidth.
+	DASH_BENCHMARK_GROUP(Hash)
+	{
+		const std::size_t byteSizes[] = { 16, 64, 1024, 65536 };
+
+		for (std::size_t size : byteSizes)
+		{
+			FBenchmarkRandom random;
+			std::vector<uint8> bytes(size);
+			for (uint8& byte : bytes)
+			{
+				byte = static_cast<uint8>(random.UInt(256));
+			}
+
+			runner.Run("Hash/Hash64", size, [&]()
+			{
+				DoNotOptimize(Hash64(bytes.data(), bytes.size()));
+			});
+
+			runner.Run("Hash/Hash128", size, [&]()
+			{
+				DoNotOptimize(Hash128(bytes.data(), bytes.size()));
+			});
+
+			// Fed in 20 byte pieces, roughly the granularity of the PSO and root signature keys.
+			runner.Run("Hash/FHasher", size, [&]()
+			{
+				FHasher hasher;
+				for (std::size_t offset = 0; offset < bytes.size(); offset += 20)
+				{
+					hasher.Update(bytes.data() + offset, std::min<std::size_t>(20, bytes.size() - offset));
+				}
+				DoNotOptimize(hasher.Finalize());
+			});
+
+			// Baseline: the standard library string hash.
+			const std::string_view view(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+			runner.Run("Hash/StdHash", size, [&]()
+			{
+				DoNotOptimize(std::hash<std::string_view>{}(view));
+			});
+		}
+
+		for (std::size_t size : BenchmarkSizes)
+		{
+			FBenchmarkRandom random;
+			std::vector<size_t> values(size);
+			for (size_t& value : values)
+			{
+				value = (size_t(random.UInt(0xFFFFFFFFu)) << 32) | random.UInt(0xFFFFFFFFu);
+			}
+
+			runner.Run("Hash/HashCombine", size, [&]()
+			{
+				size_t hash = FNV_OFFSET_BASIS;
+				for (size_t value : values)
+				{
+					hash = HashCombine(hash, value);
+				}
+				DoNotOptimize(hash);
+			});
+		}
+	}
+}
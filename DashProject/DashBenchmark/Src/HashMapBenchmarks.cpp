@@ -0,0 +1,150 @@
+#include "PCH.h"
+#include "Benchmark.h"
+#include "BenchmarkData.h"
+
+#include "Utility/FlatHashMap.h"
+
+#include <map>
+#include <unordered_map>
+
+namespace Dash
+{
+	namespace
+	{
+		// Shader parameter names and asset paths the engine looks up by string every frame or on load.
+		const char* const EngineKeys[] =
+		{
+			"AnisotropicClampStaticSampler", "AnisotropicWarpStaticSampler", "BaseColorTexture", "BindlessSAMPLER_DepthTextureSampler",
+			"BindlessSRV_SceneTexture", "BindlessUAV_OutputTexture", "Color", "ColorBuffer", "DepthStaticSampler", "DisplayTexture",
+			"InputTexture", "InstanceColor", "InstanceData", "InstanceModelMatrix", "InvOutTexelSize", "LinearClampStaticSampler",
+			"LinearWarpStaticSampler", "MipConstants", "ModelMatrix", "OutMip", "OutputTexture", "PointClampStaticSampler",
+			"PointWarpStaticSampler", "ProjectionMatrix", "ShadowStaticSampler", "SrcMip", "SrcMipIndex", "ViewProjectionMatrix",
+			"FrameConstantBuffer", "ObjectConstantBuffer", "MaterialConstantBuffer",
+			"DashCore/Resource/M4A1_1P_Main.FBX", "DashCore/Resource/T_M4A1_D.TGA", "DashCore/Resource/earth.dds",
+			"DashCore/Resource/Newport_Loft_Ref.hdr", "DashCore/Resource/TestTGA.tga", "DashCore/Resource/helmet_low.fbx",
+			"DashProject/Src/template.png", "DashCore/Resource/DDSTest.dds", "DashCore/Resource/coma.png", "DashCore/Resource/ovra.png",
+			"ErrorTexture", "Black", "Cube",
+			"RenderScene", "GrayscalePostProcess", "BlitPostProcess",
+		};
+
+		// The real set, then scaled up with per material and per mesh suffixes for larger scenes.
+		std::vector<std::string> MakeKeys(std::size_t count)
+		{
+			std::vector<std::string> keys;
+			keys.reserve(count);
+			for (std::size_t i = 0; keys.size() < count; ++i)
+			{
+				for (const char* key : EngineKeys)
+				{
+					if (keys.size() == count)
+					{
+						break;
+					}
+					keys.push_back(i == 0 ? std::string(key) : std::string(key) + "_" + std::to_string(i));
+				}
+			}
+			return keys;
+		}
+
+		template<typename MapType>
+		void RunHashMapBenchmarks(FBenchmarkRunner& runner, const char* mapName, const std::vector<std::string>& keys, const std::vector<std::string>& missingKeys)
+		{
+			const std::string prefix = std::string("HashMap/") + mapName;
+
+			runner.Run(prefix + "/Insert", keys.size(), [&]()
+			{
+				MapType map;
+				for (std::size_t i = 0; i < keys.size(); ++i)
+				{
+					map.emplace(keys[i], static_cast<uint32>(i));
+				}
+				DoNotOptimize(map.size());
+			});
+
+			MapType map;
+			for (std::size_t i = 0; i < keys.size(); ++i)
+			{
+				map.emplace(keys[i], static_cast<uint32>(i));
+			}
+
+			runner.Run(prefix + "/FindHit", keys.size(), [&]()
+			{
+				uint32 sum = 0;
+				for (const std::string& key : keys)
+				{
+					sum += map.find(key)->second;
+				}
+				DoNotOptimize(sum);
+			});
+
+			runner.Run(prefix + "/FindMiss", missingKeys.size(), [&]()
+			{
+				std::size_t found = 0;
+				for (const std::string& key : missingKeys)
+				{
+					found += map.find(key) != map.end();
+				}
+				DoNotOptimize(found);
+			});
+		}
+	}
+
+	// Items are lookups or inserts. The string_view lookups only exist for maps with transparent comparison.
+	DASH_BENCHMARK_GROUP(HashMap)
+	{
+		const std::size_t keyCounts[] = { std::size(EngineKeys), 256, 4096 };
+
+		for (std::size_t count : keyCounts)
+		{
+			std::vector<std::string> keys = MakeKeys(count);
+
+			std::vector<std::string> missingKeys;
+			missingKeys.reserve(keys.size());
+			for (const std::string& key : keys)
+			{
+				missingKeys.push_back(key + "Missing");
+			}
+
+			// Looked up in a different order than inserted.
+			FBenchmarkRandom random;
+			for (std::size_t i = keys.size(); i > 1; --i)
+			{
+				std::swap(keys[i - 1], keys[random.UInt(static_cast<uint32>(i))]);
+			}
+
+			RunHashMapBenchmarks<std::map<std::string, uint32, std::less<>>>(runner, "StdMap", keys, missingKeys);
+			RunHashMapBenchmarks<std::unordered_map<std::string, uint32>>(runner, "StdUnorderedMap", keys, missingKeys);
+			RunHashMapBenchmarks<TFlatHashMap<std::string, uint32>>(runner, "FlatHashMap", keys, missingKeys);
+
+			std::vector<std::string_view> keyViews(keys.begin(), keys.end());
+
+			std::map<std::string, uint32, std::less<>> stdMap;
+			TFlatHashMap<std::string, uint32> flatMap;
+			for (std::size_t i = 0; i < keys.size(); ++i)
+			{
+				stdMap.emplace(keys[i], static_cast<uint32>(i));
+				flatMap.emplace(keys[i], static_cast<uint32>(i));
+			}
+
+			runner.Run("HashMap/StdMap/FindStringView", keys.size(), [&]()
+			{
+				uint32 sum = 0;
+				for (std::string_view key : keyViews)
+				{
+					sum += stdMap.find(key)->second;
+				}
+				DoNotOptimize(sum);
+			});
+
+			runner.Run("HashMap/FlatHashMap/FindStringView", keys.size(), [&]()
+			{
+				uint32 sum = 0;
+				for (std::string_view key : keyViews)
+				{
+					sum += flatMap.find(key)->second;
+				}
+				DoNotOptimize(sum);
+			});
+		}
+	}
+}
@@ -0,0 +1,136 @@
+#include "PCH.h"
+#include "Benchmark.h"
+#include "BenchmarkData.h"
+
+#include "Math/Intersection.h"
+#include "Math/IntersectionPacket.h"
+
+namespace Dash
+{
+	// One ray against size triangles, items are triangles.
+	DASH_BENCHMARK_GROUP(RayTriangle)
+	{
+		for (std::size_t size : BenchmarkSizes)
+		{
+			FBenchmarkRandom random;
+			std::vector<FVector3f> vertices(size * 3);
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				const FVector3f center = random.Vector3(-1.0f, 1.0f) + FVector3f{ 0.0f, 0.0f, 5.0f };
+				vertices[i * 3 + 0] = center + random.Vector3(-0.5f, 0.5f);
+				vertices[i * 3 + 1] = center + random.Vector3(-0.5f, 0.5f);
+				vertices[i * 3 + 2] = center + random.Vector3(-0.5f, 0.5f);
+			}
+
+			std::vector<FTrianglePacket4> packets4((size + 3) / 4);
+			std::vector<FTrianglePacket8> packets8((size + 7) / 8);
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				packets4[i / 4].SetTriangle(i % 4, vertices[i * 3], vertices[i * 3 + 1], vertices[i * 3 + 2]);
+				packets8[i / 8].SetTriangle(i % 8, vertices[i * 3], vertices[i * 3 + 1], vertices[i * 3 + 2]);
+			}
+
+			const FRay ray{ FVector3f{ 0.1f, -0.05f, 0.0f }, FMath::Normalize(FVector3f{ 0.02f, 0.01f, 1.0f }) };
+
+			runner.Run("RayTriangle/Scalar", size, [&]()
+			{
+				float nearest = TScalarTraits<float>::Infinity();
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					float u, v, t;
+					if (FMath::RayTriangleIntersection(ray, vertices[i * 3], vertices[i * 3 + 1], vertices[i * 3 + 2], u, v, t) && t < nearest)
+					{
+						nearest = t;
+					}
+				}
+				DoNotOptimize(nearest);
+			});
+
+			runner.Run("RayTriangle/Packet4", size, [&]()
+			{
+				float nearest = TScalarTraits<float>::Infinity();
+				for (const FTrianglePacket4& packet : packets4)
+				{
+					FPacketTriangleHit hit;
+					if (FMath::RayTriangleIntersection(ray, packet, hit) && hit.T < nearest)
+					{
+						nearest = hit.T;
+					}
+				}
+				DoNotOptimize(nearest);
+			});
+
+			runner.Run("RayTriangle/Packet8", size, [&]()
+			{
+				float nearest = TScalarTraits<float>::Infinity();
+				for (const FTrianglePacket8& packet : packets8)
+				{
+					FPacketTriangleHit hit;
+					if (FMath::RayTriangleIntersection(ray, packet, hit) && hit.T < nearest)
+					{
+						nearest = hit.T;
+					}
+				}
+				DoNotOptimize(nearest);
+			});
+		}
+	}
+
+	// size rays against one box, items are rays.
+	DASH_BENCHMARK_GROUP(RayBox)
+	{
+		for (std::size_t size : BenchmarkSizes)
+		{
+			FBenchmarkRandom random;
+			std::vector<FRay> rays;
+			rays.reserve(size);
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				rays.emplace_back(random.Vector3(-4.0f, 4.0f), FMath::Normalize(random.Vector3()));
+			}
+
+			std::vector<FRayPacket4> packets4((size + 3) / 4);
+			std::vector<FRayPacket8> packets8((size + 7) / 8);
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				packets4[i / 4].SetRay(i % 4, rays[i]);
+				packets8[i / 8].SetRay(i % 8, rays[i]);
+			}
+
+			const FBoundingBox box{ FVector3f{ -1.0f, -1.0f, -1.0f }, FVector3f{ 1.0f, 1.0f, 1.0f } };
+
+			runner.Run("RayBox/Scalar", size, [&]()
+			{
+				uint32 hits = 0;
+				for (const FRay& ray : rays)
+				{
+					float t0, t1;
+					hits += FMath::RayBoundingBoxIntersection(ray, box, t0, t1) ? 1 : 0;
+				}
+				DoNotOptimize(hits);
+			});
+
+			runner.Run("RayBox/Packet4", size, [&]()
+			{
+				uint32 hits = 0;
+				for (const FRayPacket4& packet : packets4)
+				{
+					TPacketBoxHit<4> hit;
+					hits += std::popcount(FMath::RayBoundingBoxIntersection(packet, box, hit));
+				}
+				DoNotOptimize(hits);
+			});
+
+			runner.Run("RayBox/Packet8", size, [&]()
+			{
+				uint32 hits = 0;
+				for (const FRayPacket8& packet : packets8)
+				{
+					TPacketBoxHit<8> hit;
+					hits += std::popcount(FMath::RayBoundingBoxIntersection(packet, box, hit));
+				}
+				DoNotOptimize(hits);
+			});
+		}
+	}
+}
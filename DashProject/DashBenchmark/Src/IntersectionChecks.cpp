@@ -0,0 +1,102 @@
+#include "PCH.h"
+#include "Benchmark.h"
+
+#include "Math/Intersection.h"
+#include "Math/IntersectionPacket.h"
+
+#include <cstdio>
+
+namespace Dash
+{
+	struct FBoxCheckRay
+	{
+		FRay Ray;
+		bool bHit;
+	};
+
+	// Rays that start on a face plane of the unit box and run parallel to it, with +0 and -0 in the direction
+	// components that are zero. 0 * inf is NaN in the slab of that face, which must not clip the ray.
+	static std::vector<FBoxCheckRay> MakeFaceRays()
+	{
+		std::vector<FBoxCheckRay> rays;
+		for (int face = 0; face < 3; ++face)
+		{
+			for (float faceSide : { -1.0f, 1.0f })
+			{
+				for (int travel = 0; travel < 3; ++travel)
+				{
+					if (travel == face)
+					{
+						continue;
+					}
+
+					const int other = 3 - face - travel;
+					for (float travelSign : { -1.0f, 1.0f })
+					{
+						for (float zero : { 0.0f, -0.0f })
+						{
+							// Inside the box along the third axis it grazes the face, outside it misses.
+							for (float offset : { 0.0f, 3.0f })
+							{
+								FVector3f origin;
+								origin[face] = faceSide;
+								origin[travel] = -5.0f * travelSign;
+								origin[other] = offset;
+
+								FVector3f direction;
+								direction[face] = zero;
+								direction[travel] = travelSign;
+								direction[other] = zero;
+
+								rays.push_back(FBoxCheckRay{ FRay{ origin, direction }, offset == 0.0f });
+							}
+						}
+					}
+				}
+			}
+		}
+		return rays;
+	}
+
+	// The packet slab tests against the expected result and the scalar test, on the face rays above.
+	DASH_BENCHMARK_CHECK(RayBox)
+	{
+		const std::vector<FBoxCheckRay> rays = MakeFaceRays();
+		const FBoundingBox box{ FVector3f{ -1.0f, -1.0f, -1.0f }, FVector3f{ 1.0f, 1.0f, 1.0f } };
+
+		FBoundingBoxPacket4 boxes;
+		boxes.SetBox(0, box);
+
+		uint32 scalarErrors = 0;
+		uint32 packet4Errors = 0;
+		uint32 packet8Errors = 0;
+		uint32 boxPacketErrors = 0;
+
+		for (std::size_t i = 0; i < rays.size(); ++i)
+		{
+			const FBoxCheckRay& ray = rays[i];
+
+			float t0, t1;
+			scalarErrors += FMath::RayBoundingBoxIntersection(ray.Ray, box, t0, t1) != ray.bHit;
+
+			FRayPacket4 packet4;
+			packet4.SetRay(i % 4, ray.Ray);
+			TPacketBoxHit<4> hit4;
+			packet4Errors += ((FMath::RayBoundingBoxIntersection(packet4, box, hit4) >> (i % 4)) & 1) != uint32(ray.bHit);
+
+			FRayPacket8 packet8;
+			packet8.SetRay(i % 8, ray.Ray);
+			TPacketBoxHit<8> hit8;
+			packet8Errors += ((FMath::RayBoundingBoxIntersection(packet8, box, hit8) >> (i % 8)) & 1) != uint32(ray.bHit);
+
+			TPacketBoxHit<4> boxHit;
+			boxPacketErrors += (FMath::RayBoundingBoxIntersection(ray.Ray, boxes, boxHit) & 1) != uint32(ray.bHit);
+		}
+
+		std::printf("  %-46s %8u of %zu rays\n", "RayBox/FaceRays/Scalar", scalarErrors, rays.size());
+		std::printf("  %-46s %8u of %zu rays\n", "RayBox/FaceRays/Packet4", packet4Errors, rays.size());
+		std::printf("  %-46s %8u of %zu rays\n", "RayBox/FaceRays/Packet8", packet8Errors, rays.size());
+		std::printf("  %-46s %8u of %zu rays\n", "RayBox/FaceRays/BoxPacket4", boxPacketErrors, rays.size());
+		return scalarErrors == 0 && packet4Errors == 0 && packet8Errors == 0 && boxPacketErrors == 0;
+	}
+}
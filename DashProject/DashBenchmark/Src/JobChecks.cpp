@@ -0,0 +1,62 @@
+#include "PCH.h"
+#include "Benchmark.h"
+#include "BenchmarkData.h"
+
+#include "Utility/JobSystem.h"
+
+#include <cstdio>
+
+namespace Dash
+{
+	static constexpr uint32 GJobCounterCheckRounds = 100000;
+
+	// Re-arms one counter while the jobs on it are finishing: every round runs a job, then a second one on the
+	// same counter at about the time a worker completes the first. The counter must not read done before both ran.
+	DASH_BENCHMARK_CHECK(JobCounter)
+	{
+		FJobSystem::Get().Init();
+
+		FBenchmarkRandom random;
+		FJobCounter counter;
+		std::atomic<uint32> completed{ 0 };
+		uint32 submitted = 0;
+		uint32 earlyDones = 0;
+
+		for (uint32 round = 0; round < GJobCounterCheckRounds; ++round)
+		{
+			FJobSystem::Get().Run(FJobDesc{ [&completed]() { completed.fetch_add(1, std::memory_order_relaxed); }, "CheckJob" }, &counter);
+
+			// Vary the delay so the second Run lands anywhere around the completion of the first.
+			const uint32 spins = random.UInt(2048);
+			for (uint32 spin = 0; spin < spins; ++spin)
+			{
+				DoNotOptimize(spin);
+			}
+
+			FJobSystem::Get().Run(FJobDesc{ [&completed]() { completed.fetch_add(1, std::memory_order_relaxed); }, "CheckJob" }, &counter);
+			submitted += 2;
+
+			// Not Wait, which would run the jobs on this thread: the workers have to complete them.
+			while (!counter.IsDone())
+			{
+				std::this_thread::yield();
+			}
+
+			if (completed.load(std::memory_order_relaxed) != submitted)
+			{
+				++earlyDones;
+
+				// Let the job that was missed finish before the next round reuses the counter.
+				while (completed.load(std::memory_order_relaxed) != submitted)
+				{
+					std::this_thread::yield();
+				}
+			}
+		}
+
+		FJobSystem::Get().Shutdown();
+
+		std::printf("  %-46s %8u of %u rounds\n", "JobCounter/DoneBeforeJobsRan", earlyDones, GJobCounterCheckRounds);
+		return earlyDones == 0;
+	}
+}
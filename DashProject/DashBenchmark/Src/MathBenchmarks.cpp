@@ -0,0 +1,244 @@
+#include "PCH.h"
+#include "Benchmark.h"
+#include "BenchmarkData.h"
+
+#include "Math/TransformHierarchy.h"
+
+namespace Dash
+{
+	DASH_BENCHMARK_GROUP(Vector)
+	{
+		for (std::size_t size : BenchmarkSizes)
+		{
+			FBenchmarkRandom random;
+			std::vector<FVector4f> a(size), b(size), c(size), out4(size);
+			std::vector<FVector3f> u(size), v(size), out3(size);
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				a[i] = random.Vector4();
+				b[i] = random.Vector4();
+				c[i] = random.Vector4();
+				u[i] = random.Vector3();
+				v[i] = random.Vector3();
+			}
+
+			runner.Run("Vector4/MulAdd", size, [&]()
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					out4[i] = a[i] * b[i] + c[i];
+				}
+				DoNotOptimize(out4.data());
+			});
+
+			runner.Run("Vector4/Dot", size, [&]()
+			{
+				float sum = 0.0f;
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					sum += FMath::Dot(a[i], b[i]);
+				}
+				DoNotOptimize(sum);
+			});
+
+			runner.Run("Vector4/Normalize", size, [&]()
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					out4[i] = FMath::Normalize(a[i]);
+				}
+				DoNotOptimize(out4.data());
+			});
+
+			runner.Run("Vector3/Cross", size, [&]()
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					out3[i] = FMath::Cross(u[i], v[i]);
+				}
+				DoNotOptimize(out3.data());
+			});
+
+			runner.Run("Vector3/Normalize", size, [&]()
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					out3[i] = FMath::Normalize(u[i]);
+				}
+				DoNotOptimize(out3.data());
+			});
+		}
+	}
+
+	DASH_BENCHMARK_GROUP(Matrix)
+	{
+		for (std::size_t size : BenchmarkSizes)
+		{
+			FBenchmarkRandom random;
+			std::vector<FMatrix4x4> a(size), b(size), out(size);
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				a[i] = random.Transform().GetMatrix();
+				b[i] = random.Transform().GetMatrix();
+			}
+
+			runner.Run("Matrix4x4/Multiply", size, [&]()
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					out[i] = a[i] * b[i];
+				}
+				DoNotOptimize(out.data());
+			});
+
+			runner.Run("Matrix4x4/Inverse", size, [&]()
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					out[i] = FMath::Inverse(a[i]);
+				}
+				DoNotOptimize(out.data());
+			});
+
+			runner.Run("Matrix4x4/InverseAffine", size, [&]()
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					out[i] = FMath::InverseAffine(a[i]);
+				}
+				DoNotOptimize(out.data());
+			});
+
+			runner.Run("Matrix4x4/Transpose", size, [&]()
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					out[i] = FMath::Transpose(a[i]);
+				}
+				DoNotOptimize(out.data());
+			});
+		}
+	}
+
+	DASH_BENCHMARK_GROUP(Quaternion)
+	{
+		for (std::size_t size : BenchmarkSizes)
+		{
+			FBenchmarkRandom random;
+			std::vector<FQuaternion> a(size), b(size), out(size);
+			std::vector<float> t(size);
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				a[i] = random.UnitQuaternion();
+				b[i] = random.UnitQuaternion();
+				t[i] = random.Float(0.0f, 1.0f);
+			}
+
+			runner.Run("Quaternion/Multiply", size, [&]()
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					out[i] = a[i] * b[i];
+				}
+				DoNotOptimize(out.data());
+			});
+
+			runner.Run("Quaternion/Slerp", size, [&]()
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					out[i] = FMath::Slerp(a[i], b[i], t[i]);
+				}
+				DoNotOptimize(out.data());
+			});
+		}
+	}
+
+	DASH_BENCHMARK_GROUP(Transform)
+	{
+		for (std::size_t size : BenchmarkSizes)
+		{
+			FBenchmarkRandom random;
+			std::vector<FTransform> a(size), b(size), out(size);
+			std::vector<FTransformTRS> local(size);
+			std::vector<FAffineMatrix3x4> affineA(size), affineB(size), affineOut(size);
+			std::vector<int32> parent(size);
+			FTransformHierarchy hierarchy;
+
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				a[i] = random.Transform();
+				b[i] = random.Transform();
+				local[i] = FTransformTRS{ a[i] };
+				affineA[i] = FMath::ToAffineMatrix(local[i]);
+				affineB[i] = FMath::ToAffineMatrix(FTransformTRS{ b[i] });
+
+				// Shallow random tree, one root per 16 nodes.
+				parent[i] = i % 16 == 0 ? -1 : static_cast<int32>(random.UInt(static_cast<uint32>(i)));
+				hierarchy.Add(local[i], parent[i]);
+			}
+
+			runner.Run("Transform/FTransformCompose", size, [&]()
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					out[i] = a[i] * b[i];
+				}
+				DoNotOptimize(out.data());
+			});
+
+			runner.Run("Transform/AffineCompose", size, [&]()
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					affineOut[i] = FMath::Mul(affineA[i], affineB[i]);
+				}
+				DoNotOptimize(affineOut.data());
+			});
+
+			runner.Run("Transform/AffineInverse", size, [&]()
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					affineOut[i] = FMath::Inverse(affineA[i]);
+				}
+				DoNotOptimize(affineOut.data());
+			});
+
+			runner.Run("Transform/TRSToAffine", size, [&]()
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					affineOut[i] = FMath::ToAffineMatrix(local[i]);
+				}
+				DoNotOptimize(affineOut.data());
+			});
+
+			runner.Run("Transform/AffineDecompose", size, [&]()
+			{
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					local[i] = FMath::Decompose(affineA[i]);
+				}
+				DoNotOptimize(local.data());
+			});
+
+			runner.Run("Transform/ComputeWorldMatrices", size, [&]()
+			{
+				FMath::ComputeWorldMatrices(local, parent, affineOut);
+				DoNotOptimize(affineOut.data());
+			});
+
+			// Touching every root forces the whole hierarchy to update.
+			runner.Run("Transform/HierarchyUpdate", size, [&]()
+			{
+				for (std::size_t i = 0; i < size; i += 16)
+				{
+					hierarchy.SetLocalTransform(static_cast<int32>(i), local[i]);
+				}
+				hierarchy.UpdateWorldMatrices();
+				DoNotOptimize(hierarchy.GetWorldMatrices().data());
+			});
+		}
+	}
+}
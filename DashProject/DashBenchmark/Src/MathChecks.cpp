@@ -0,0 +1,289 @@
+#include "PCH.h"
+#include "Benchmark.h"
+#include "BenchmarkData.h"
+
+#include <bit>
+#include <cfloat>
+#include <cstdio>
+
+namespace Dash
+{
+	// Random matrices per input kind and kernel.
+	static constexpr std::size_t GMatrixCheckCount = 10000;
+
+	using FMatrix4x4d = TScalarMatrix<double, 4, 4>;
+
+	static FMatrix4x4d ToDouble(const FMatrix4x4& a)
+	{
+		FMatrix4x4d result;
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				result[i][j] = a[i][j];
+			}
+		}
+		return result;
+	}
+
+	// One float ulp at the magnitude of value.
+	static double FloatUlp(double value)
+	{
+		return std::ldexp(1.0, std::ilogb(std::max(std::abs(value), double(FLT_MIN))) - (FLT_MANT_DIG - 1));
+	}
+
+	// Affine transforms as the engine builds them, and general matrices with a dominant diagonal so that the
+	// inverse is well conditioned and its error reflects the kernel, not the input.
+	static std::vector<FMatrix4x4> MakeCheckMatrices(FBenchmarkRandom& random)
+	{
+		std::vector<FMatrix4x4> matrices;
+		matrices.reserve(2 * GMatrixCheckCount);
+
+		for (std::size_t i = 0; i < GMatrixCheckCount; ++i)
+		{
+			matrices.push_back(random.Transform().GetMatrix());
+		}
+
+		for (std::size_t i = 0; i < GMatrixCheckCount; ++i)
+		{
+			FMatrix4x4 a;
+			for (int row = 0; row < 4; ++row)
+			{
+				for (int column = 0; column < 4; ++column)
+				{
+					a[row][column] = random.Float() + (row == column ? (random.UInt(2) ? 4.0f : -4.0f) : 0.0f);
+				}
+			}
+			matrices.push_back(a);
+		}
+
+		return matrices;
+	}
+
+	static bool ReportError(const char* name, double maxUlps, double limitUlps)
+	{
+		std::printf("  %-46s %8.2f ulp (limit %.0f)\n", name, maxUlps, limitUlps);
+		return maxUlps <= limitUlps;
+	}
+
+	// The float kernels of the build variant, Matrix4x4_SSE.h under USE_SSE, against the generic TScalarMatrix
+	// templates evaluated in double. Errors are in float ulps of the magnitude of the terms summed into an element,
+	// so cancellation in a small element does not count against the kernel.
+	DASH_BENCHMARK_CHECK(Matrix4x4)
+	{
+		FBenchmarkRandom random;
+		const std::vector<FMatrix4x4> a = MakeCheckMatrices(random);
+		const std::vector<FMatrix4x4> b = MakeCheckMatrices(random);
+
+		double multiplyUlps = 0.0;
+		double inverseUlps = 0.0;
+		double inverseAffineUlps = 0.0;
+		double transposeUlps = 0.0;
+		double determinateUlps = 0.0;
+		double mulMatrixVectorUlps = 0.0;
+		double mulVectorMatrixUlps = 0.0;
+
+		for (std::size_t n = 0; n < a.size(); ++n)
+		{
+			const FMatrix4x4d ad = ToDouble(a[n]);
+			const FMatrix4x4d bd = ToDouble(b[n]);
+
+			const FMatrix4x4 product = a[n] * b[n];
+			const FMatrix4x4d productReference = FMath::Mul(ad, bd);
+
+			const FMatrix4x4 inverse = FMath::Inverse(a[n]);
+			const FMatrix4x4d inverseReference = FMath::Inverse(ad);
+
+			const FMatrix4x4 transpose = FMath::Transpose(a[n]);
+			const FMatrix4x4d transposeReference = FMath::Transpose(ad);
+
+			// The first half of the inputs are affine, InverseAffine is only defined for those.
+			const bool affine = n < GMatrixCheckCount;
+			const FMatrix4x4 inverseAffine = affine ? FMath::InverseAffine(a[n]) : FMatrix4x4{};
+
+			// The determinant against the sum of the magnitudes of its 24 terms.
+			const double determinateReference = FMath::Determinate(ad);
+			double determinateMagnitude = 0.0;
+			for (int j = 0; j < 4; ++j)
+			{
+				for (int k = 0; k < 4; ++k)
+				{
+					for (int l = 0; l < 4; ++l)
+					{
+						if (j != k && j != l && k != l)
+						{
+							determinateMagnitude += std::abs(ad[0][j] * ad[1][k] * ad[2][l] * ad[3][6 - j - k - l]);
+						}
+					}
+				}
+			}
+			determinateUlps = std::max(determinateUlps, std::abs(FMath::Determinate(a[n]) - determinateReference) / FloatUlp(determinateMagnitude));
+
+			const FVector4f v = b[n][n % 4];
+			const TScalarArray<double, 4> vd{ v.X, v.Y, v.Z, v.W };
+			const FVector4f matrixVector = FMath::Mul(a[n], v);
+			const FVector4f vectorMatrix = FMath::Mul(v, a[n]);
+			const TScalarArray<double, 4> matrixVectorReference = FMath::Mul(ad, vd);
+			const TScalarArray<double, 4> vectorMatrixReference = FMath::Mul(vd, ad);
+
+			for (int i = 0; i < 4; ++i)
+			{
+				double inverseRowMagnitude = 0.0;
+				for (int j = 0; j < 4; ++j)
+				{
+					inverseRowMagnitude = std::max(inverseRowMagnitude, std::abs(inverseReference[i][j]));
+				}
+
+				for (int j = 0; j < 4; ++j)
+				{
+					double productMagnitude = 0.0;
+					for (int k = 0; k < 4; ++k)
+					{
+						productMagnitude += std::abs(ad[i][k] * bd[k][j]);
+					}
+
+					multiplyUlps = std::max(multiplyUlps, std::abs(product[i][j] - productReference[i][j]) / FloatUlp(productMagnitude));
+					inverseUlps = std::max(inverseUlps, std::abs(inverse[i][j] - inverseReference[i][j]) / FloatUlp(inverseRowMagnitude));
+					transposeUlps = std::max(transposeUlps, std::abs(transpose[i][j] - transposeReference[i][j]) / FloatUlp(transposeReference[i][j]));
+
+					if (affine)
+					{
+						inverseAffineUlps = std::max(inverseAffineUlps, std::abs(inverseAffine[i][j] - inverseReference[i][j]) / FloatUlp(inverseRowMagnitude));
+					}
+				}
+
+				double matrixVectorMagnitude = 0.0;
+				double vectorMatrixMagnitude = 0.0;
+				for (int k = 0; k < 4; ++k)
+				{
+					matrixVectorMagnitude += std::abs(ad[i][k] * vd[k]);
+					vectorMatrixMagnitude += std::abs(vd[k] * ad[k][i]);
+				}
+
+				mulMatrixVectorUlps = std::max(mulMatrixVectorUlps, std::abs(matrixVector[i] - matrixVectorReference[i]) / FloatUlp(matrixVectorMagnitude));
+				mulVectorMatrixUlps = std::max(mulVectorMatrixUlps, std::abs(vectorMatrix[i] - vectorMatrixReference[i]) / FloatUlp(vectorMatrixMagnitude));
+			}
+		}
+
+		bool passed = true;
+		passed = ReportError("Matrix4x4/Multiply", multiplyUlps, 4.0) && passed;
+		passed = ReportError("Matrix4x4/Inverse", inverseUlps, 16.0) && passed;
+		passed = ReportError("Matrix4x4/InverseAffine", inverseAffineUlps, 16.0) && passed;
+		passed = ReportError("Matrix4x4/Transpose", transposeUlps, 0.0) && passed;
+		passed = ReportError("Matrix4x4/Determinate", determinateUlps, 8.0) && passed;
+		passed = ReportError("Matrix4x4/MulMatrixVector", mulMatrixVectorUlps, 4.0) && passed;
+		passed = ReportError("Matrix4x4/MulVectorMatrix", mulVectorMatrixUlps, 4.0) && passed;
+		return passed;
+	}
+
+	// Every 61st positive float bit pattern, which walks through all mantissa patterns across the exponents,
+	// plus every denormal.
+	static std::vector<float> MakeRSqrtCheckInputs()
+	{
+		std::vector<float> inputs;
+		for (uint32 bits = 1; bits < 0x7f800000u; bits += (bits < 0x00800000u ? 1 : 61))
+		{
+			inputs.push_back(std::bit_cast<float>(bits));
+		}
+		return inputs;
+	}
+
+	// Every 61st float bit pattern up to 100, plus the floats next to the multiples of pi / 2, where the reduced
+	// argument cancels down to a few bits.
+	static std::vector<float> MakeSinCosCheckInputs()
+	{
+		std::vector<float> inputs;
+		for (uint32 bits = 0; bits <= std::bit_cast<uint32>(100.0f); bits += 61)
+		{
+			inputs.push_back(std::bit_cast<float>(bits));
+		}
+
+		for (int k = 1; k <= 63; ++k)
+		{
+			const uint32 center = std::bit_cast<uint32>(float(k * 1.57079632679489661923));
+			for (uint32 bits = center - 64; bits <= center + 64; ++bits)
+			{
+				inputs.push_back(std::bit_cast<float>(bits));
+			}
+		}
+		return inputs;
+	}
+
+	// The SIMDMath.h kernels against the double precision functions. The ulp limits are the ones documented there
+	// for the default build, FAST_APPROX trades them for speed and only has to get the special values right.
+	DASH_BENCHMARK_CHECK(SIMDMath)
+	{
+		bool passed = true;
+
+		const float specialIn[4] = { TScalarTraits<float>::Infinity(), -TScalarTraits<float>::Infinity(), std::numeric_limits<float>::quiet_NaN(), 0.0f };
+		float specialSin[4];
+		float specialCos[4];
+		FMath::SinCos(std::span<const float>(specialIn), std::span<float>(specialSin), std::span<float>(specialCos));
+
+		uint32 specialErrors = 0;
+		for (int n = 0; n < 3; ++n)
+		{
+			specialErrors += !std::isnan(specialSin[n]) + !std::isnan(specialCos[n]);
+		}
+		specialErrors += (specialSin[3] != 0.0f) + (specialCos[3] != 1.0f);
+
+		std::printf("  %-46s %8u wrong\n", "SIMDMath/SinCosSpecialValues", specialErrors);
+		passed = specialErrors == 0 && passed;
+
+#ifdef FAST_APPROX
+		std::printf("  %-46s skipped with FAST_APPROX\n", "SIMDMath ulp limits");
+#else
+		const std::vector<float> sinCosIn = MakeSinCosCheckInputs();
+		std::vector<float> sinOut(sinCosIn.size());
+		std::vector<float> cosOut(sinCosIn.size());
+		FMath::SinCos(std::span<const float>(sinCosIn), std::span<float>(sinOut), std::span<float>(cosOut));
+
+		double sinUlps = 0.0;
+		double cosUlps = 0.0;
+		for (std::size_t n = 0; n < sinCosIn.size(); ++n)
+		{
+			const double sinReference = std::sin(double(sinCosIn[n]));
+			const double cosReference = std::cos(double(sinCosIn[n]));
+			sinUlps = std::max(sinUlps, std::abs(sinOut[n] - sinReference) / FloatUlp(sinReference));
+			cosUlps = std::max(cosUlps, std::abs(cosOut[n] - cosReference) / FloatUlp(cosReference));
+		}
+
+		// Both signs and magnitudes over 2^-30 .. 2^30, a quarter of the pairs with y and x close together.
+		FBenchmarkRandom random;
+		std::vector<float> atanY(GMatrixCheckCount * 100);
+		std::vector<float> atanX(atanY.size());
+		std::vector<float> atanOut(atanY.size());
+		for (std::size_t n = 0; n < atanY.size(); ++n)
+		{
+			atanY[n] = random.Float() * std::exp2(random.Float(-30.0f, 30.0f));
+			atanX[n] = (n % 4 == 0) ? atanY[n] * (1.0f + 0.5f * random.Float()) : random.Float() * std::exp2(random.Float(-30.0f, 30.0f));
+		}
+		FMath::ATan2(atanY, atanX, atanOut);
+
+		double atanUlps = 0.0;
+		for (std::size_t n = 0; n < atanY.size(); ++n)
+		{
+			const double reference = std::atan2(double(atanY[n]), double(atanX[n]));
+			atanUlps = std::max(atanUlps, std::abs(atanOut[n] - reference) / FloatUlp(reference));
+		}
+
+		const std::vector<float> rsqrtIn = MakeRSqrtCheckInputs();
+		std::vector<float> rsqrtOut(rsqrtIn.size());
+		FMath::RSqrt(rsqrtIn, rsqrtOut);
+
+		double rsqrtUlps = 0.0;
+		for (std::size_t n = 0; n < rsqrtIn.size(); ++n)
+		{
+			const double reference = 1.0 / std::sqrt(double(rsqrtIn[n]));
+			rsqrtUlps = std::max(rsqrtUlps, std::abs(rsqrtOut[n] - reference) / FloatUlp(reference));
+		}
+
+		passed = ReportError("SIMDMath/Sin", sinUlps, 2.0) && passed;
+		passed = ReportError("SIMDMath/Cos", cosUlps, 2.0) && passed;
+		passed = ReportError("SIMDMath/ATan2", atanUlps, 3.0) && passed;
+		passed = ReportError("SIMDMath/RSqrt", rsqrtUlps, 4.0) && passed;
+#endif // FAST_APPROX
+
+		return passed;
+	}
+}
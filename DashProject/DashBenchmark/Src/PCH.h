@@ -0,0 +1,33 @@
+#pragma once
+
+// Portable subset of DashCore/Src/PCH/PCH.h: the standard library, the basic types and the math library,
+// without the platform and graphics headers, so the benchmark builds anywhere the Math code does.
+
+#include <cstdint>
+#include <cmath>
+
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <iostream>
+
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <span>
+#include <functional>
+
+#include "Consolid/Consolid.h"
+#include "Utility/Assert.h"
+
+#include "Math/MathType.h"
+
+// The log manager is not part of the benchmark, log calls in the shared sources compile to nothing.
+#define DASH_LOG(Name, Level, ...)
@@ -0,0 +1,83 @@
+#include "PCH.h"
+#include "Benchmark.h"
+#include "BenchmarkData.h"
+
+#include "Utility/ParallelAlgorithms.h"
+
+#include <numeric>
+
+namespace Dash
+{
+	namespace
+	{
+		constexpr std::size_t ParallelSizes[] = { 16384, 262144, 1048576 };
+	}
+
+	// Serial loops next to their parallel versions on the job system with all hardware threads.
+	DASH_BENCHMARK_GROUP(Parallel)
+	{
+		FJobSystem::Get().Init();
+
+		for (std::size_t size : ParallelSizes)
+		{
+			FBenchmarkRandom random;
+			std::vector<float> values(size), scanned(size);
+			std::vector<uint32> keys(size), sorted(size), scratch(size);
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				values[i] = random.Float();
+				keys[i] = random.UInt(UINT32_MAX);
+			}
+
+			runner.Run("Parallel/SerialSum", size, [&]()
+			{
+				float sum = 0.0f;
+				for (float value : values)
+				{
+					sum += value;
+				}
+				DoNotOptimize(sum);
+			});
+
+			runner.Run("Parallel/ParallelReduceSum", size, [&]()
+			{
+				DoNotOptimize(ParallelTransformReduce(std::span<const float>(values), 0.0f, [](float value) { return value; }, std::plus<float>()));
+			});
+
+			runner.Run("Parallel/SerialInclusiveScan", size, [&]()
+			{
+				std::inclusive_scan(values.begin(), values.end(), scanned.begin());
+				DoNotOptimize(scanned.data());
+			});
+
+			runner.Run("Parallel/ParallelInclusiveScan", size, [&]()
+			{
+				ParallelInclusiveScan(std::span<const float>(values), std::span<float>(scanned));
+				DoNotOptimize(scanned.data());
+			});
+
+			runner.Run("Parallel/StdSort", size, [&]()
+			{
+				sorted = keys;
+				std::sort(sorted.begin(), sorted.end());
+				DoNotOptimize(sorted.data());
+			});
+
+			runner.Run("Parallel/ParallelSort", size, [&]()
+			{
+				sorted = keys;
+				ParallelSort(std::span<uint32>(sorted), std::span<uint32>(scratch));
+				DoNotOptimize(sorted.data());
+			});
+
+			runner.Run("Parallel/ParallelRadixSort", size, [&]()
+			{
+				sorted = keys;
+				ParallelRadixSort(std::span<uint32>(sorted), std::span<uint32>(scratch));
+				DoNotOptimize(sorted.data());
+			});
+		}
+
+		FJobSystem::Get().Shutdown();
+	}
+}
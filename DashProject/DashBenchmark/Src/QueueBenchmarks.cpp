@@ -0,0 +1,188 @@
+#include "PCH.h"
+#include "Benchmark.h"
+
+#include "Utility/MPMCQueue.h"
+#include "Utility/ThreadSafeQueue.h"
+
+#include <atomic>
+#include <thread>
+
+namespace Dash
+{
+	namespace
+	{
+		constexpr std::size_t ContentionThreadCounts[] = { 1, 2, 4, 8, 16, 32 };
+		constexpr std::size_t ItemsPerProducer = 4096;
+		constexpr std::size_t BulkSize = 16;
+
+		// Common interface over the queues, TryPush only fails on the bounded queue when it is full.
+		struct FMutexQueueAdapter
+		{
+			TThreadSafeQueue<uint32> Queue;
+
+			bool TryPush(uint32 value) { Queue.Push(value); return true; }
+			bool TryPop(uint32& value) { return Queue.TryPop(value); }
+		};
+
+		struct FBoundedQueueAdapter
+		{
+			TMPMCBoundedQueue<uint32> Queue{ 8192 };
+
+			bool TryPush(uint32 value) { return Queue.TryPush(value); }
+			bool TryPop(uint32& value) { return Queue.TryPop(value); }
+		};
+
+		struct FSegmentedQueueAdapter
+		{
+			TMPMCQueue<uint32> Queue;
+
+			bool TryPush(uint32 value) { Queue.Push(value); return true; }
+			bool TryPop(uint32& value) { return Queue.TryPop(value); }
+		};
+
+		struct FBoundedBulkQueueAdapter
+		{
+			TMPMCBoundedQueue<uint32> Queue{ 8192 };
+
+			std::size_t PushBulk(uint32* values, std::size_t count) { return Queue.PushBulk(values, count); }
+			std::size_t PopBulk(uint32* values, std::size_t count) { return Queue.PopBulk(values, count); }
+		};
+
+		struct FSegmentedBulkQueueAdapter
+		{
+			TMPMCQueue<uint32> Queue;
+
+			std::size_t PushBulk(uint32* values, std::size_t count) { Queue.PushBulk(values, count); return count; }
+			std::size_t PopBulk(uint32* values, std::size_t count) { return Queue.PopBulk(values, count); }
+		};
+
+		template<typename QueueType>
+		void ProduceItems(QueueType& queue, uint32 first)
+		{
+			if constexpr (requires { queue.PushBulk(nullptr, 0); })
+			{
+				uint32 values[BulkSize];
+				for (std::size_t item = 0; item < ItemsPerProducer; item += BulkSize)
+				{
+					for (std::size_t i = 0; i < BulkSize; ++i)
+					{
+						values[i] = first + static_cast<uint32>(item + i);
+					}
+
+					std::size_t pushed = 0;
+					while (pushed < BulkSize)
+					{
+						const std::size_t count = queue.PushBulk(values + pushed, BulkSize - pushed);
+						pushed += count;
+						if (count == 0)
+						{
+							std::this_thread::yield();
+						}
+					}
+				}
+			}
+			else
+			{
+				for (std::size_t item = 0; item < ItemsPerProducer; ++item)
+				{
+					while (!queue.TryPush(first + static_cast<uint32>(item)))
+					{
+						std::this_thread::yield();
+					}
+				}
+			}
+		}
+
+		template<typename QueueType>
+		uint64 ConsumeItems(QueueType& queue, std::atomic<std::size_t>& remaining)
+		{
+			uint64 sum = 0;
+			while (remaining.load(std::memory_order_relaxed) > 0)
+			{
+				std::size_t count = 0;
+				if constexpr (requires { queue.PopBulk(nullptr, 0); })
+				{
+					uint32 values[BulkSize];
+					count = queue.PopBulk(values, BulkSize);
+					for (std::size_t i = 0; i < count; ++i)
+					{
+						sum += values[i];
+					}
+				}
+				else
+				{
+					uint32 value;
+					if (queue.TryPop(value))
+					{
+						sum += value;
+						count = 1;
+					}
+				}
+
+				if (count > 0)
+				{
+					remaining.fetch_sub(count, std::memory_order_relaxed);
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+			return sum;
+		}
+
+		// Half of the threads produce and half consume, a single thread pushes everything and then pops it.
+		// Thread start up is part of the measured time, ItemsPerProducer keeps it small next to the queue traffic.
+		template<typename QueueType>
+		void RunContention(std::size_t threadCount)
+		{
+			QueueType queue;
+
+			if (threadCount == 1)
+			{
+				std::atomic<std::size_t> remaining(ItemsPerProducer);
+				ProduceItems(queue, 0);
+				DoNotOptimize(ConsumeItems(queue, remaining));
+				return;
+			}
+
+			const std::size_t producerCount = threadCount / 2;
+			const std::size_t consumerCount = threadCount - producerCount;
+			std::atomic<std::size_t> remaining(producerCount * ItemsPerProducer);
+			std::atomic<uint64> sum(0);
+
+			std::vector<std::thread> threads;
+			threads.reserve(threadCount);
+			for (std::size_t i = 0; i < producerCount; ++i)
+			{
+				threads.emplace_back([&queue, i]() { ProduceItems(queue, static_cast<uint32>(i * ItemsPerProducer)); });
+			}
+			for (std::size_t i = 0; i < consumerCount; ++i)
+			{
+				threads.emplace_back([&queue, &remaining, &sum]() { sum += ConsumeItems(queue, remaining); });
+			}
+
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+
+			DoNotOptimize(sum.load());
+		}
+	}
+
+	// Items are values moved through the queue, size is the thread count.
+	DASH_BENCHMARK_GROUP(Queue)
+	{
+		for (std::size_t threadCount : ContentionThreadCounts)
+		{
+			const std::size_t itemCount = std::max<std::size_t>(threadCount / 2, 1) * ItemsPerProducer;
+
+			runner.Run("Queue/MutexQueue", threadCount, itemCount, [&]() { RunContention<FMutexQueueAdapter>(threadCount); });
+			runner.Run("Queue/BoundedMPMC", threadCount, itemCount, [&]() { RunContention<FBoundedQueueAdapter>(threadCount); });
+			runner.Run("Queue/SegmentedMPMC", threadCount, itemCount, [&]() { RunContention<FSegmentedQueueAdapter>(threadCount); });
+			runner.Run("Queue/BoundedMPMCBulk", threadCount, itemCount, [&]() { RunContention<FBoundedBulkQueueAdapter>(threadCount); });
+			runner.Run("Queue/SegmentedMPMCBulk", threadCount, itemCount, [&]() { RunContention<FSegmentedBulkQueueAdapter>(threadCount); });
+		}
+	}
+}
@@ -0,0 +1,73 @@
+#include "PCH.h"
+#include "Benchmark.h"
+
+#include "Utility/CpuFeatures.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace Dash;
+
+static void PrintUsage(const char* program)
+{
+	std::printf("Usage: %s [--filter <substring>] [--json <path>] [--samples <count>] [--min-time <seconds>] [--check]\n", program);
+}
+
+int main(int argc, char** argv)
+{
+	FBenchmarkOptions options;
+	std::string jsonPath = "BenchmarkResults.json";
+	bool bCheck = false;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string arg = argv[i];
+		const bool hasValue = i + 1 < argc;
+
+		if (arg == "--filter" && hasValue)
+		{
+			options.Filter = argv[++i];
+		}
+		else if (arg == "--json" && hasValue)
+		{
+			jsonPath = argv[++i];
+		}
+		else if (arg == "--samples" && hasValue)
+		{
+			options.SampleCount = static_cast<uint32>(std::max(1, std::atoi(argv[++i])));
+		}
+		else if (arg == "--min-time" && hasValue)
+		{
+			options.MinSampleSeconds = std::atof(argv[++i]);
+		}
+		else if (arg == "--check")
+		{
+			bCheck = true;
+		}
+		else
+		{
+			PrintUsage(argv[0]);
+			return arg == "--help" ? 0 : 1;
+		}
+	}
+
+	const FCpuFeatures& cpu = FCpuFeatures::Get();
+	std::printf("CPU: %s (%s)\n\n", cpu.GetBrand().c_str(), FCpuFeatures::GetIsaName(cpu.GetIsa()));
+
+	if (bCheck)
+	{
+		return FBenchmarkRegistry::Get().RunChecks() ? 0 : 1;
+	}
+
+	FBenchmarkRunner runner(options);
+	FBenchmarkRegistry::Get().RunAll(runner);
+
+	if (!runner.WriteJson(jsonPath))
+	{
+		std::fprintf(stderr, "Failed to write %s\n", jsonPath.c_str());
+		return 1;
+	}
+
+	std::printf("\nResults written to %s\n", jsonPath.c_str());
+	return 0;
+}
@@ -12,14 +12,14 @@ namespace Dash
 		const std::vector<FShaderPassRef>& shaderPass = shaderTechnique->GetPasses();
 		for (auto& pass : shaderPass)
 		{
-			const std::string passName = pass->GetPassName();
+			const FName passName = pass->GetPassName();
 			FShaderPassParameter& PassParameter = mShaderPassParametersMap[passName];
 			PassParameter.ShaderPass = pass;
 
 			for (auto& pair : PassParameter.ShaderPass->GetShaders())
 			{
 				EShaderStage stage = pair.first;
-				const std::map<std::string, FShaderVariable>& shaderVariables = pass->GetShaderVariableMap(stage);
+				const TFlatHashMap<FName, FShaderVariable>& shaderVariables = pass->GetShaderVariableMap(stage);
 
 				for (auto& shaderVarPair : shaderVariables)
 				{
@@ -27,7 +27,7 @@ namespace Dash
 
 					if (shaderVariable.ParamterType == EShaderParameterType::UniformBuffer)
 					{
-						if (!FStringUtility::Contains(shaderVariable.Name, "MaterialConstantBuffer"))
+						if (!FStringUtility::Contains(shaderVariable.Name.ToString(), "MaterialConstantBuffer"))
 						{
 							continue;
 						}
@@ -46,7 +46,7 @@ namespace Dash
 						uniformVariableInfo.Size = shaderVariable.Size;
 						uniformVariableInfo.StartOffset = shaderVariable.StartOffset;
 
-						if (!FStringUtility::Contains(uniformVariableInfo.BufferName, "MaterialConstantBuffer"))
+						if (!FStringUtility::Contains(uniformVariableInfo.BufferName.ToString(), "MaterialConstantBuffer"))
 						{
 							continue;
 						}
@@ -83,13 +83,14 @@ namespace Dash
 	{
 	}
 
-	bool FMaterial::SetTextureParameter(const std::string& parameterName, const FTextureRef& texture)
+	bool FMaterial::SetTextureParameter(FName parameterName, const FTextureRef& texture)
 	{
-		if (mTextureParameterMap.contains(parameterName))
+		auto parameterIter = mTextureParameterMap.find(parameterName);
+		if (parameterIter != mTextureParameterMap.end())
 		{
-			mTextureParameterMap[parameterName].Parameter = texture;
+			parameterIter->second.Parameter = texture;
 
-			for (auto& passName : mTextureParameterMap[parameterName].RelevantPasses)
+			for (auto& passName : parameterIter->second.RelevantPasses)
 			{
 				mShaderPassParametersMap[passName].TextureBufferMap[parameterName] = texture;
 			}
@@ -100,12 +101,13 @@ namespace Dash
 		return false;
 	}
 
-	bool FMaterial::SetFloatParameter(const std::string& parameterName, Scalar parameter)
+	bool FMaterial::SetFloatParameter(FName parameterName, Scalar parameter)
 	{
-		if (mScalarParameterMap.contains(parameterName))
+		auto parameterIter = mScalarParameterMap.find(parameterName);
+		if (parameterIter != mScalarParameterMap.end())
 		{
-			mScalarParameterMap[parameterName].Parameter = parameter;
-			for (auto& variableInfo : mScalarParameterMap[parameterName].ConstantBufferVariableMap)
+			parameterIter->second.Parameter = parameter;
+			for (auto& variableInfo : parameterIter->second.ConstantBufferVariableMap)
 			{	
 				Scalar* variable = reinterpret_cast<Scalar*>(mShaderPassParametersMap[variableInfo.first].ConstantBufferMap[variableInfo.second.BufferName].data() + variableInfo.second.StartOffset);
 				*variable = parameter;
@@ -117,12 +119,13 @@ namespace Dash
 		return false;
 	}
 
-	bool FMaterial::SetVector2Parameter(const std::string& parameterName, const FVector2f& parameter)
+	bool FMaterial::SetVector2Parameter(FName parameterName, const FVector2f& parameter)
 	{
-		if (mVector2ParameterMap.contains(parameterName))
+		auto parameterIter = mVector2ParameterMap.find(parameterName);
+		if (parameterIter != mVector2ParameterMap.end())
 		{
-			mVector2ParameterMap[parameterName].Parameter = parameter;
-			for (auto& variableInfo : mVector2ParameterMap[parameterName].ConstantBufferVariableMap)
+			parameterIter->second.Parameter = parameter;
+			for (auto& variableInfo : parameterIter->second.ConstantBufferVariableMap)
 			{
 				FVector2f* variable = reinterpret_cast<FVector2f*>(mShaderPassParametersMap[variableInfo.first].ConstantBufferMap[variableInfo.second.BufferName].data() + variableInfo.second.StartOffset);
 				*variable = parameter;
@@ -134,12 +137,13 @@ namespace Dash
 		return false;
 	}
 
-	bool FMaterial::SetVector3Parameter(const std::string& parameterName, const FVector3f& parameter)
+	bool FMaterial::SetVector3Parameter(FName parameterName, const FVector3f& parameter)
 	{
-		if (mVector3ParameterMap.contains(parameterName))
+		auto parameterIter = mVector3ParameterMap.find(parameterName);
+		if (parameterIter != mVector3ParameterMap.end())
 		{
-			mVector3ParameterMap[parameterName].Parameter = parameter;
-			for (auto& variableInfo : mVector3ParameterMap[parameterName].ConstantBufferVariableMap)
+			parameterIter->second.Parameter = parameter;
+			for (auto& variableInfo : parameterIter->second.ConstantBufferVariableMap)
 			{
 				FVector3f* variable = reinterpret_cast<FVector3f*>(mShaderPassParametersMap[variableInfo.first].ConstantBufferMap[variableInfo.second.BufferName].data() + variableInfo.second.StartOffset);
 				*variable = parameter;
@@ -151,12 +155,13 @@ namespace Dash
 		return false;
 	}
 
-	bool FMaterial::SetVector4Parameter(const std::string& parameterName, const FVector4f& parameter)
+	bool FMaterial::SetVector4Parameter(FName parameterName, const FVector4f& parameter)
 	{
-		if (mVector4ParameterMap.contains(parameterName))
+		auto parameterIter = mVector4ParameterMap.find(parameterName);
+		if (parameterIter != mVector4ParameterMap.end())
 		{
-			mVector4ParameterMap[parameterName].Parameter = parameter;
-			for (auto& variableInfo : mVector4ParameterMap[parameterName].ConstantBufferVariableMap)
+			parameterIter->second.Parameter = parameter;
+			for (auto& variableInfo : parameterIter->second.ConstantBufferVariableMap)
 			{
 				FVector4f* variable = reinterpret_cast<FVector4f*>(mShaderPassParametersMap[variableInfo.first].ConstantBufferMap[variableInfo.second.BufferName].data() + variableInfo.second.StartOffset);
 				*variable = parameter;
@@ -2,6 +2,8 @@
 #include "Graphics/ShaderTechnique.h"
 #include "Texture.h"
 #include "AssetDefines.h"
+#include "Utility/FlatHashMap.h"
+#include "Utility/Name.h"
 
 namespace Dash
 {
@@ -10,8 +12,8 @@ namespace Dash
 	public:
 		struct FShaderPassParameter
 		{
-			std::map<std::string, std::vector<uint8>> ConstantBufferMap;
-			std::map<std::string, FTextureRef> TextureBufferMap;
+			TFlatHashMap<FName, std::vector<uint8>> ConstantBufferMap;
+			TFlatHashMap<FName, FTextureRef> TextureBufferMap;
 			FShaderPassRef ShaderPass;
 		};
 
@@ -19,13 +21,13 @@ namespace Dash
 		FMaterial(const std::string& name, const FShaderTechniqueRef& shaderTechnique);
 		~FMaterial();
 
-		bool SetTextureParameter(const std::string& parameterName, const FTextureRef& texture);
-		bool SetFloatParameter(const std::string& parameterName, Scalar parameter);
-		bool SetVector2Parameter(const std::string& parameterName, const FVector2f& parameter);
-		bool SetVector3Parameter(const std::string& parameterName, const FVector3f& parameter);
-		bool SetVector4Parameter(const std::string& parameterName, const FVector4f& parameter);
+		bool SetTextureParameter(FName parameterName, const FTextureRef& texture);
+		bool SetFloatParameter(FName parameterName, Scalar parameter);
+		bool SetVector2Parameter(FName parameterName, const FVector2f& parameter);
+		bool SetVector3Parameter(FName parameterName, const FVector3f& parameter);
+		bool SetVector4Parameter(FName parameterName, const FVector4f& parameter);
 	
-		const std::map<std::string, FShaderPassParameter>& GetShaderPassParameters() const { return mShaderPassParametersMap; }
+		const std::map<FName, FShaderPassParameter>& GetShaderPassParameters() const { return mShaderPassParametersMap; }
 
 		FShaderTechniqueRef GetShaderTechnique() const { return mShaderTechnique; }
 
@@ -33,7 +35,7 @@ namespace Dash
 
 		struct FConstantBufferVariableInfo
 		{
-			std::string BufferName;
+			FName BufferName;
 			uint32 StartOffset;
 			uint32 Size;
 		};
@@ -41,13 +43,13 @@ namespace Dash
 		template<typename ParameterType>
 		struct FConstantBufferParameterInfo
 		{
-			std::map<std::string, FConstantBufferVariableInfo> ConstantBufferVariableMap;	// < PassName, VariableInfo >
+			TFlatHashMap<FName, FConstantBufferVariableInfo> ConstantBufferVariableMap;	// < PassName, VariableInfo >
 			ParameterType Parameter;
 		};
 
 		struct FTextureParameterInfo
 		{
-			std::vector<std::string> RelevantPasses;	// < PassName, VariableInfo >
+			std::vector<FName> RelevantPasses;
 			FTextureRef Parameter;
 		};
 
@@ -57,12 +59,13 @@ namespace Dash
 		std::string mName;
 		FShaderTechniqueRef mShaderTechnique;
 
-		std::map<std::string, FConstantBufferParameterInfo<Scalar>> mScalarParameterMap;
-		std::map<std::string, FConstantBufferParameterInfo<FVector2f>> mVector2ParameterMap;
-		std::map<std::string, FConstantBufferParameterInfo<FVector3f>> mVector3ParameterMap;
-		std::map<std::string, FConstantBufferParameterInfo<FVector4f>> mVector4ParameterMap;
-		std::map<std::string, FTextureParameterInfo> mTextureParameterMap;
+		TFlatHashMap<FName, FConstantBufferParameterInfo<Scalar>> mScalarParameterMap;
+		TFlatHashMap<FName, FConstantBufferParameterInfo<FVector2f>> mVector2ParameterMap;
+		TFlatHashMap<FName, FConstantBufferParameterInfo<FVector3f>> mVector3ParameterMap;
+		TFlatHashMap<FName, FConstantBufferParameterInfo<FVector4f>> mVector4ParameterMap;
+		TFlatHashMap<FName, FTextureParameterInfo> mTextureParameterMap;
 
-		std::map<std::string, FShaderPassParameter> mShaderPassParametersMap;
+		// Node based, mesh draw commands point into the values.
+		std::map<FName, FShaderPassParameter> mShaderPassParametersMap;
 	};
 }
\ No newline at end of file
@@ -5,7 +5,9 @@
 #include <cinttypes>
 #include <cstring>
 
+#if defined(_WIN32)
 #include "DashWinAPI.h"
+#endif
 
 //#include "../Utility/Assert.h"
 //#include "../Utility/LogManager.h"
@@ -60,6 +62,7 @@ void GetData(T& dest, void* src, std::size_t offset = 0)
 	std::memcpy(&dest, static_cast<uint8*>(src) + offset, sizeof(T));
 }
 
+#if defined(_WIN32)
 const DWORD MS_VC_EXCEPTION = 0x406D1388;
 
 // Set the name of a running thread (for debugging)
@@ -77,6 +80,7 @@ typedef struct tagTHREADNAME_INFO
 #if (_WIN32_WINNT >= _WIN32_WINNT_WIN10) || (defined(_XBOX_ONE) && defined(_TITLE)) || !defined(WINAPI_FAMILY) || (WINAPI_FAMILY == WINAPI_FAMILY_DESKTOP_APP)
 struct virtual_deleter { void operator()(void* p) noexcept { if (p) VirtualFree(p, 0, MEM_RELEASE); } };
 #endif
+#endif // _WIN32
 
 //struct aligned_deleter { void operator()(void* p) noexcept { _aligned_free(p); } };
 
@@ -4,6 +4,12 @@
 #include "Utility/Keyboard.h"
 #include "Utility/Mouse.h"
 #include "Utility/SystemTimer.h"
+#include "Utility/CpuFeatures.h"
+#include "Utility/JobSystem.h"
+#include "Utility/FrameArena.h"
+#include "Utility/CpuProfiler.h"
+#include "Utility/Stats.h"
+#include "Utility/FrameTimeStats.h"
 #include "Graphics/GraphicsCore.h"
 #include "Graphics/CommandContext.h"
 #include "Asset/AssetManager.h"
@@ -62,6 +68,17 @@ namespace Dash
 
 		FLogManager::Get()->Init();
 
+		const FCpuFeatures& cpuFeatures = FCpuFeatures::Get();
+		DASH_LOG(LogTemp, Info, "CPU : {} {}, SIMD dispatch level : {}, features : {}", cpuFeatures.GetVendor(), cpuFeatures.GetBrand(), FCpuFeatures::GetIsaName(cpuFeatures.GetIsa()), cpuFeatures.ToString());
+		if (!cpuFeatures.SupportsBuildBaseline())
+		{
+			DASH_LOG(LogTemp, Error, "This build requires instruction sets the CPU does not support.");
+		}
+
+		FCpuProfiler::Get().SetThreadName("Main Thread");
+		FJobSystem::Get().SetProfilingHooks(FCpuProfiler::GetJobProfilingHooks());
+		FJobSystem::Get().Init();
+
 		FMouse::Get().Initialize(app->GetWindowHandle());
 
 		FGraphicsCore::Initialize(app->GetWindowWidth(), app->GetWindowHeight());
@@ -83,6 +100,8 @@ namespace Dash
 
 		app->Cleanup();
 
+		FJobSystem::Get().Shutdown();
+
 		FGraphicsCore::Shutdown();
 		
 		FLogManager::Get()->Shutdown();
@@ -98,6 +117,11 @@ namespace Dash
 
 	void UpdateApplication(IGameApp* app, size_t& frameCount, FCpuTimer& timer)
 	{
+		// The first frame, and the first after the window was minimized or paused, pays for startup and resizing.
+		static bool skipFrameTimes = true;
+
+		const FHighResolutionClock::time_point frameStart = FHighResolutionClock::now();
+
 		timer.Tick();
 		float deltaTime = timer.GetDeltaTime();
 		float totalTime = timer.GetTotalTime();
@@ -105,17 +129,36 @@ namespace Dash
 		FUpdateEventArgs updateArgs{ deltaTime, totalTime, frameCount};
 		FRenderEventArgs RenderArgs{ deltaTime, totalTime, frameCount };
 
+		FFrameArena::Get().BeginFrame();
+		FCpuProfiler::Get().BeginFrame();
+		FStats::Get().BeginFrame();
+
 		if (!Minimized)
 		{
 			app->OnBeginFrame();
 
+			const FHighResolutionClock::time_point updateStart = FHighResolutionClock::now();
 			app->OnUpdate(updateArgs);
 
+			const FHighResolutionClock::time_point renderStart = FHighResolutionClock::now();
 			app->OnRender(RenderArgs);
 
+			const FHighResolutionClock::time_point renderEnd = FHighResolutionClock::now();
 			app->OnEndFrame();
+
+			// Present included.
+			const FHighResolutionClock::time_point frameEnd = FHighResolutionClock::now();
+
+			if (!skipFrameTimes && !AppPaused)
+			{
+				using FMilliseconds = std::chrono::duration<double, std::milli>;
+				FFrameTimeStats::Get().AddFrame(frameCount, FMilliseconds(frameEnd - frameStart).count(),
+					FMilliseconds(renderStart - updateStart).count(), FMilliseconds(renderEnd - renderStart).count());
+			}
 		}
 
+		skipFrameTimes = Minimized || AppPaused;
+
 		++frameCount;
 	}
 
@@ -193,7 +193,7 @@ namespace Dash
 		}
 	}
 
-	const FTransform& TActor::GetActorRelativeTransform() const
+	FTransform TActor::GetActorRelativeTransform() const
 	{
 		if (mRootComponent)
 		{
@@ -13,8 +13,8 @@ namespace Dash
 		template<typename Type>
 		Type* AddComponent(const std::string& name)
 		{
-			std::unique_ptr<Type> newComponent = std::make_unique<Type>(name, this);
-			Type* result = newComponent.get();
+			FComponentPtr newComponent = CreatePooledComponent<Type>(name, this);
+			Type* result = static_cast<Type*>(newComponent.get());
 			mComponents.emplace_back(std::move(newComponent));
 
 			if (mRootComponent == nullptr)
@@ -70,7 +70,7 @@ namespace Dash
 		FVector3f GetActorRelativeScale() const;
 
 		void SetActorRelativeTransform(const FTransform& relativeTransform);
-		const FTransform& GetActorRelativeTransform() const;
+		FTransform GetActorRelativeTransform() const;
 
 		void AttachToActor(TActor* parent, const FTransform& relativeTransform = FIdentity{});
 		TActor* GetAttachParentActor() const;
@@ -78,7 +78,7 @@ namespace Dash
 	private:
 		std::string mName;
 
-		std::vector<std::unique_ptr<TComponent>> mComponents;
+		std::vector<FComponentPtr> mComponents;
 		TComponent* mRootComponent = nullptr;
 	};
 }
\ No newline at end of file
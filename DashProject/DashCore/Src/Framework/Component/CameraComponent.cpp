@@ -45,6 +45,11 @@ namespace Dash
 		return mViewProjectionMatrix;
 	}
 
+	FFrustum TCameraComponent::GetFrustum() const
+	{
+		return FFrustum{ GetViewProjectionMatrix() };
+	}
+
 	FVector3f TCameraComponent::GetForward() const
 	{
 		return mComponentToWorld.GetUnitForwardAxis();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Graphics/Viewport.h"
+#include "Math/Frustum.h"
 #include "Component.h"
 
 namespace Dash
@@ -22,6 +23,8 @@ namespace Dash
 		FMatrix4x4 GetProjectionMatrix() const;
 		FMatrix4x4 GetViewProjectionMatrix() const;
 
+		FFrustum GetFrustum() const;
+
 		FVector3f GetForward() const;
 		FVector3f GetRight() const;
 		FVector3f GetUp() const;
@@ -63,42 +63,42 @@ namespace Dash
 
 	void TComponent::SetRelativePosition(const FVector3f& p)
 	{
-		mRelativeTransform.SetPosition(p);
+		mRelativeTransform.Position = p;
 	}
 
 	void TComponent::SetRelativeRotation(const FQuaternion& q)
 	{
-		mRelativeTransform.SetRotation(q);
+		mRelativeTransform.Rotation = q;
 	}
 
 	void TComponent::SetRelativeScale(const FVector3f& s)
 	{
-		mRelativeTransform.SetScale(s);
+		mRelativeTransform.Scale = s;
 	}
 
 	FVector3f TComponent::GetRelativePosition() const
 	{
-		return mRelativeTransform.GetPosition();
+		return mRelativeTransform.Position;
 	}
 
 	FQuaternion TComponent::GetRelativeRotation() const
 	{
-		return mRelativeTransform.GetRotation();
+		return mRelativeTransform.Rotation;
 	}
 
 	FVector3f TComponent::GetRelativeScale() const
 	{
-		return mRelativeTransform.GetScale();
+		return mRelativeTransform.Scale;
 	}
 
 	void TComponent::SetRelativeTransform(const FTransform& transform)
 	{
-		mRelativeTransform = transform;
+		mRelativeTransform = FTransformTRS{ transform };
 	}
 
-	const FTransform& TComponent::GetRelativeTransform() const
+	FTransform TComponent::GetRelativeTransform() const
 	{
-		return mRelativeTransform;
+		return mRelativeTransform.ToTransform();
 	}
 
 	void TComponent::AttachToComponent(TComponent* parent, const FTransform& relativeTransform)
@@ -106,7 +106,7 @@ namespace Dash
 		if (parent)
 		{
 			mAttachParent = parent;
-			mRelativeTransform = relativeTransform;
+			mRelativeTransform = FTransformTRS{ relativeTransform };
 		}
 	}
 
@@ -122,7 +122,9 @@ namespace Dash
 	{
 		if (parent)
 		{
-			mComponentToWorld = mRelativeTransform * parent->GetWorldTransform();
+			const FAffineMatrix3x4 parentToWorld{ parent->GetWorldTransform().GetMatrix() };
+			const FAffineMatrix3x4 componentToWorld = FMath::Mul(FMath::ToAffineMatrix(mRelativeTransform), parentToWorld);
+			mComponentToWorld = FTransform{ componentToWorld.ToMatrix4x4(), FMath::Inverse(componentToWorld).ToMatrix4x4() };
 
 			UpdateChildTransforms();
 		}
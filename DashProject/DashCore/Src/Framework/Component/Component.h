@@ -1,5 +1,8 @@
 #pragma once
 
+#include "Math/TransformTRS.h"
+#include "Utility/ObjectPool.h"
+
 namespace Dash
 {
 	class TActor;
@@ -32,7 +35,7 @@ namespace Dash
 		FVector3f GetRelativeScale() const;
 
 		void SetRelativeTransform(const FTransform& transform);
-		const FTransform& GetRelativeTransform() const;
+		FTransform GetRelativeTransform() const;
 
 		void AttachToComponent(TComponent* parent, const FTransform& relativeTransform = FIdentity{});
 
@@ -49,10 +52,51 @@ namespace Dash
 		std::string mName;
 
 		FTransform mComponentToWorld;
-		FTransform mRelativeTransform;
+		FTransformTRS mRelativeTransform;
 
 		TComponent* mAttachParent;
 		TActor* mOwner;
 		std::vector<TComponent*> mAttachChildren;
 	};
+
+	// Components are allocated from one pool per concrete type, so components of the same type sit next to each other.
+	template<typename Type>
+	TObjectPool<Type>& GetComponentPool()
+	{
+		static TObjectPool<Type> pool;
+		return pool;
+	}
+
+	// Returns a component to the pool of the type it was created with, through the handle Create returned.
+	struct FComponentDeleter
+	{
+		void (*DestroyFunc)(uint32 index, uint32 generation) = nullptr;
+		uint32 Index = UINT32_MAX;
+		uint32 Generation = 0;
+
+		void operator()(TComponent* component) const { DestroyFunc(Index, Generation); }
+	};
+
+	using FComponentPtr = std::unique_ptr<TComponent, FComponentDeleter>;
+
+	template<typename Type, typename... ArgTypes>
+	FComponentPtr CreatePooledComponent(ArgTypes&&... args)
+	{
+		TObjectPool<Type>& pool = GetComponentPool<Type>();
+		const TObjectHandle<Type> handle = pool.Create(std::forward<ArgTypes>(args)...);
+
+		return FComponentPtr(pool.Get(handle), FComponentDeleter{ [](uint32 index, uint32 generation)
+		{
+			GetComponentPool<Type>().Destroy(TObjectHandle<Type>{ index, generation });
+		}, handle.Index, handle.Generation });
+	}
+
+	/**
+	 * Call func(Type&) for every live component of exactly this type, in memory order.
+	 */
+	template<typename Type, typename FuncType>
+	void ForEachComponent(FuncType&& func)
+	{
+		GetComponentPool<Type>().ForEach(std::forward<FuncType>(func));
+	}
 }
\ No newline at end of file
@@ -105,7 +105,7 @@ namespace Dash
 				continue;
 			}
 
-			const std::map<std::string, FMaterial::FShaderPassParameter>& shaderPassParameters = material->GetShaderPassParameters();
+			const std::map<FName, FMaterial::FShaderPassParameter>& shaderPassParameters = material->GetShaderPassParameters();
 			FShaderTechniqueRef shaderTechnique = material->GetShaderTechnique();
 
 			if (shaderTechnique == nullptr)
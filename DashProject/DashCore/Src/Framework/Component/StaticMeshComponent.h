@@ -11,8 +11,8 @@ namespace Dash
 		std::vector<FGpuVertexBufferRef> VertexBuffers;
 		FGpuIndexBufferRef IndexBuffer;
 
-		const std::map<std::string, std::vector<uint8>>* ConstantBufferMapPtr;
-		const std::map<std::string, FTextureRef>* TextureBufferMapPtr;
+		const TFlatHashMap<FName, std::vector<uint8>>* ConstantBufferMapPtr;
+		const TFlatHashMap<FName, FTextureRef>* TextureBufferMapPtr;
 
 		FGraphicsPSO* PSO;
 
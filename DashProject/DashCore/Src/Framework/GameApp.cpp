@@ -5,6 +5,7 @@
 #include "Graphics/SwapChain.h"
 
 #include "Utility/Keyboard.h"
+#include "Utility/CpuProfiler.h"
 #include "imgui/imgui.h"
 #include "imgui/backends/imgui_impl_win32.h"
 #include "imgui/backends/imgui_impl_dx12.h"
@@ -123,6 +124,8 @@ namespace Dash
 
 	void IGameApp::OnUpdate(const FUpdateEventArgs& e)
 	{
+		DASH_CPU_SCOPE("IGameApp::OnUpdate");
+
 		FGraphicsCore::Profiler->NewFrame();
 
 		for (uint32 i = 0; i < mRenderLayers.size(); i++)
@@ -133,6 +136,8 @@ namespace Dash
 
 	void IGameApp::OnRender(const FRenderEventArgs& e)
 	{
+		DASH_CPU_SCOPE("IGameApp::OnRender");
+
 		for (uint32 i = 0; i < mRenderLayers.size(); i++)
 		{
 			mRenderLayers[i]->OnRender(e);
@@ -6,6 +6,7 @@
 #include "Graphics/PipelineStateObject.h"
 #include "Graphics/SwapChain.h"
 #include "Utility/FileUtility.h"
+#include "Utility/FrameArena.h"
 #include "Utility/Keyboard.h"
 #include "Utility/Mouse.h"
 #include "MeshLoader/StaticMeshLoader.h"
@@ -191,7 +192,9 @@ namespace Dash
 
 					graphicsContext.SetShaderResourceView("InstanceData", mInstanceBuffer);
 
-					std::vector<FGpuVertexBufferRef> RealVertexBuffer = drawCommand.VertexBuffers;
+					TFrameVector<FGpuVertexBufferRef> RealVertexBuffer;
+					RealVertexBuffer.reserve(drawCommand.VertexBuffers.size() + 1);
+					RealVertexBuffer.assign(drawCommand.VertexBuffers.begin(), drawCommand.VertexBuffers.end());
 					RealVertexBuffer.push_back(mMatrixInstanceBuffer);
 					//RealVertexBuffer.push_back(mColorInstanceBuffer);
 
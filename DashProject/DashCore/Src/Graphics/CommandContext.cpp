@@ -3,10 +3,16 @@
 #include "GraphicsCore.h"
 #include "RootSignature.h"
 #include "SubResourceData.h"
+#include "Utility/FrameArena.h"
+#include "Utility/Stats.h"
 #include "pix3.h"
 
 namespace Dash
 {
+	static FStatCounter GStatDrawCalls("Graphics/DrawCalls");
+	static FStatCounter GStatDispatches("Graphics/Dispatches");
+	static FStatCounter GStatPipelineStateChanges("Graphics/PipelineStateChanges");
+
 	FCommandContext* FCommandContextManager::AllocateContext(D3D12_COMMAND_LIST_TYPE type)
 	{
 		ASSERT(type < D3D12_COMMAND_LIST_TYPE_VIDEO_DECODE && type >= 0);
@@ -250,7 +256,8 @@ namespace Dash
 		UINT64 requiredSize = GetRequiredIntermediateSize(dest->GetResource()->GetResource(), firstSubresource, numSubresources);
 		FGpuLinearAllocator::FAllocation alloc = context.mLinearAllocator.Allocate(requiredSize);
 
-		std::vector<D3D12_SUBRESOURCE_DATA> d3dSubResources;
+		TFrameVector<D3D12_SUBRESOURCE_DATA> d3dSubResources;
+		d3dSubResources.reserve(numSubresources);
 		for (size_t i = 0; i < numSubresources; i++)
 		{
 			d3dSubResources.emplace_back(subresourceData[i].D3DSubResource());
@@ -306,6 +313,7 @@ namespace Dash
 		SetComputeRootSignature(pso->GetRootSignature());
 		mD3DCommandList->SetPipelineState(pipelineState);
 		mCurrentPipelineState = pipelineState;
+		GStatPipelineStateChanges.Increment();
 
 		SetPipelineStateInternal(pso);
 	}
@@ -538,6 +546,7 @@ namespace Dash
 		mDynamicSamplerDescriptor.CommitStagedDescriptorsForDispatch(*this);
 
 		mD3DCommandList->Dispatch(groupCountX, groupCountY, groupCountZ);
+		GStatDispatches.Increment();
 	}
 
 	void FComputeCommandContextBase::SetRootConstantBufferView(UINT rootIndex, size_t sizeInBytes, const void* constants)
@@ -547,7 +556,7 @@ namespace Dash
 		mDynamicViewDescriptor.StageInlineCBV(rootIndex, alloc.GpuAddress);
 	}
 
-	void FComputeCommandContextBase::SetRootConstantBufferView(const std::string& bufferName, size_t sizeInBytes, const void* constants)
+	void FComputeCommandContextBase::SetRootConstantBufferView(FName bufferName, size_t sizeInBytes, const void* constants)
 	{
 		ASSERT_MSG(mPSO != nullptr, "Pipeline State Is Not Set.");
 
@@ -578,33 +587,33 @@ namespace Dash
 		}
 	}
 
-	void FComputeCommandContextBase::SetShaderResourceView(const std::string& srvrName, const FColorBufferRef& buffer, EResourceState stateAfter, uint32 firstSubResource, uint32 numSubResources)
+	void FComputeCommandContextBase::SetShaderResourceView(FName srvrName, const FColorBufferRef& buffer, EResourceState stateAfter, uint32 firstSubResource, uint32 numSubResources)
 	{
 		ASSERT_MSG(mPSO != nullptr, "Pipeline State Is Not Set.");
 
 		SetShaderResourceView(srvrName, buffer, buffer->GetShaderResourceView(), stateAfter, firstSubResource, numSubResources);
 	}
 
-	void FComputeCommandContextBase::SetShaderResourceView(const std::string& srvrName, const FTextureBufferRef& buffer, EResourceState stateAfter, uint32 firstSubResource, uint32 numSubResources)
+	void FComputeCommandContextBase::SetShaderResourceView(FName srvrName, const FTextureBufferRef& buffer, EResourceState stateAfter, uint32 firstSubResource, uint32 numSubResources)
 	{
 		ASSERT_MSG(mPSO != nullptr, "Pipeline State Is Not Set.");
 
 		SetShaderResourceView(srvrName, buffer, buffer->GetShaderResourceView(), stateAfter, firstSubResource, numSubResources);
 	}
 
-	void FComputeCommandContextBase::SetShaderResourceView(const std::string& srvrName, const FStructuredBufferRef& buffer, EResourceState stateAfter, uint32 firstSubResource, uint32 numSubResources)
+	void FComputeCommandContextBase::SetShaderResourceView(FName srvrName, const FStructuredBufferRef& buffer, EResourceState stateAfter, uint32 firstSubResource, uint32 numSubResources)
 	{
 		ASSERT_MSG(mPSO != nullptr, "Pipeline State Is Not Set.");
 
 		SetShaderResourceView(srvrName, buffer, buffer->GetShaderResourceView(), stateAfter, firstSubResource, numSubResources);
 	}
 
-	void FComputeCommandContextBase::SetUnorderAccessView(const std::string& uavName, const FColorBufferRef& buffer, EResourceState stateAfter, uint32 firstSubResource, uint32 numSubResources)
+	void FComputeCommandContextBase::SetUnorderAccessView(FName uavName, const FColorBufferRef& buffer, EResourceState stateAfter, uint32 firstSubResource, uint32 numSubResources)
 	{
 		SetUnorderAccessView(uavName, buffer, buffer->GetUnorderedAccessView(), stateAfter, firstSubResource, numSubResources);
 	}
 
-	void FComputeCommandContextBase::SetShaderResourceView(const std::string& srvrName, const FGpuResourceRef& resource, const D3D12_CPU_DESCRIPTOR_HANDLE& srcDescriptors,
+	void FComputeCommandContextBase::SetShaderResourceView(FName srvrName, const FGpuResourceRef& resource, const D3D12_CPU_DESCRIPTOR_HANDLE& srcDescriptors,
 		EResourceState stateAfter /*= EResourceState::AnyShaderAccess*/, uint32 firstSubResource /*= 0*/,
 		uint32 numSubResources /*= D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES*/)
 	{
@@ -649,7 +658,7 @@ namespace Dash
 		}
 	}
 
-	void FComputeCommandContextBase::SetUnorderAccessView(const std::string& srvrName, const FGpuResourceRef& resource, const D3D12_CPU_DESCRIPTOR_HANDLE& uavDescriptors,
+	void FComputeCommandContextBase::SetUnorderAccessView(FName srvrName, const FGpuResourceRef& resource, const D3D12_CPU_DESCRIPTOR_HANDLE& uavDescriptors,
 		EResourceState stateAfter /*= EResourceState::UnorderedAccess*/, uint32 firstSubResource /*= 0*/, uint32 numSubResources /*= D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES*/)
 	{
 		FShaderPassRef shaderPass = mPSO->GetShaderPass();
@@ -748,6 +757,7 @@ namespace Dash
 		mD3DCommandList->SetPipelineState(pipelineState);
 		SetPrimitiveTopology(pso->GetPrimitiveTopology());
 		mCurrentPipelineState = pipelineState;
+		GStatPipelineStateChanges.Increment();
 
 		SetPipelineStateInternal(pso);
 	}
@@ -957,6 +967,7 @@ namespace Dash
 		mDynamicViewDescriptor.CommitStagedDescriptorsForDraw(*this);
 		mDynamicSamplerDescriptor.CommitStagedDescriptorsForDraw(*this);
 		mD3DCommandList->DrawInstanced(vertexCountPerInstance, instanceCount, startVertexLocation, startInstanceLocation);
+		GStatDrawCalls.Increment();
 	}
 
 	void FGraphicsCommandContext::DrawIndexedInstanced(uint32 indexCountPerInstance, uint32 instanceCount, uint32 startIndexLocation, int32 baseVertexLocation, uint32 startInstanceLocation)
@@ -967,5 +978,6 @@ namespace Dash
 		mDynamicViewDescriptor.CommitStagedDescriptorsForDraw(*this);
 		mDynamicSamplerDescriptor.CommitStagedDescriptorsForDraw(*this);
 		mD3DCommandList->DrawIndexedInstanced(indexCountPerInstance, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation);
+		GStatDrawCalls.Increment();
 	}
 }
\ No newline at end of file
@@ -151,19 +151,19 @@ namespace Dash
 		void SetComputePipelineState(FComputePSO* pso);
 		
 		//Set Root Parameters
-		void SetRootConstantBufferView(const std::string& bufferName, size_t sizeInBytes, const void* constants);
+		void SetRootConstantBufferView(FName bufferName, size_t sizeInBytes, const void* constants);
 		template<typename T>
-		void SetRootConstantBufferView(const std::string& bufferName, const T& constants)
+		void SetRootConstantBufferView(FName bufferName, const T& constants)
 		{
 			SetRootConstantBufferView(bufferName, sizeof(T), &constants);
 		}
 
 		// Set descriptor table parameters
-		void SetShaderResourceView(const std::string& srvrName, const FColorBufferRef& buffer, EResourceState stateAfter = EResourceState::AnyShaderAccess, uint32 firstSubResource = 0, uint32 numSubResources = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES);
-		void SetShaderResourceView(const std::string& srvrName, const FTextureBufferRef& buffer, EResourceState stateAfter = EResourceState::AnyShaderAccess, uint32 firstSubResource = 0, uint32 numSubResources = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES);
-		void SetShaderResourceView(const std::string& srvrName, const FStructuredBufferRef& buffer, EResourceState stateAfter = EResourceState::AnyShaderAccess, uint32 firstSubResource = 0, uint32 numSubResources = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES);
+		void SetShaderResourceView(FName srvrName, const FColorBufferRef& buffer, EResourceState stateAfter = EResourceState::AnyShaderAccess, uint32 firstSubResource = 0, uint32 numSubResources = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES);
+		void SetShaderResourceView(FName srvrName, const FTextureBufferRef& buffer, EResourceState stateAfter = EResourceState::AnyShaderAccess, uint32 firstSubResource = 0, uint32 numSubResources = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES);
+		void SetShaderResourceView(FName srvrName, const FStructuredBufferRef& buffer, EResourceState stateAfter = EResourceState::AnyShaderAccess, uint32 firstSubResource = 0, uint32 numSubResources = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES);
 
-		void SetUnorderAccessView(const std::string& uavName, const FColorBufferRef& buffer, EResourceState stateAfter = EResourceState::UnorderedAccess, uint32 firstSubResource = 0, uint32 numSubResources = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES);
+		void SetUnorderAccessView(FName uavName, const FColorBufferRef& buffer, EResourceState stateAfter = EResourceState::UnorderedAccess, uint32 firstSubResource = 0, uint32 numSubResources = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES);
 
 		void ClearUAV(const FGpuBufferRef& target);
 		void ClearUAV(const FColorBufferRef& target);
@@ -176,11 +176,11 @@ namespace Dash
 
 		void SetRootConstantBufferView(UINT rootIndex, size_t sizeInBytes, const void* constants);
 
-		void SetShaderResourceView(const std::string& srvrName, const FGpuResourceRef& resource, const D3D12_CPU_DESCRIPTOR_HANDLE& srcDescriptors,
+		void SetShaderResourceView(FName srvrName, const FGpuResourceRef& resource, const D3D12_CPU_DESCRIPTOR_HANDLE& srcDescriptors,
 			EResourceState stateAfter = EResourceState::AnyShaderAccess, UINT firstSubResource = 0,
 			uint32 numSubResources = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES);
 
-		void SetUnorderAccessView(const std::string& srvrName, const FGpuResourceRef& resource, const D3D12_CPU_DESCRIPTOR_HANDLE& uavDescriptors,
+		void SetUnorderAccessView(FName srvrName, const FGpuResourceRef& resource, const D3D12_CPU_DESCRIPTOR_HANDLE& uavDescriptors,
 			EResourceState stateAfter = EResourceState::UnorderedAccess, UINT firstSubResource = 0,
 			uint32 numSubResources = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES);
 	};
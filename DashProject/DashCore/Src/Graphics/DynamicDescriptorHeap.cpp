@@ -5,9 +5,13 @@
 #include "DX12Helper.h"
 #include "CommandContext.h"
 #include "RenderDevice.h"
+#include "Utility/Stats.h"
 
 namespace Dash
 {
+	static FStatCounter GStatDescriptorsCopied("Graphics/DescriptorsCopied");
+	static FStatCounter GStatDescriptorHeapsRequested("Graphics/DescriptorHeapsRequested");
+
 	FDynamicDescriptorHeap::FDynamicDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE type, uint32 numDescriptorsPerHeap)
 		: mDescriptorHeapType(type)
 		, mNumDescriptorsPerHeap(numDescriptorsPerHeap)
@@ -147,6 +151,7 @@ namespace Dash
 
 		D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle = mCurrentGpuDescriptorHandle;
 		FGraphicsCore::Device->CopyDescriptorsSimple(1, mCurrentCpuDescriptorHandle, srcDescriptor, mDescriptorHeapType);
+		GStatDescriptorsCopied.Increment();
 
 		mCurrentCpuDescriptorHandle.Offset(1, mDescriptorHandleIncrementSize);
 		mCurrentGpuDescriptorHandle.Offset(1, mDescriptorHandleIncrementSize);
@@ -186,6 +191,8 @@ namespace Dash
 
 	ID3D12DescriptorHeap* FDynamicDescriptorHeap::RequestDescriptorHeap()
 	{
+		GStatDescriptorHeapsRequested.Increment();
+
 		ID3D12DescriptorHeap* descriptorHeap = nullptr;
 
 		if (!mAvailableDescriptorHeaps.empty())
@@ -265,6 +272,7 @@ namespace Dash
 				ASSERT_MSG(srcDescriptorHandlePtr[0].ptr != SIZE_T(-1), "Src descriptor has not been staged.");
 
 				FGraphicsCore::Device->CopyDescriptors(1, destDescriptorHandles, destDescriptorRanges, srcNumDescriptors, srcDescriptorHandlePtr, nullptr, mDescriptorHeapType);
+				GStatDescriptorsCopied.Add(srcNumDescriptors);
 
 				setFunc(context.GetD3DCommandList(), rootParameterIndex, mCurrentGpuDescriptorHandle);
 
@@ -5,6 +5,7 @@
 #include "RenderDevice.h"
 #include "ReadbackBuffer.h"
 #include "SwapChain.h"
+#include "Utility/FlatHashMap.h"
 
 namespace Dash
 {
@@ -17,7 +18,7 @@ namespace Dash
 	};
 
 	std::array<FProfileData, MaxProfiles> ProfileData;
-	std::map<std::string, uint32> NameToProfileIndex;
+	TFlatHashMap<std::string, uint32> NameToProfileIndex;
 
 	FGPUProfiler::FGPUProfiler()
 	{
@@ -64,7 +65,7 @@ namespace Dash
 		int32 profileIndex = mProfileCounter++;
 		ASSERT(profileIndex < MaxProfiles);
 
-		NameToProfileIndex[name] = profileIndex;
+		NameToProfileIndex.emplace(name, profileIndex);
 		ProfileData[profileIndex].Started = true;
 		ASSERT(ProfileData[profileIndex].Finished == false);
 
@@ -76,9 +77,10 @@ namespace Dash
 
 	void FGPUProfiler::EndProfile(FCopyCommandContextBase& contex, const std::string& name)
 	{
-		ASSERT(NameToProfileIndex.contains(name));
+		auto profileIter = NameToProfileIndex.find(name);
+		ASSERT(profileIter != NameToProfileIndex.end());
 
-		int32 profileIndex = NameToProfileIndex[name];
+		int32 profileIndex = profileIter->second;
 		ASSERT(profileIndex < MaxProfiles);
 
 		ProfileData[profileIndex].Finished = true;
@@ -121,6 +123,9 @@ namespace Dash
 			}
 		}
 
+		// The map is unordered, keep the display sorted by name.
+		std::sort(results.begin(), results.end(), [](const FProfileResult& a, const FProfileResult& b) { return a.Name < b.Name; });
+
 		return results;
 	}
 
@@ -5,9 +5,14 @@
 #include "DX12Helper.h"
 #include "GpuResourcesStateTracker.h"
 #include "RenderDevice.h"
+#include "Utility/Stats.h"
 
 namespace Dash
 {
+	static FStatCounter GStatLinearAllocatorPagesRequested("Graphics/LinearAllocatorPagesRequested");
+	static FStatCounter GStatLinearAllocatorPagesCreated("Graphics/LinearAllocatorPagesCreated");
+	static FStatGauge GStatLinearAllocatorPooledPages("Graphics/LinearAllocatorPooledPages");
+
 	FGpuLinearAllocator::AllocatorType FGpuLinearAllocator::FPageManager::AutoAllocatorType = GpuExclusive;
 	FGpuLinearAllocator::FPageManager FGpuLinearAllocator::AllocatorPageManger[2];
 	 
@@ -58,6 +63,8 @@ namespace Dash
 	{
 		std::lock_guard<std::mutex> lock(mMutex);
 
+		GStatLinearAllocatorPagesRequested.Increment();
+
 		while (!mRetiredPages.empty() && FGraphicsCore::CommandQueueManager->IsFenceCompleted(mRetiredPages.front().first))
 		{
 			mRetiredPages.front().second->Reset();
@@ -76,6 +83,7 @@ namespace Dash
 		{
 			newPage = CreateNewPage();
 			mPagePool.emplace_back(newPage);
+			GStatLinearAllocatorPooledPages.Add(1);
 		}
 
 		return newPage;
@@ -85,6 +93,8 @@ namespace Dash
 	{
 		std::lock_guard<std::mutex> lock(mMutex);
 
+		GStatLinearAllocatorPagesRequested.Increment();
+
 		while (!mRetiredLargePages.empty() && FGraphicsCore::CommandQueueManager->IsFenceCompleted(mRetiredLargePages.front().first))
 		{
 			FPage* pageToFree = mRetiredLargePages.front().second;
@@ -150,6 +160,8 @@ namespace Dash
 
 		buffer->SetName("CpuLinearAllocatorPage");
 
+		GStatLinearAllocatorPagesCreated.Increment();
+
 		return new FPage(buffer, resourceState, resourceDesc.Width);
 	}
 
@@ -177,6 +189,7 @@ namespace Dash
 	{
 		std::lock_guard<std::mutex> lock(mMutex);
 
+		GStatLinearAllocatorPooledPages.Subtract(static_cast<int64>(mPagePool.size()));
 		mPagePool.clear();
 		mLargePagePool.clear();
 	}
@@ -1,9 +1,15 @@
 #include "PCH.h"
 #include "GpuResourcesStateTracker.h"
 #include "GraphicsCore.h"
+#include "Utility/Stats.h"
 
 namespace Dash
 {
+	static FStatCounter GStatResourceBarriersFlushed("Graphics/ResourceBarriersFlushed");
+
+	// Barriers the command list's queue cannot execute, flushed on another queue that the command list then waits for.
+	static FStatCounter GStatCrossQueueBarrierFlushes("Graphics/CrossQueueBarrierFlushes");
+
 	FGpuResourcesStateTracker::ResourceStateMap FGpuResourcesStateTracker::GlobalResourceStates = {};
 	std::mutex FGpuResourcesStateTracker::GlobalMutex;
 	bool FGpuResourcesStateTracker::IsLocked = false;
@@ -197,6 +203,7 @@ namespace Dash
 				ASSERT(flushBarrierCommandAux != nullptr);
 
 				flushBarrierCommandAux->GetCommandList()->ResourceBarrier(num, resourceBarriers.data());
+				GStatCrossQueueBarrierFlushes.Increment();
 
 				uint64 fenceValue = FGraphicsCore::CommandQueueManager->GetQueue(flushBarriersCommandListType).ExecuteCommandList(flushBarrierCommandAux);
 
@@ -212,6 +219,8 @@ namespace Dash
 
 				flushBarrierCommand->GetCommandList()->ResourceBarrier(num, resourceBarriers.data());
 			}
+
+			GStatResourceBarriersFlushed.Add(num);
 		}
 
 		mPendingResourceBarriers.clear();
@@ -233,6 +242,7 @@ namespace Dash
 				FCommandList* flushBarrierCommand = FGraphicsCore::CommandListManager->RequestCommandList(flushBarriersCommandListType);
 
 				flushBarrierCommand->GetCommandList()->ResourceBarrier(num, mResourceBarriers.data());
+				GStatCrossQueueBarrierFlushes.Increment();
 
 				uint64 fenceValue = FGraphicsCore::CommandQueueManager->GetQueue(flushBarriersCommandListType).ExecuteCommandList(flushBarrierCommand);
 
@@ -244,6 +254,8 @@ namespace Dash
 			{
 				commandList->GetCommandList()->ResourceBarrier(num, mResourceBarriers.data());
 			}
+
+			GStatResourceBarriersFlushed.Add(num);
             
 			mResourceBarriers.clear();
 		}
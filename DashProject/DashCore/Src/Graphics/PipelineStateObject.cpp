@@ -8,6 +8,100 @@
 
 namespace Dash
 {
+	static void WriteShaderBytecode(FCacheKeyWriter& writer, const D3D12_SHADER_BYTECODE& shader)
+	{
+		// The bytecode belongs to a shader resource that the cached PSO keeps alive through its shader pass,
+		// so the pointer identifies the shader for as long as the cache entry exists.
+		writer.Write(shader.pShaderBytecode);
+		writer.Write(shader.BytecodeLength);
+	}
+
+	// Writes the stream field by field, the subobjects and some of the D3D descs contain padding bytes
+	// that are not initialized. The input layout is written by value since the stream only points at
+	// the element array of the initializer.
+	static void WritePipelineStateStream(FCacheKeyWriter& writer, const CD3DX12_PIPELINE_STATE_STREAM2& stream)
+	{
+		writer.Write<D3D12_PIPELINE_STATE_FLAGS>(stream.Flags);
+		writer.Write<UINT>(stream.NodeMask);
+		writer.Write<ID3D12RootSignature*>(stream.pRootSignature);
+
+		const D3D12_INPUT_LAYOUT_DESC& inputLayout = stream.InputLayout;
+		writer.Write(inputLayout.NumElements);
+		for (uint32 i = 0; i < inputLayout.NumElements; ++i)
+		{
+			const D3D12_INPUT_ELEMENT_DESC& element = inputLayout.pInputElementDescs[i];
+			writer.WriteString(element.SemanticName);
+			writer.Write(element.SemanticIndex);
+			writer.Write(element.Format);
+			writer.Write(element.InputSlot);
+			writer.Write(element.AlignedByteOffset);
+			writer.Write(element.InputSlotClass);
+			writer.Write(element.InstanceDataStepRate);
+		}
+
+		writer.Write<D3D12_INDEX_BUFFER_STRIP_CUT_VALUE>(stream.IBStripCutValue);
+		writer.Write<D3D12_PRIMITIVE_TOPOLOGY_TYPE>(stream.PrimitiveTopologyType);
+
+		WriteShaderBytecode(writer, stream.VS);
+		WriteShaderBytecode(writer, stream.GS);
+		WriteShaderBytecode(writer, stream.HS);
+		WriteShaderBytecode(writer, stream.DS);
+		WriteShaderBytecode(writer, stream.PS);
+		WriteShaderBytecode(writer, stream.AS);
+		WriteShaderBytecode(writer, stream.MS);
+		WriteShaderBytecode(writer, stream.CS);
+
+		const D3D12_STREAM_OUTPUT_DESC& streamOutput = stream.StreamOutput;
+		writer.Write(streamOutput.pSODeclaration);
+		writer.Write(streamOutput.NumEntries);
+		writer.Write(streamOutput.pBufferStrides);
+		writer.Write(streamOutput.NumStrides);
+		writer.Write(streamOutput.RasterizedStream);
+
+		const D3D12_BLEND_DESC& blendDesc = stream.BlendState;
+		writer.Write(blendDesc.AlphaToCoverageEnable);
+		writer.Write(blendDesc.IndependentBlendEnable);
+		for (const D3D12_RENDER_TARGET_BLEND_DESC& target : blendDesc.RenderTarget)
+		{
+			writer.Write(target.BlendEnable);
+			writer.Write(target.LogicOpEnable);
+			writer.Write(target.SrcBlend);
+			writer.Write(target.DestBlend);
+			writer.Write(target.BlendOp);
+			writer.Write(target.SrcBlendAlpha);
+			writer.Write(target.DestBlendAlpha);
+			writer.Write(target.BlendOpAlpha);
+			writer.Write(target.LogicOp);
+			writer.Write(target.RenderTargetWriteMask);
+		}
+
+		const D3D12_DEPTH_STENCIL_DESC1& depthStencilDesc = stream.DepthStencilState;
+		writer.Write(depthStencilDesc.DepthEnable);
+		writer.Write(depthStencilDesc.DepthWriteMask);
+		writer.Write(depthStencilDesc.DepthFunc);
+		writer.Write(depthStencilDesc.StencilEnable);
+		writer.Write(depthStencilDesc.StencilReadMask);
+		writer.Write(depthStencilDesc.StencilWriteMask);
+		writer.Write(depthStencilDesc.FrontFace);
+		writer.Write(depthStencilDesc.BackFace);
+		writer.Write(depthStencilDesc.DepthBoundsTestEnable);
+
+		writer.Write<DXGI_FORMAT>(stream.DSVFormat);
+		writer.Write<D3D12_RASTERIZER_DESC>(stream.RasterizerState);
+		writer.Write<D3D12_RT_FORMAT_ARRAY>(stream.RTVFormats);
+		writer.Write<DXGI_SAMPLE_DESC>(stream.SampleDesc);
+		writer.Write<UINT>(stream.SampleMask);
+
+		const D3D12_CACHED_PIPELINE_STATE& cachedPSO = stream.CachedPSO;
+		writer.Write(cachedPSO.pCachedBlob);
+		writer.Write(cachedPSO.CachedBlobSizeInBytes);
+
+		const D3D12_VIEW_INSTANCING_DESC& viewInstancingDesc = stream.ViewInstancingDesc;
+		writer.Write(viewInstancingDesc.ViewInstanceCount);
+		writer.Write(viewInstancingDesc.pViewInstanceLocations);
+		writer.Write(viewInstancingDesc.Flags);
+	}
+
 	void FGraphicsPipelineStateInitializer::SetBlendState(const FBlendState& blendDesc)
 	{
 		PipelineStateStream.BlendState = blendDesc.D3DBlendState();
@@ -132,9 +226,10 @@ namespace Dash
 
 	void FGraphicsPipelineStateInitializer::Finalize()
 	{
-		HashCode = HashState(&PipelineStateStream, 1, ShaderPass->GetShadersHash());
-		const D3D12_INPUT_LAYOUT_DESC& InputLayoutDesc = PipelineStateStream.InputLayout;
-		HashCode = HashState(InputLayoutDesc.pInputElementDescs, InputLayoutDesc.NumElements, HashCode);
+		FCacheKeyWriter writer(CacheKey);
+		WritePipelineStateStream(writer, PipelineStateStream);
+
+		HashCode = Hash64(CacheKey.data(), CacheKey.size(), ShaderPass->GetShadersHash());
 	}
 
 	void FComputePipelineStateInitializer::SetShaderPass(const FShaderPassRef& shaderPass)
@@ -157,7 +252,10 @@ namespace Dash
 
 	void FComputePipelineStateInitializer::Finalize()
 	{
-		HashCode = HashState(&PipelineStateStream, 1, ShaderPass->GetShadersHash());
+		FCacheKeyWriter writer(CacheKey);
+		WritePipelineStateStream(writer, PipelineStateStream);
+
+		HashCode = Hash64(CacheKey.data(), CacheKey.size(), ShaderPass->GetShadersHash());
 	}
 
 	FPipelineStateObject::FPipelineStateObject(const std::string& name)
@@ -212,58 +310,58 @@ namespace Dash
 
 	FGraphicsPSO* FPipelineStateCache::GetGraphicsPipelineState(const FGraphicsPipelineStateInitializer& initializer, const std::string& name)
 	{
-		ASSERT(initializer.HashCode != 0);
+		ASSERT_MSG(!initializer.CacheKey.empty(), "Pipeline state initializer is not finalized");
 
 		std::lock_guard<std::mutex> lock(mGraphicsPipelineStateLock);
-		auto iter = mGraphicsPipelineStateHashMap.find(initializer.HashCode);
-		if(iter == mGraphicsPipelineStateHashMap.end())
+		FGraphicsPSO* graphicsPSO = mGraphicsPipelineStateCache.Find(initializer.HashCode, initializer.CacheKey);
+		if (graphicsPSO == nullptr)
 		{
-			FGraphicsPSO* newGraphicsPSO = new FGraphicsPSO(initializer, name);
-			mGraphicsPipelineStateHashMap.emplace(initializer.HashCode, newGraphicsPSO);
-			return newGraphicsPSO;
+			graphicsPSO = new FGraphicsPSO(initializer, name);
+			mGraphicsPipelineStateCache.Add(initializer.HashCode, initializer.CacheKey, graphicsPSO);
 		}
 
-		ASSERT(iter->second);
-		return iter->second;
+		return graphicsPSO;
 	}
 
 	FComputePSO* FPipelineStateCache::GetComputePipelineState(const FComputePipelineStateInitializer& initializer, const std::string& name)
 	{
-		ASSERT(initializer.HashCode != 0);
+		ASSERT_MSG(!initializer.CacheKey.empty(), "Pipeline state initializer is not finalized");
 
 		std::lock_guard<std::mutex> lock(mComputePipelineStateLock);
-		auto iter = mComputePipelineStateHashMap.find(initializer.HashCode);
-		if (iter == mComputePipelineStateHashMap.end())
+		FComputePSO* computePSO = mComputePipelineStateCache.Find(initializer.HashCode, initializer.CacheKey);
+		if (computePSO == nullptr)
 		{
-			FComputePSO* newComputePSO = new FComputePSO(initializer, name);
-			mComputePipelineStateHashMap.emplace(initializer.HashCode, newComputePSO);
-			return newComputePSO;
+			computePSO = new FComputePSO(initializer, name);
+			mComputePipelineStateCache.Add(initializer.HashCode, initializer.CacheKey, computePSO);
 		}
 
-		ASSERT(iter->second);
-		return iter->second;
+		return computePSO;
+	}
+
+	FHashCacheStats FPipelineStateCache::GetGraphicsPipelineStateStats()
+	{
+		std::lock_guard<std::mutex> lock(mGraphicsPipelineStateLock);
+		return mGraphicsPipelineStateCache.GetStats();
+	}
+
+	FHashCacheStats FPipelineStateCache::GetComputePipelineStateStats()
+	{
+		std::lock_guard<std::mutex> lock(mComputePipelineStateLock);
+		return mComputePipelineStateCache.GetStats();
 	}
 
 	void FPipelineStateCache::Destroy()
 	{
 		{
 			std::lock_guard<std::mutex> lock(mGraphicsPipelineStateLock);
-			for (auto& Pair : mGraphicsPipelineStateHashMap)
-			{
-				delete Pair.second;
-			}
-
-			mGraphicsPipelineStateHashMap.clear();
+			mGraphicsPipelineStateCache.ForEach([](FGraphicsPSO* graphicsPSO) { delete graphicsPSO; });
+			mGraphicsPipelineStateCache.Clear();
 		}
 
 		{
 			std::lock_guard<std::mutex> lock(mComputePipelineStateLock);
-			for (auto& Pair : mComputePipelineStateHashMap)
-			{
-				delete Pair.second;
-			}
-
-			mComputePipelineStateHashMap.clear();
+			mComputePipelineStateCache.ForEach([](FComputePSO* computePSO) { delete computePSO; });
+			mComputePipelineStateCache.Clear();
 		}
 	}
 }
\ No newline at end of file
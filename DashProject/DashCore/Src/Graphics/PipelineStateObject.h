@@ -7,6 +7,7 @@
 #include "BlendState.h"
 #include "DepthStencilState.h"
 #include "PrimitiveTopology.h"
+#include "Utility/VerifiedHashCache.h"
 
 namespace Dash
 {
@@ -49,6 +50,9 @@ namespace Dash
 		size_t HashCode;
 		CD3DX12_PIPELINE_STATE_STREAM2 PipelineStateStream;
 
+		// Canonical bytes of the stream built by Finalize, the input layout is written by value.
+		std::vector<uint8> CacheKey;
+
 	protected:
 		void SetVertexShader(const void* binaryCode, size_t size) { PipelineStateStream.VS = CD3DX12_SHADER_BYTECODE(binaryCode, size); }
 		void SetPixelShader(const void* binaryCode, size_t size) { PipelineStateStream.PS = CD3DX12_SHADER_BYTECODE(binaryCode, size); }
@@ -75,6 +79,9 @@ namespace Dash
 		size_t HashCode;
 		CD3DX12_PIPELINE_STATE_STREAM2 PipelineStateStream;
 
+		// Canonical bytes of the stream built by Finalize, the input layout is written by value.
+		std::vector<uint8> CacheKey;
+
 	protected:
 		void SetComputeShader(const void* binaryCode, size_t size) { PipelineStateStream.CS = CD3DX12_SHADER_BYTECODE(binaryCode, size); }
 	};
@@ -134,13 +141,16 @@ namespace Dash
 		FGraphicsPSO* GetGraphicsPipelineState(const FGraphicsPipelineStateInitializer& initializer, const std::string& name);
 		FComputePSO* GetComputePipelineState(const FComputePipelineStateInitializer& initializer, const std::string& name);
 
+		FHashCacheStats GetGraphicsPipelineStateStats();
+		FHashCacheStats GetComputePipelineStateStats();
+
 		void Destroy();
 
 	private:
 		std::mutex mGraphicsPipelineStateLock;
 		std::mutex mComputePipelineStateLock;
 
-		std::map<size_t, FGraphicsPSO*> mGraphicsPipelineStateHashMap;
-		std::map<size_t, FComputePSO*> mComputePipelineStateHashMap;
+		TVerifiedHashCache<FGraphicsPSO> mGraphicsPipelineStateCache;
+		TVerifiedHashCache<FComputePSO> mComputePipelineStateCache;
 	};
 }
\ No newline at end of file
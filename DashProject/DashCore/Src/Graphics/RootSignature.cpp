@@ -7,16 +7,33 @@
 
 namespace Dash
 {
-	size_t FQuantizedBoundShaderState::GetTypeHash() const
+	static void WriteRootSignatureDesc(FCacheKeyWriter& writer, const D3D12_ROOT_SIGNATURE_DESC1& desc)
 	{
-		size_t hashCode = HashState(&RootSignatureType);
-		hashCode = HashState(&NumRootParameters, 1, hashCode);
-		hashCode = HashState(&NumStaticSamplers, 1, hashCode);
-		for (int32 i = 0; i < GShaderStageCount; i++)
+		writer.Write(desc.Flags);
+		writer.Write(desc.NumParameters);
+		for (uint32 paramIndex = 0; paramIndex < desc.NumParameters; paramIndex++)
 		{
-			hashCode = HashState(&RegisterCounts[i], 1, hashCode);
+			const D3D12_ROOT_PARAMETER1& rootParameter = desc.pParameters[paramIndex];
+			writer.Write(rootParameter.ParameterType);
+			writer.Write(rootParameter.ShaderVisibility);
+
+			switch (rootParameter.ParameterType)
+			{
+			case D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE:
+				writer.Write(rootParameter.DescriptorTable.NumDescriptorRanges);
+				writer.Write(rootParameter.DescriptorTable.pDescriptorRanges, rootParameter.DescriptorTable.NumDescriptorRanges * sizeof(D3D12_DESCRIPTOR_RANGE1));
+				break;
+			case D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS:
+				writer.Write(rootParameter.Constants);
+				break;
+			default:
+				writer.Write(rootParameter.Descriptor);
+				break;
+			}
 		}
-		return hashCode;
+
+		writer.Write(desc.NumStaticSamplers);
+		writer.Write(desc.pStaticSamplers, desc.NumStaticSamplers * sizeof(D3D12_STATIC_SAMPLER_DESC));
 	}
 
 	uint32 FRootSignature::GetDescriptorTableBitMask(D3D12_DESCRIPTOR_HEAP_TYPE type) const
@@ -147,6 +164,10 @@ namespace Dash
 			}
 		}
 
+		FCacheKeyWriter writer(CacheKey);
+		WriteRootSignatureDesc(writer, RootSignatureDesc);
+		HashCode = Hash64(CacheKey.data(), CacheKey.size());
+
 		for (uint32 i = 0; i < RootSignatureDesc.NumParameters; i++)
 		{
 			const D3D12_ROOT_PARAMETER1* paramter = &RootSignatureDesc.pParameters[i];
@@ -183,27 +204,29 @@ namespace Dash
 	{
 		std::lock_guard<std::mutex> lock(mLock);
 
-		for (auto& Pair : RootSignatureHashMap)
-		{
-			delete Pair.second;
-		}
-
-		RootSignatureHashMap.clear();
+		mRootSignatureCache.ForEach([](FRootSignature* rootSignature) { delete rootSignature; });
+		mRootSignatureCache.Clear();
 	}
 
 	FRootSignature* FRootSignatureManager::GetRootSignature(const FBoundShaderState& boundShaderState, const std::string& name)
 	{
-		std::lock_guard<std::mutex> lock(mLock);
+		ASSERT_MSG(!boundShaderState.CacheKey.empty(), "Bound shader state is not finalized");
 
-		auto iter = RootSignatureHashMap.find(boundShaderState.HashCode);
+		std::lock_guard<std::mutex> lock(mLock);
 
-		if (iter == RootSignatureHashMap.end())
+		FRootSignature* rootSignature = mRootSignatureCache.Find(boundShaderState.HashCode, boundShaderState.CacheKey);
+		if (rootSignature == nullptr)
 		{
 			return CreateRootSignature(boundShaderState, name);
 		}
 
-		ASSERT(iter->second);
-		return iter->second;
+		return rootSignature;
+	}
+
+	FHashCacheStats FRootSignatureManager::GetStats()
+	{
+		std::lock_guard<std::mutex> lock(mLock);
+		return mRootSignatureCache.GetStats();
 	}
 
 	FRootSignature* FRootSignatureManager::CreateRootSignature(const FBoundShaderState& boundShaderState, const std::string& name)
@@ -211,7 +234,7 @@ namespace Dash
 		FRootSignature* newRootSignature = new FRootSignature(boundShaderState, name);
 		ASSERT(newRootSignature);
 
-		RootSignatureHashMap.emplace(boundShaderState.HashCode, newRootSignature);
+		mRootSignatureCache.Add(boundShaderState.HashCode, boundShaderState.CacheKey, newRootSignature);
 
 		return newRootSignature;
 	}
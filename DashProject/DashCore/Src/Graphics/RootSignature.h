@@ -3,6 +3,7 @@
 #include "SamplerDesc.h"
 #include "GraphicsDefines.h"
 #include "Utility/RefCounting.h"
+#include "Utility/VerifiedHashCache.h"
 
 namespace Dash
 {
@@ -36,8 +37,6 @@ namespace Dash
 				NumRootParameters == RHS.NumRootParameters &&
 				NumStaticSamplers == RHS.NumStaticSamplers;
 		}
-
-		size_t GetTypeHash() const;
 	};
 
 	class FRootParameter
@@ -139,6 +138,7 @@ namespace Dash
 			, NumStaticSamplers(boundShaderState.NumStaticSamplers)
 			, NumInitializedStaticSamplers(0)
 			, NumDescriptorsPerTable{ 0 }
+			, HashCode(0)
 		{
 			if (NumParameters > 0)
 			{
@@ -159,7 +159,6 @@ namespace Dash
 			}
 
 			NumInitializedStaticSamplers = 0;
-			HashCode = boundShaderState.GetTypeHash();
 		}
 
 		~FBoundShaderState() {};
@@ -192,6 +191,9 @@ namespace Dash
 		std::unique_ptr<FRootParameter[]> ParameterArray;
 
 		D3D12_ROOT_SIGNATURE_DESC1 RootSignatureDesc;
+
+		// Canonical bytes of RootSignatureDesc built by Finalize, parameters, ranges and static samplers are written by value.
+		std::vector<uint8> CacheKey;
 		size_t HashCode;
 	};
 
@@ -235,18 +237,20 @@ namespace Dash
 		FRootSignatureManager() {}
 		~FRootSignatureManager()
 		{
-			ASSERT(RootSignatureHashMap.size() == 0);
+			ASSERT(mRootSignatureCache.GetSize() == 0);
 		}
 
 		void Destroy();
 
 		FRootSignature* GetRootSignature(const FBoundShaderState& boundShaderState, const std::string& name);
 
+		FHashCacheStats GetStats();
+
 	private:
 		FRootSignature* CreateRootSignature(const FBoundShaderState& boundShaderState, const std::string& name);
 
 	private:
 		std::mutex mLock;
-		std::map<size_t, FRootSignature*> RootSignatureHashMap;
+		TVerifiedHashCache<FRootSignature> mRootSignatureCache;
 	};
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "DX12Helper.h"
 #include "Utility/FileUtility.h"
 #include "ShaderPreprocesser.h"
+#include "Utility/CpuProfiler.h"
 
 namespace Dash
 {
@@ -22,6 +23,8 @@ namespace Dash
 
 	FDX12CompiledShader FShaderCompiler::CompileShader(const FShaderCreationInfo& info)
 	{
+		DASH_CPU_SCOPE("FShaderCompiler::CompileShader");
+
 		FDX12CompiledShader compiledShader;
 
 		if (info.IsOutOfDate())
@@ -3,6 +3,7 @@
 #include "ShaderMap.h"
 #include "Utility/StringUtility.h"
 #include "GraphicsCore.h"
+#include "Utility/Hash.h"
 
 namespace Dash
 {
@@ -32,7 +33,9 @@ namespace Dash
 		return newPass;
 	}
 
-	FShaderVariable FShaderPass::FindShaderVariable(const std::string& parameterName, EShaderStage stage)
+	static const FShaderVariable GInvalidShaderVariable{};
+
+	const FShaderVariable& FShaderPass::FindShaderVariable(FName parameterName, EShaderStage stage) const
 	{
 		uint32 shaderStageIndex = static_cast<uint32>(stage);
 		auto iter = mShaderVariableMaps[shaderStageIndex].find(parameterName);
@@ -42,11 +45,11 @@ namespace Dash
 		}
 		else
 		{
-			return FShaderVariable{};
+			return GInvalidShaderVariable;
 		}
 	}
 
-	FShaderVariable FShaderPass::FindShaderVariable(EShaderParameterType type, uint32 baseIndex, EShaderStage stage)
+	const FShaderVariable& FShaderPass::FindShaderVariable(EShaderParameterType type, uint32 baseIndex, EShaderStage stage) const
 	{
 		uint32 shaderStageIndex = static_cast<uint32>(stage);
 		for (const auto& pair : mShaderVariableMaps[shaderStageIndex]) {
@@ -56,7 +59,7 @@ namespace Dash
 			}
 		}
 	
-		return FShaderVariable{};
+		return GInvalidShaderVariable;
 	}
 
 	const FInputAssemblerLayout& FShaderPass::GetInputLayout() const
@@ -192,7 +195,7 @@ namespace Dash
 		{
 			HashedShaderFileName += SortedShaders[Index]->GetHashedFileName();
 		}
-		ShadersHash = std::hash<std::string>{}(HashedShaderFileName);
+		ShadersHash = HashObject(HashedShaderFileName);
 
 		CreateRootSignature(quantizedBoundShaderState, cbvParameters, srvParameters, uavParameters, samplerParameters, containBindlessParameter);
 
@@ -407,15 +410,13 @@ namespace Dash
 		}
 	}
 
-	void FShaderPass::AddVariables(std::map<std::string, FShaderVariable>& variableMaps, const std::vector<FShaderParameter>& inParameters,
+	void FShaderPass::AddVariables(TFlatHashMap<FName, FShaderVariable>& variableMaps, const std::vector<FShaderParameter>& inParameters,
 		const std::map<std::string, EShaderResourceBindingType>& bindlessPrameterMap)
 	{
 		for (uint32 parameterIndex = 0; parameterIndex < inParameters.size(); parameterIndex++)
 		{
 			const FShaderParameter& parameter = inParameters[parameterIndex];
 
-			std::string shaderVariableName = parameter.Name;
-
 			FShaderVariable shaderVariable;
 			shaderVariable.Name = parameter.Name;
 			shaderVariable.BaseIndex = parameterIndex;
@@ -427,7 +428,7 @@ namespace Dash
 			shaderVariable.ParamterType = parameter.ParameterType;
 			shaderVariable.BindingType = parameter.BindingType;
 
-			variableMaps.emplace(shaderVariableName, shaderVariable);
+			variableMaps.emplace(shaderVariable.Name, shaderVariable);
 
 			if (parameter.ParameterType == EShaderParameterType::UniformBuffer)
 			{
@@ -435,7 +436,6 @@ namespace Dash
 				{
 					const FConstantBufferVariable& uniformVariable = parameter.ConstantBufferVariables[parameterIndex];
 
-					shaderVariableName = uniformVariable.VariableName;
 					shaderVariable.Name = uniformVariable.VariableName;
 					shaderVariable.Size = uniformVariable.Size;
 					shaderVariable.StartOffset = uniformVariable.StartOffset;
@@ -446,11 +446,11 @@ namespace Dash
 						uniformVariable.ParamterType == EShaderParameterType::BindlessSRV || 
 						uniformVariable.ParamterType == EShaderParameterType::BindlessUAV)
 					{
-						ASSERT(bindlessPrameterMap.contains(shaderVariable.Name));
-						shaderVariable.BindingType = bindlessPrameterMap.find(shaderVariable.Name)->second;
+						ASSERT(bindlessPrameterMap.contains(uniformVariable.VariableName));
+						shaderVariable.BindingType = bindlessPrameterMap.find(uniformVariable.VariableName)->second;
 					}
 
-					variableMaps.emplace(shaderVariableName, shaderVariable);
+					variableMaps.emplace(shaderVariable.Name, shaderVariable);
 				}
 			}
 		}
@@ -2,6 +2,8 @@
 
 #include "GraphicTypesFwd.h"
 #include "Utility/ThreadSafeCounter.h"
+#include "Utility/FlatHashMap.h"
+#include "Utility/Name.h"
 #include "ShaderResource.h"
 #include "RootSignature.h"
 #include "SamplerDesc.h"
@@ -14,7 +16,7 @@ namespace Dash
 {
 	struct FShaderVariable
 	{
-		std::string Name;
+		FName Name;
 		uint32 BaseIndex = 0;	// BaseIndex In CVB, SRV, UAV, Sampler ParamterArray
 		uint32 Size = 0;
 		uint32 StartOffset = 0;
@@ -39,10 +41,11 @@ namespace Dash
 		const std::map<EShaderStage, FShaderResourceRef>& GetShaders() const { return mShaders; }
 		size_t GetShadersHash() const { return ShadersHash; }
 
-		const std::map<std::string, FShaderVariable>& GetShaderVariableMap(EShaderStage stage) { return mShaderVariableMaps[static_cast<uint32>(stage)]; }
+		const TFlatHashMap<FName, FShaderVariable>& GetShaderVariableMap(EShaderStage stage) { return mShaderVariableMaps[static_cast<uint32>(stage)]; }
 
-		FShaderVariable FindShaderVariable(const std::string& parameterName, EShaderStage stage);
-		FShaderVariable FindShaderVariable(EShaderParameterType type, uint32 baseIndex, EShaderStage stage);
+		// Both return a variable with an Invalid ParamterType if nothing matches.
+		const FShaderVariable& FindShaderVariable(FName parameterName, EShaderStage stage) const;
+		const FShaderVariable& FindShaderVariable(EShaderParameterType type, uint32 baseIndex, EShaderStage stage) const;
 
 		uint32 GetCBVParameterNum(EShaderStage stage) const { return mNumCBVParameters[static_cast<uint32>(stage)]; }
 		uint32 GetSRVParameterNum(EShaderStage stage) const { return mNumSRVParameters[static_cast<uint32>(stage)]; }
@@ -74,12 +77,12 @@ namespace Dash
 		void InitDescriptorRanges(FBoundShaderState& boundShaderState, std::vector<FShaderParameter>& parameters, uint32& rootParameterIndex, D3D12_DESCRIPTOR_RANGE_TYPE rangeType, 
 			D3D12_DESCRIPTOR_RANGE_FLAGS rangeFlags, EShaderStage stage);
 
-		void AddVariables(std::map<std::string, FShaderVariable>& variableMaps, const std::vector<FShaderParameter>& inParameters, const std::map<std::string, EShaderResourceBindingType>& bindlessPrameterMap);
+		void AddVariables(TFlatHashMap<FName, FShaderVariable>& variableMaps, const std::vector<FShaderParameter>& inParameters, const std::map<std::string, EShaderResourceBindingType>& bindlessPrameterMap);
 		 
 	private:
 		std::map<EShaderStage, FShaderResourceRef> mShaders;
 
-		std::map<std::string, FShaderVariable> mShaderVariableMaps[GShaderStageCount];
+		TFlatHashMap<FName, FShaderVariable> mShaderVariableMaps[GShaderStageCount];
 
 		uint32 mNumCBVParameters[GShaderStageCount];
 		uint32 mNumSRVParameters[GShaderStageCount];
@@ -2,6 +2,7 @@
 #include "ShaderResource.h"
 #include "Utility/StringUtility.h"
 #include "Utility/FileUtility.h"
+#include "Utility/Hash.h"
 #include "ResourceFormat.h"
 
 namespace Dash
@@ -68,7 +69,7 @@ namespace Dash
 			hasedName = hasedName + "_" + define;
 		}
 
-		ShaderHash = std::hash<std::string>{}(hasedName);
+		ShaderHash = HashObject(hasedName);
 		HashedFileName = hasedName + "_" + FStringUtility::ToString(ShaderHash);
 
 		ComputeShaderTargetFromEntryPoint();
@@ -35,7 +35,7 @@ namespace Dash
 	*/
 	static const float OneOver255 = 1.0f / 255.0f;
 
-	static FORCEINLINE int HexDigit(TCHAR c)
+	static FORCEINLINE int HexDigit(char c)
 	{
 		int Result = 0;
 
@@ -197,7 +197,7 @@ namespace Dash
 
 	FColor FColor::FromHex(const std::string& HexString)
 	{
-		size_t StartIndex = (!HexString.empty() && HexString[0] == TCHAR('#')) ? 1 : 0;
+		size_t StartIndex = (!HexString.empty() && HexString[0] == '#') ? 1 : 0;
 
 		if (HexString.length() == (3 + StartIndex))
 		{
@@ -533,4 +533,196 @@ namespace Dash
 		0.964686244552961f, 0.973445287039244f, 0.982250546956257f, 0.991102093719252f, 1.0f,
 	};
 
+
+	static_assert(sizeof(FColor) == 4 && sizeof(FLinearColor) == 16, "Batch color conversions assume tightly packed colors.");
+
+	static FORCEINLINE __m128 _LinearToSRGB(__m128 x)
+	{
+		__m128 curve = _Pow(_mm_max_ps(x, _mm_set1_ps(0.0031308f)), _mm_set1_ps(1.0f / 2.4f));
+		curve = _mm_sub_ps(_mm_mul_ps(curve, _mm_set1_ps(1.055f)), _mm_set1_ps(0.055f));
+
+		return _Select(_mm_cmple_ps(x, _mm_set1_ps(0.0031308f)), _mm_mul_ps(x, _mm_set1_ps(12.92f)), curve);
+	}
+
+	static FORCEINLINE __m128 _SRGBToLinear(__m128 x)
+	{
+		__m128 base = _mm_mul_ps(_mm_add_ps(_mm_max_ps(x, _mm_set1_ps(0.04045f)), _mm_set1_ps(0.055f)), _mm_set1_ps(1.0f / 1.055f));
+		__m128 curve = _Pow(base, _mm_set1_ps(2.4f));
+
+		return _Select(_mm_cmple_ps(x, _mm_set1_ps(0.04045f)), _mm_mul_ps(x, _mm_set1_ps(1.0f / 12.92f)), curve);
+	}
+
+	// Four FColors from one register, each channel widened to a lane of its own register.
+	static FORCEINLINE void _UnpackColors(__m128i packed, __m128i& r, __m128i& g, __m128i& b, __m128i& a)
+	{
+		const __m128i byteMask = _mm_set1_epi32(0xFF);
+
+		r = _mm_and_si128(packed, byteMask);
+		g = _mm_and_si128(_mm_srli_epi32(packed, 8), byteMask);
+		b = _mm_and_si128(_mm_srli_epi32(packed, 16), byteMask);
+		a = _mm_srli_epi32(packed, 24);
+	}
+
+	// Runs a kernel over four pixels at a time, the tail goes through a zero padded block so every pixel
+	// sees exactly the same code path.
+	template<typename InType, typename OutType, typename Kernel>
+	static void ConvertColors(std::span<const InType> In, std::span<OutType> Out, Kernel&& kernel)
+	{
+		ASSERT(In.size() <= Out.size());
+
+		const std::size_t Count = In.size();
+		std::size_t i = 0;
+
+		for (; i + 4 <= Count; i += 4)
+		{
+			kernel(In.data() + i, Out.data() + i);
+		}
+
+		if (i < Count)
+		{
+			InType BlockIn[4] = {};
+			OutType BlockOut[4];
+			std::copy(In.begin() + i, In.end(), BlockIn);
+
+			kernel(BlockIn, BlockOut);
+			std::copy(BlockOut, BlockOut + (Count - i), Out.begin() + i);
+		}
+	}
+
+	namespace FMath
+	{
+		void SRGBToLinear(std::span<const FColor> In, std::span<FLinearColor> Out)
+		{
+			ASSERT(In.size() <= Out.size());
+
+			for (std::size_t i = 0; i < In.size(); ++i)
+			{
+				const FColor Color = In[i];
+				Out[i] = FLinearColor(FLinearColor::sRGBToLinearTable[Color.r], FLinearColor::sRGBToLinearTable[Color.g], FLinearColor::sRGBToLinearTable[Color.b], float(Color.a) * OneOver255);
+			}
+		}
+
+		void Pow22ToLinear(std::span<const FColor> In, std::span<FLinearColor> Out)
+		{
+			ASSERT(In.size() <= Out.size());
+
+			for (std::size_t i = 0; i < In.size(); ++i)
+			{
+				const FColor Color = In[i];
+				Out[i] = FLinearColor(FLinearColor::Pow22OneOver255Table[Color.r], FLinearColor::Pow22OneOver255Table[Color.g], FLinearColor::Pow22OneOver255Table[Color.b], float(Color.a) * OneOver255);
+			}
+		}
+
+		void LinearToFColor(std::span<const FLinearColor> In, std::span<FColor> Out, bool bSRGB)
+		{
+			ConvertColors(In, Out, [bSRGB](const FLinearColor* Src, FColor* Dst)
+			{
+				__m128 r = _mm_loadu_ps(Src[0].Data);
+				__m128 g = _mm_loadu_ps(Src[1].Data);
+				__m128 b = _mm_loadu_ps(Src[2].Data);
+				__m128 a = _mm_loadu_ps(Src[3].Data);
+				_MM_TRANSPOSE4_PS(r, g, b, a);
+
+				const __m128 Zero = _mm_setzero_ps();
+				const __m128 One = _mm_set1_ps(1.0f);
+				r = _mm_min_ps(_mm_max_ps(r, Zero), One);
+				g = _mm_min_ps(_mm_max_ps(g, Zero), One);
+				b = _mm_min_ps(_mm_max_ps(b, Zero), One);
+				a = _mm_min_ps(_mm_max_ps(a, Zero), One);
+
+				if (bSRGB)
+				{
+					r = _LinearToSRGB(r);
+					g = _LinearToSRGB(g);
+					b = _LinearToSRGB(b);
+				}
+
+				// Inputs are non-negative here, so truncation is the floor ToFColor uses.
+				const __m128 Scale = _mm_set1_ps(255.999f);
+				__m128i Packed = _mm_cvttps_epi32(_mm_mul_ps(r, Scale));
+				Packed = _mm_or_si128(Packed, _mm_slli_epi32(_mm_cvttps_epi32(_mm_mul_ps(g, Scale)), 8));
+				Packed = _mm_or_si128(Packed, _mm_slli_epi32(_mm_cvttps_epi32(_mm_mul_ps(b, Scale)), 16));
+				Packed = _mm_or_si128(Packed, _mm_slli_epi32(_mm_cvttps_epi32(_mm_mul_ps(a, Scale)), 24));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst), Packed);
+			});
+		}
+
+		void LinearToRGBE(std::span<const FLinearColor> In, std::span<FColor> Out)
+		{
+			ConvertColors(In, Out, [](const FLinearColor* Src, FColor* Dst)
+			{
+				__m128 r = _mm_loadu_ps(Src[0].Data);
+				__m128 g = _mm_loadu_ps(Src[1].Data);
+				__m128 b = _mm_loadu_ps(Src[2].Data);
+				__m128 a = _mm_loadu_ps(Src[3].Data);
+				_MM_TRANSPOSE4_PS(r, g, b, a);
+
+				const __m128 Primary = _mm_max_ps(r, _mm_max_ps(g, b));
+				const __m128 Visible = _mm_cmpge_ps(Primary, _mm_set1_ps(1E-32f));
+
+				// frexp through the exponent bits: Primary = m * 2^e with m in [0.5, 1), Scale = m / Primary * 255 = 255 * 2^-e.
+				// Primary >= 1E-32 is always a normal float, so the biased exponent is valid.
+				const __m128i Exponent = _mm_sub_epi32(_mm_and_si128(_mm_srli_epi32(_mm_castps_si128(Primary), 23), _mm_set1_epi32(0xFF)), _mm_set1_epi32(126));
+				// Exponents lie in [-105, 128], small enough for the 16-bit min / max to clamp them.
+				const __m128i ScaleExponent = _mm_max_epi16(_mm_sub_epi32(_mm_set1_epi32(127), Exponent), _mm_set1_epi32(1));
+				const __m128 Scale = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(ScaleExponent, 23)), _mm_set1_ps(255.0f));
+
+				const __m128 Zero = _mm_setzero_ps();
+				const __m128 Max = _mm_set1_ps(255.0f);
+				__m128i Packed = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(r, Scale), Zero), Max));
+				Packed = _mm_or_si128(Packed, _mm_slli_epi32(_mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(g, Scale), Zero), Max)), 8));
+				Packed = _mm_or_si128(Packed, _mm_slli_epi32(_mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(b, Scale), Zero), Max)), 16));
+				Packed = _mm_or_si128(Packed, _mm_slli_epi32(_mm_min_epi16(_mm_add_epi32(Exponent, _mm_set1_epi32(128)), _mm_set1_epi32(255)), 24));
+				Packed = _mm_and_si128(Packed, _mm_castps_si128(Visible));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst), Packed);
+			});
+		}
+
+		void RGBEToLinear(std::span<const FColor> In, std::span<FLinearColor> Out)
+		{
+			ConvertColors(In, Out, [](const FColor* Src, FLinearColor* Dst)
+			{
+				__m128i r, g, b, e;
+				_UnpackColors(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Src)), r, g, b, e);
+
+				// Ldexp(1 / 255, e - 128) split into two factors so every exponent stays a normal float.
+				const __m128i HalfExponent = _mm_srli_epi32(e, 1);
+				__m128 Scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(HalfExponent, _mm_set1_epi32(63)), 23));
+				Scale = _mm_mul_ps(Scale, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_sub_epi32(e, HalfExponent), _mm_set1_epi32(63)), 23)));
+				Scale = _mm_mul_ps(Scale, _mm_set1_ps(1.0f / 255.0f));
+
+				// e == 0 is black.
+				Scale = _mm_andnot_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(e, _mm_setzero_si128())), Scale);
+
+				__m128 fr = _mm_mul_ps(_mm_cvtepi32_ps(r), Scale);
+				__m128 fg = _mm_mul_ps(_mm_cvtepi32_ps(g), Scale);
+				__m128 fb = _mm_mul_ps(_mm_cvtepi32_ps(b), Scale);
+				__m128 fa = _mm_set1_ps(1.0f);
+				_MM_TRANSPOSE4_PS(fr, fg, fb, fa);
+
+				_mm_storeu_ps(Dst[0].Data, fr);
+				_mm_storeu_ps(Dst[1].Data, fg);
+				_mm_storeu_ps(Dst[2].Data, fb);
+				_mm_storeu_ps(Dst[3].Data, fa);
+			});
+		}
+
+		void SRGBToLinear(std::span<const float> In, std::span<float> Out)
+		{
+			ConvertColors(In, Out, [](const float* Src, float* Dst)
+			{
+				_mm_storeu_ps(Dst, _SRGBToLinear(_mm_loadu_ps(Src)));
+			});
+		}
+
+		void LinearToSRGB(std::span<const float> In, std::span<float> Out)
+		{
+			ConvertColors(In, Out, [](const float* Src, float* Dst)
+			{
+				_mm_storeu_ps(Dst, _LinearToSRGB(_mm_loadu_ps(Src)));
+			});
+		}
+	}
 }
\ No newline at end of file
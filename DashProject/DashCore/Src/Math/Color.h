@@ -4,6 +4,7 @@
 #include "Scalar.h"
 #include "ScalarTraits.h"
 #include <cstdint>
+#include <span>
 
 namespace Dash
 {
@@ -599,5 +600,33 @@ namespace Dash
 	/** Computes a brightness and a fixed point color from a floating point color. */
 	extern void ComputeAndFixedColorAndIntensity(const FLinearColor& InLinearColor, FColor& OutColor, float& OutIntensity);
 
+	/**
+	 * Whole-image conversions, each element gives the same result as the matching per-pixel function, except that
+	 * sRGB encoding through the SIMD Pow can land one step lower or higher than ToFColor(true) right at a quantization boundary.
+	 * 8-bit input goes through the lookup tables above, float input through the SIMD polynomials in SIMDMath.h.
+	 * Out must be at least as large as the input.
+	 */
+	namespace FMath
+	{
+		/** FLinearColor::FromSRGBColor over a span. */
+		void SRGBToLinear(std::span<const FColor> In, std::span<FLinearColor> Out);
+
+		/** FLinearColor::FromPow22Color over a span. */
+		void Pow22ToLinear(std::span<const FColor> In, std::span<FLinearColor> Out);
+
+		/** FLinearColor::ToFColor over a span. */
+		void LinearToFColor(std::span<const FLinearColor> In, std::span<FColor> Out, bool bSRGB);
+
+		/** FLinearColor::ToRGBE over a span. */
+		void LinearToRGBE(std::span<const FLinearColor> In, std::span<FColor> Out);
+
+		/** FColor::FromRGBE over a span. */
+		void RGBEToLinear(std::span<const FColor> In, std::span<FLinearColor> Out);
+
+		/** The sRGB transfer functions on single channels, without clamping the input. Max error 2e-7 against double precision. */
+		void SRGBToLinear(std::span<const float> In, std::span<float> Out);
+		void LinearToSRGB(std::span<const float> In, std::span<float> Out);
+	}
+
 }
 
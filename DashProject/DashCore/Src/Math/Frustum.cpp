@@ -0,0 +1,425 @@
+#include "PCH.h"
+#include "Frustum.h"
+#include "Utility/CpuFeatures.h"
+
+#include <immintrin.h>
+#include <bit>
+
+namespace Dash
+{
+	constexpr std::size_t FrustumPlaneCount = static_cast<std::size_t>(EFrustumPlane::Num);
+
+	// Planes broadcast once per batch, together with |normal| for the box extent projection.
+	struct FFrustumPlanes4
+	{
+		explicit FFrustumPlanes4(const FFrustum& frustum) noexcept
+		{
+			const __m128 signMask = _mm_set1_ps(-0.0f);
+
+			for (std::size_t i = 0; i < FrustumPlaneCount; ++i)
+			{
+				const FVector4f& plane = frustum.GetPlanes()[i];
+				NX[i] = _mm_set1_ps(plane.X);
+				NY[i] = _mm_set1_ps(plane.Y);
+				NZ[i] = _mm_set1_ps(plane.Z);
+				D[i] = _mm_set1_ps(plane.W);
+				AbsNX[i] = _mm_andnot_ps(signMask, NX[i]);
+				AbsNY[i] = _mm_andnot_ps(signMask, NY[i]);
+				AbsNZ[i] = _mm_andnot_ps(signMask, NZ[i]);
+			}
+		}
+
+		FORCEINLINE uint32 TestBoxes(__m128 cx, __m128 cy, __m128 cz, __m128 ex, __m128 ey, __m128 ez) const noexcept
+		{
+			__m128 outside = _mm_setzero_ps();
+
+			for (std::size_t i = 0; i < FrustumPlaneCount; ++i)
+			{
+				__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(cx, NX[i]), _mm_mul_ps(cy, NY[i])), _mm_add_ps(_mm_mul_ps(cz, NZ[i]), D[i]));
+				__m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ex, AbsNX[i]), _mm_mul_ps(ey, AbsNY[i])), _mm_mul_ps(ez, AbsNZ[i]));
+				outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, radius), _mm_setzero_ps()));
+			}
+
+			return static_cast<uint32>(~_mm_movemask_ps(outside) & 0xF);
+		}
+
+		FORCEINLINE uint32 TestSpheres(__m128 cx, __m128 cy, __m128 cz, __m128 r) const noexcept
+		{
+			__m128 outside = _mm_setzero_ps();
+
+			for (std::size_t i = 0; i < FrustumPlaneCount; ++i)
+			{
+				__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(cx, NX[i]), _mm_mul_ps(cy, NY[i])), _mm_add_ps(_mm_mul_ps(cz, NZ[i]), D[i]));
+				outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, r), _mm_setzero_ps()));
+			}
+
+			return static_cast<uint32>(~_mm_movemask_ps(outside) & 0xF);
+		}
+
+		__m128 NX[FrustumPlaneCount];
+		__m128 NY[FrustumPlaneCount];
+		__m128 NZ[FrustumPlaneCount];
+		__m128 D[FrustumPlaneCount];
+		__m128 AbsNX[FrustumPlaneCount];
+		__m128 AbsNY[FrustumPlaneCount];
+		__m128 AbsNZ[FrustumPlaneCount];
+	};
+
+DASH_TARGET_AVX2_BEGIN
+	struct FFrustumPlanes8
+	{
+		explicit FFrustumPlanes8(const FFrustum& frustum) noexcept
+		{
+			const __m256 signMask = _mm256_set1_ps(-0.0f);
+
+			for (std::size_t i = 0; i < FrustumPlaneCount; ++i)
+			{
+				const FVector4f& plane = frustum.GetPlanes()[i];
+				NX[i] = _mm256_set1_ps(plane.X);
+				NY[i] = _mm256_set1_ps(plane.Y);
+				NZ[i] = _mm256_set1_ps(plane.Z);
+				D[i] = _mm256_set1_ps(plane.W);
+				AbsNX[i] = _mm256_andnot_ps(signMask, NX[i]);
+				AbsNY[i] = _mm256_andnot_ps(signMask, NY[i]);
+				AbsNZ[i] = _mm256_andnot_ps(signMask, NZ[i]);
+			}
+		}
+
+		FORCEINLINE uint32 TestBoxes(__m256 cx, __m256 cy, __m256 cz, __m256 ex, __m256 ey, __m256 ez) const noexcept
+		{
+			__m256 outside = _mm256_setzero_ps();
+
+			for (std::size_t i = 0; i < FrustumPlaneCount; ++i)
+			{
+				__m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(cx, NX[i]), _mm256_mul_ps(cy, NY[i])), _mm256_add_ps(_mm256_mul_ps(cz, NZ[i]), D[i]));
+				__m256 radius = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ex, AbsNX[i]), _mm256_mul_ps(ey, AbsNY[i])), _mm256_mul_ps(ez, AbsNZ[i]));
+				outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(distance, radius), _mm256_setzero_ps(), _CMP_LT_OQ));
+			}
+
+			return static_cast<uint32>(~_mm256_movemask_ps(outside) & 0xFF);
+		}
+
+		FORCEINLINE uint32 TestSpheres(__m256 cx, __m256 cy, __m256 cz, __m256 r) const noexcept
+		{
+			__m256 outside = _mm256_setzero_ps();
+
+			for (std::size_t i = 0; i < FrustumPlaneCount; ++i)
+			{
+				__m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(cx, NX[i]), _mm256_mul_ps(cy, NY[i])), _mm256_add_ps(_mm256_mul_ps(cz, NZ[i]), D[i]));
+				outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(distance, r), _mm256_setzero_ps(), _CMP_LT_OQ));
+			}
+
+			return static_cast<uint32>(~_mm256_movemask_ps(outside) & 0xFF);
+		}
+
+		__m256 NX[FrustumPlaneCount];
+		__m256 NY[FrustumPlaneCount];
+		__m256 NZ[FrustumPlaneCount];
+		__m256 D[FrustumPlaneCount];
+		__m256 AbsNX[FrustumPlaneCount];
+		__m256 AbsNY[FrustumPlaneCount];
+		__m256 AbsNZ[FrustumPlaneCount];
+	};
+DASH_TARGET_END
+
+	// Runs the visibility test over the stream from element first on and hands each group of results to the sink as
+	// (first index, visible bits). Groups are 16, 8, 4 or 1 wide and never straddle a 32-bit mask word, the wider
+	// kernels below process their part of the stream and finish through these SSE2 loops.
+	template<typename Sink>
+	static void CullBoxesStream4(const FFrustum& frustum, const FConstBoundingBoxSoA& boxes, Sink& sink, std::size_t first = 0) noexcept
+	{
+		const std::size_t count = boxes.GetSize();
+		const float* minX = boxes.MinX.data();
+		const float* minY = boxes.MinY.data();
+		const float* minZ = boxes.MinZ.data();
+		const float* maxX = boxes.MaxX.data();
+		const float* maxY = boxes.MaxY.data();
+		const float* maxZ = boxes.MaxZ.data();
+
+		const FFrustumPlanes4 planes4{ frustum };
+		const __m128 half4 = _mm_set1_ps(0.5f);
+
+		std::size_t i = first;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 lx = _mm_loadu_ps(minX + i), ux = _mm_loadu_ps(maxX + i);
+			__m128 ly = _mm_loadu_ps(minY + i), uy = _mm_loadu_ps(maxY + i);
+			__m128 lz = _mm_loadu_ps(minZ + i), uz = _mm_loadu_ps(maxZ + i);
+
+			sink(i, planes4.TestBoxes(
+				_mm_mul_ps(_mm_add_ps(lx, ux), half4), _mm_mul_ps(_mm_add_ps(ly, uy), half4), _mm_mul_ps(_mm_add_ps(lz, uz), half4),
+				_mm_mul_ps(_mm_sub_ps(ux, lx), half4), _mm_mul_ps(_mm_sub_ps(uy, ly), half4), _mm_mul_ps(_mm_sub_ps(uz, lz), half4)));
+		}
+
+		for (; i < count; ++i)
+		{
+			FBoundingBox box{ FVector3f{ minX[i], minY[i], minZ[i] }, FVector3f{ maxX[i], maxY[i], maxZ[i] } };
+			sink(i, frustum.Intersects(box) ? 1u : 0u);
+		}
+	}
+
+	template<typename Sink>
+	static void CullSpheresStream4(const FFrustum& frustum, const FConstBoundingSphereSoA& spheres, Sink& sink, std::size_t first = 0) noexcept
+	{
+		const std::size_t count = spheres.GetSize();
+		const float* x = spheres.X.data();
+		const float* y = spheres.Y.data();
+		const float* z = spheres.Z.data();
+		const float* r = spheres.Radius.data();
+
+		const FFrustumPlanes4 planes4{ frustum };
+
+		std::size_t i = first;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			sink(i, planes4.TestSpheres(_mm_loadu_ps(x + i), _mm_loadu_ps(y + i), _mm_loadu_ps(z + i), _mm_loadu_ps(r + i)));
+		}
+
+		for (; i < count; ++i)
+		{
+			sink(i, frustum.Intersects(FVector3f{ x[i], y[i], z[i] }, r[i]) ? 1u : 0u);
+		}
+	}
+
+DASH_TARGET_AVX2_BEGIN
+	template<typename Sink>
+	static void CullBoxesStream8(const FFrustum& frustum, const FConstBoundingBoxSoA& boxes, Sink& sink) noexcept
+	{
+		const std::size_t count = boxes.GetSize();
+		const FFrustumPlanes8 planes8{ frustum };
+		const __m256 half8 = _mm256_set1_ps(0.5f);
+
+		std::size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 lx = _mm256_loadu_ps(boxes.MinX.data() + i), ux = _mm256_loadu_ps(boxes.MaxX.data() + i);
+			__m256 ly = _mm256_loadu_ps(boxes.MinY.data() + i), uy = _mm256_loadu_ps(boxes.MaxY.data() + i);
+			__m256 lz = _mm256_loadu_ps(boxes.MinZ.data() + i), uz = _mm256_loadu_ps(boxes.MaxZ.data() + i);
+
+			sink(i, planes8.TestBoxes(
+				_mm256_mul_ps(_mm256_add_ps(lx, ux), half8), _mm256_mul_ps(_mm256_add_ps(ly, uy), half8), _mm256_mul_ps(_mm256_add_ps(lz, uz), half8),
+				_mm256_mul_ps(_mm256_sub_ps(ux, lx), half8), _mm256_mul_ps(_mm256_sub_ps(uy, ly), half8), _mm256_mul_ps(_mm256_sub_ps(uz, lz), half8)));
+		}
+
+		_mm256_zeroupper();
+		CullBoxesStream4(frustum, boxes, sink, i);
+	}
+
+	template<typename Sink>
+	static void CullSpheresStream8(const FFrustum& frustum, const FConstBoundingSphereSoA& spheres, Sink& sink) noexcept
+	{
+		const std::size_t count = spheres.GetSize();
+		const FFrustumPlanes8 planes8{ frustum };
+
+		std::size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			sink(i, planes8.TestSpheres(_mm256_loadu_ps(spheres.X.data() + i), _mm256_loadu_ps(spheres.Y.data() + i), _mm256_loadu_ps(spheres.Z.data() + i), _mm256_loadu_ps(spheres.Radius.data() + i)));
+		}
+
+		_mm256_zeroupper();
+		CullSpheresStream4(frustum, spheres, sink, i);
+	}
+DASH_TARGET_END
+
+DASH_TARGET_AVX512_BEGIN
+	// 16 wide, the compare masks come straight out of the opmask registers.
+	struct FFrustumPlanes16
+	{
+		explicit FFrustumPlanes16(const FFrustum& frustum) noexcept
+		{
+			for (std::size_t i = 0; i < FrustumPlaneCount; ++i)
+			{
+				const FVector4f& plane = frustum.GetPlanes()[i];
+				NX[i] = _mm512_set1_ps(plane.X);
+				NY[i] = _mm512_set1_ps(plane.Y);
+				NZ[i] = _mm512_set1_ps(plane.Z);
+				D[i] = _mm512_set1_ps(plane.W);
+				AbsNX[i] = _mm512_abs_ps(NX[i]);
+				AbsNY[i] = _mm512_abs_ps(NY[i]);
+				AbsNZ[i] = _mm512_abs_ps(NZ[i]);
+			}
+		}
+
+		FORCEINLINE uint32 TestBoxes(__m512 cx, __m512 cy, __m512 cz, __m512 ex, __m512 ey, __m512 ez) const noexcept
+		{
+			__mmask16 outside = 0;
+
+			for (std::size_t i = 0; i < FrustumPlaneCount; ++i)
+			{
+				__m512 distance = _mm512_fmadd_ps(cx, NX[i], _mm512_fmadd_ps(cy, NY[i], _mm512_fmadd_ps(cz, NZ[i], D[i])));
+				__m512 radius = _mm512_fmadd_ps(ex, AbsNX[i], _mm512_fmadd_ps(ey, AbsNY[i], _mm512_mul_ps(ez, AbsNZ[i])));
+				outside |= _mm512_cmp_ps_mask(_mm512_add_ps(distance, radius), _mm512_setzero_ps(), _CMP_LT_OQ);
+			}
+
+			return static_cast<uint32>(static_cast<uint16>(~outside));
+		}
+
+		FORCEINLINE uint32 TestSpheres(__m512 cx, __m512 cy, __m512 cz, __m512 r) const noexcept
+		{
+			__mmask16 outside = 0;
+
+			for (std::size_t i = 0; i < FrustumPlaneCount; ++i)
+			{
+				__m512 distance = _mm512_fmadd_ps(cx, NX[i], _mm512_fmadd_ps(cy, NY[i], _mm512_fmadd_ps(cz, NZ[i], D[i])));
+				outside |= _mm512_cmp_ps_mask(_mm512_add_ps(distance, r), _mm512_setzero_ps(), _CMP_LT_OQ);
+			}
+
+			return static_cast<uint32>(static_cast<uint16>(~outside));
+		}
+
+		__m512 NX[FrustumPlaneCount];
+		__m512 NY[FrustumPlaneCount];
+		__m512 NZ[FrustumPlaneCount];
+		__m512 D[FrustumPlaneCount];
+		__m512 AbsNX[FrustumPlaneCount];
+		__m512 AbsNY[FrustumPlaneCount];
+		__m512 AbsNZ[FrustumPlaneCount];
+	};
+
+	template<typename Sink>
+	static void CullBoxesStream16(const FFrustum& frustum, const FConstBoundingBoxSoA& boxes, Sink& sink) noexcept
+	{
+		const std::size_t count = boxes.GetSize();
+		const FFrustumPlanes16 planes16{ frustum };
+		const __m512 half16 = _mm512_set1_ps(0.5f);
+
+		std::size_t i = 0;
+
+		for (; i + 16 <= count; i += 16)
+		{
+			__m512 lx = _mm512_loadu_ps(boxes.MinX.data() + i), ux = _mm512_loadu_ps(boxes.MaxX.data() + i);
+			__m512 ly = _mm512_loadu_ps(boxes.MinY.data() + i), uy = _mm512_loadu_ps(boxes.MaxY.data() + i);
+			__m512 lz = _mm512_loadu_ps(boxes.MinZ.data() + i), uz = _mm512_loadu_ps(boxes.MaxZ.data() + i);
+
+			sink(i, planes16.TestBoxes(
+				_mm512_mul_ps(_mm512_add_ps(lx, ux), half16), _mm512_mul_ps(_mm512_add_ps(ly, uy), half16), _mm512_mul_ps(_mm512_add_ps(lz, uz), half16),
+				_mm512_mul_ps(_mm512_sub_ps(ux, lx), half16), _mm512_mul_ps(_mm512_sub_ps(uy, ly), half16), _mm512_mul_ps(_mm512_sub_ps(uz, lz), half16)));
+		}
+
+		_mm256_zeroupper();
+		CullBoxesStream4(frustum, boxes, sink, i);
+	}
+
+	template<typename Sink>
+	static void CullSpheresStream16(const FFrustum& frustum, const FConstBoundingSphereSoA& spheres, Sink& sink) noexcept
+	{
+		const std::size_t count = spheres.GetSize();
+		const FFrustumPlanes16 planes16{ frustum };
+
+		std::size_t i = 0;
+
+		for (; i + 16 <= count; i += 16)
+		{
+			sink(i, planes16.TestSpheres(_mm512_loadu_ps(spheres.X.data() + i), _mm512_loadu_ps(spheres.Y.data() + i), _mm512_loadu_ps(spheres.Z.data() + i), _mm512_loadu_ps(spheres.Radius.data() + i)));
+		}
+
+		_mm256_zeroupper();
+		CullSpheresStream4(frustum, spheres, sink, i);
+	}
+DASH_TARGET_END
+
+	template<typename Sink>
+	static void CullBoxesStream(const FFrustum& frustum, const FConstBoundingBoxSoA& boxes, Sink& sink) noexcept
+	{
+		ASSERT(boxes.MinY.size() == boxes.GetSize() && boxes.MinZ.size() == boxes.GetSize());
+		ASSERT(boxes.MaxX.size() == boxes.GetSize() && boxes.MaxY.size() == boxes.GetSize() && boxes.MaxZ.size() == boxes.GetSize());
+
+		using FunctionType = void(const FFrustum&, const FConstBoundingBoxSoA&, Sink&) noexcept;
+
+		static FunctionType* const Function = SelectCpuFunction<FunctionType>({
+			{ ECpuIsa::AVX512, &CullBoxesStream16<Sink> },
+			{ ECpuIsa::AVX2, &CullBoxesStream8<Sink> },
+			{ ECpuIsa::SSE2, [](const FFrustum& frustum, const FConstBoundingBoxSoA& boxes, Sink& sink) noexcept { CullBoxesStream4(frustum, boxes, sink); } },
+		});
+
+		Function(frustum, boxes, sink);
+	}
+
+	template<typename Sink>
+	static void CullSpheresStream(const FFrustum& frustum, const FConstBoundingSphereSoA& spheres, Sink& sink) noexcept
+	{
+		ASSERT(spheres.Y.size() == spheres.GetSize() && spheres.Z.size() == spheres.GetSize() && spheres.Radius.size() == spheres.GetSize());
+
+		using FunctionType = void(const FFrustum&, const FConstBoundingSphereSoA&, Sink&) noexcept;
+
+		static FunctionType* const Function = SelectCpuFunction<FunctionType>({
+			{ ECpuIsa::AVX512, &CullSpheresStream16<Sink> },
+			{ ECpuIsa::AVX2, &CullSpheresStream8<Sink> },
+			{ ECpuIsa::SSE2, [](const FFrustum& frustum, const FConstBoundingSphereSoA& spheres, Sink& sink) noexcept { CullSpheresStream4(frustum, spheres, sink); } },
+		});
+
+		Function(frustum, spheres, sink);
+	}
+
+	struct FCullMaskSink
+	{
+		explicit FCullMaskSink(std::span<uint32> mask, std::size_t count) noexcept
+			: Mask(mask)
+		{
+			ASSERT(Mask.size() >= FMath::GetCullMaskWordCount(count));
+			std::fill_n(Mask.begin(), FMath::GetCullMaskWordCount(count), 0u);
+		}
+
+		FORCEINLINE void operator()(std::size_t first, uint32 bits) noexcept
+		{
+			Mask[first / 32] |= bits << (first % 32);
+		}
+
+		std::span<uint32> Mask;
+	};
+
+	struct FCullCompactSink
+	{
+		explicit FCullCompactSink(std::span<uint32> indices, [[maybe_unused]] std::size_t count) noexcept
+			: Indices(indices)
+		{
+			ASSERT(Indices.size() >= count);
+		}
+
+		FORCEINLINE void operator()(std::size_t first, uint32 bits) noexcept
+		{
+			while (bits != 0)
+			{
+				Indices[Written++] = static_cast<uint32>(first + std::countr_zero(bits));
+				bits &= bits - 1;
+			}
+		}
+
+		std::span<uint32> Indices;
+		std::size_t Written = 0;
+	};
+
+	namespace FMath
+	{
+		void FrustumCullBoxes(const FFrustum& frustum, const FConstBoundingBoxSoA& boxes, std::span<uint32> outMask) noexcept
+		{
+			FCullMaskSink sink{ outMask, boxes.GetSize() };
+			CullBoxesStream(frustum, boxes, sink);
+		}
+
+		void FrustumCullSpheres(const FFrustum& frustum, const FConstBoundingSphereSoA& spheres, std::span<uint32> outMask) noexcept
+		{
+			FCullMaskSink sink{ outMask, spheres.GetSize() };
+			CullSpheresStream(frustum, spheres, sink);
+		}
+
+		std::size_t FrustumCullBoxesCompact(const FFrustum& frustum, const FConstBoundingBoxSoA& boxes, std::span<uint32> outIndices) noexcept
+		{
+			FCullCompactSink sink{ outIndices, boxes.GetSize() };
+			CullBoxesStream(frustum, boxes, sink);
+			return sink.Written;
+		}
+
+		std::size_t FrustumCullSpheresCompact(const FFrustum& frustum, const FConstBoundingSphereSoA& spheres, std::span<uint32> outIndices) noexcept
+		{
+			FCullCompactSink sink{ outIndices, spheres.GetSize() };
+			CullSpheresStream(frustum, spheres, sink);
+			return sink.Written;
+		}
+	}
+}
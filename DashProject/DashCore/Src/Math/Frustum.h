@@ -0,0 +1,181 @@
+#pragma once
+
+#include "MathType.h"
+
+#include <span>
+
+namespace Dash
+{
+	enum class EFrustumPlane : uint8
+	{
+		Left,
+		Right,
+		Bottom,
+		Top,
+		Near,
+		Far,
+		Num,
+	};
+
+	// Six inward facing planes stored as (normal, distance): a point p is inside a plane when Dot(normal, p) + distance >= 0.
+	// Planes are extracted from a row-vector view-projection matrix with D3D clip depth [0, w].
+	// With reversedZ the near and far labels are swapped, and a degenerate plane (infinite far) never rejects anything.
+	class FFrustum
+	{
+	public:
+		FFrustum() noexcept;
+		explicit FFrustum(const FMatrix4x4& viewProjection, bool reversedZ = false) noexcept;
+
+		const FVector4f& GetPlane(EFrustumPlane plane) const noexcept { return mPlanes[static_cast<std::size_t>(plane)]; }
+		const FVector4f* GetPlanes() const noexcept { return mPlanes; }
+
+		bool Contains(const FVector3f& p) const noexcept;
+		bool Intersects(const FBoundingBox& box) const noexcept;
+		bool Intersects(const FVector3f& center, Scalar radius) const noexcept;
+
+	private:
+		static FVector4f NormalizePlane(const FVector4f& plane) noexcept;
+
+		FVector4f mPlanes[static_cast<std::size_t>(EFrustumPlane::Num)];
+	};
+
+	// Read-only structure-of-arrays views over the bounds fed to the batch culling kernels.
+	struct FConstBoundingBoxSoA
+	{
+		std::span<const float> MinX;
+		std::span<const float> MinY;
+		std::span<const float> MinZ;
+		std::span<const float> MaxX;
+		std::span<const float> MaxY;
+		std::span<const float> MaxZ;
+
+		std::size_t GetSize() const noexcept { return MinX.size(); }
+	};
+
+	struct FConstBoundingSphereSoA
+	{
+		std::span<const float> X;
+		std::span<const float> Y;
+		std::span<const float> Z;
+		std::span<const float> Radius;
+
+		std::size_t GetSize() const noexcept { return X.size(); }
+	};
+
+
+
+
+
+
+	// Non-member Function
+
+	// --Declaration-- //
+
+	// Batch culling, 8 (AVX) or 4 (SSE) bounds per iteration with a scalar tail.
+	// The mask variants write one bit per element (bit i % 32 of word i / 32), the compact variants write
+	// the indices of the visible elements in ascending order and return how many were written.
+	namespace FMath
+	{
+		constexpr std::size_t GetCullMaskWordCount(std::size_t count) noexcept { return (count + 31) / 32; }
+
+		void FrustumCullBoxes(const FFrustum& frustum, const FConstBoundingBoxSoA& boxes, std::span<uint32> outMask) noexcept;
+		void FrustumCullSpheres(const FFrustum& frustum, const FConstBoundingSphereSoA& spheres, std::span<uint32> outMask) noexcept;
+
+		std::size_t FrustumCullBoxesCompact(const FFrustum& frustum, const FConstBoundingBoxSoA& boxes, std::span<uint32> outIndices) noexcept;
+		std::size_t FrustumCullSpheresCompact(const FFrustum& frustum, const FConstBoundingSphereSoA& spheres, std::span<uint32> outIndices) noexcept;
+	}
+
+
+
+
+
+
+	// Member Function
+
+	// --Implementation-- //
+
+	FORCEINLINE FFrustum::FFrustum() noexcept
+	{
+		for (FVector4f& plane : mPlanes)
+		{
+			plane = FVector4f{ 0.0f, 0.0f, 0.0f, 1.0f };
+		}
+	}
+
+	FORCEINLINE FFrustum::FFrustum(const FMatrix4x4& viewProjection, bool reversedZ) noexcept
+	{
+		const FMatrix4x4& m = viewProjection;
+
+		FVector4f col0{ m[0][0], m[1][0], m[2][0], m[3][0] };
+		FVector4f col1{ m[0][1], m[1][1], m[2][1], m[3][1] };
+		FVector4f col2{ m[0][2], m[1][2], m[2][2], m[3][2] };
+		FVector4f col3{ m[0][3], m[1][3], m[2][3], m[3][3] };
+
+		FVector4f zNear = col2;
+		FVector4f zFar = col3 - col2;
+
+		mPlanes[static_cast<std::size_t>(EFrustumPlane::Left)] = NormalizePlane(col3 + col0);
+		mPlanes[static_cast<std::size_t>(EFrustumPlane::Right)] = NormalizePlane(col3 - col0);
+		mPlanes[static_cast<std::size_t>(EFrustumPlane::Bottom)] = NormalizePlane(col3 + col1);
+		mPlanes[static_cast<std::size_t>(EFrustumPlane::Top)] = NormalizePlane(col3 - col1);
+		mPlanes[static_cast<std::size_t>(EFrustumPlane::Near)] = NormalizePlane(reversedZ ? zFar : zNear);
+		mPlanes[static_cast<std::size_t>(EFrustumPlane::Far)] = NormalizePlane(reversedZ ? zNear : zFar);
+	}
+
+	FORCEINLINE bool FFrustum::Contains(const FVector3f& p) const noexcept
+	{
+		for (const FVector4f& plane : mPlanes)
+		{
+			if (plane.X * p.X + plane.Y * p.Y + plane.Z * p.Z + plane.W < 0.0f)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	FORCEINLINE bool FFrustum::Intersects(const FBoundingBox& box) const noexcept
+	{
+		FVector3f center = (box.Lower + box.Upper) * 0.5f;
+		FVector3f extent = (box.Upper - box.Lower) * 0.5f;
+
+		for (const FVector4f& plane : mPlanes)
+		{
+			Scalar distance = plane.X * center.X + plane.Y * center.Y + plane.Z * center.Z + plane.W;
+			Scalar radius = FMath::Abs(plane.X) * extent.X + FMath::Abs(plane.Y) * extent.Y + FMath::Abs(plane.Z) * extent.Z;
+
+			if (distance + radius < 0.0f)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	FORCEINLINE bool FFrustum::Intersects(const FVector3f& center, Scalar radius) const noexcept
+	{
+		for (const FVector4f& plane : mPlanes)
+		{
+			if (plane.X * center.X + plane.Y * center.Y + plane.Z * center.Z + plane.W + radius < 0.0f)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	FORCEINLINE FVector4f FFrustum::NormalizePlane(const FVector4f& plane) noexcept
+	{
+		Scalar length = FMath::Sqrt(plane.X * plane.X + plane.Y * plane.Y + plane.Z * plane.Z);
+
+		if (length <= TScalarTraits<Scalar>::Epsilon())
+		{
+			return FVector4f{ 0.0f, 0.0f, 0.0f, 1.0f };
+		}
+
+		return plane / length;
+	}
+}
@@ -42,7 +42,7 @@ namespace Dash
 
 			FVector3f qvec = Cross(tvec, v0v1);
 			v = Dot(r.Direction, qvec) * invDet;
-			if (v < 0 || v > 1) return false;
+			if (v < 0 || u + v > 1) return false;
 
 			t = Dot(v0v2, qvec) * invDet;
 
@@ -54,12 +54,10 @@ namespace Dash
 			Scalar tMin = 0, tMax = r.TMax;
 			for (std::size_t i = 0; i < 3; i++)
 			{
-				Scalar invRayDir = Scalar{ 1 } / r.Direction[i];
-				Scalar tNear = (b.Lower[i] - r.Origin[i]) * invRayDir;
-				Scalar tFar = (b.Upper[i] - r.Origin[i]) * invRayDir;
-
-				if (tNear > tFar)
-					Swap(tNear, tFar);
+				const FVector3f& nearBound = r.Sign[i] ? b.Upper : b.Lower;
+				const FVector3f& farBound = r.Sign[i] ? b.Lower : b.Upper;
+				Scalar tNear = (nearBound[i] - r.Origin[i]) * r.InvDirection[i];
+				Scalar tFar = (farBound[i] - r.Origin[i]) * r.InvDirection[i];
 
 				tMin = tNear > tMin ? tNear : tMin;
 				tMax = tFar < tMax ? tFar : tMax;
@@ -0,0 +1,469 @@
+#pragma once
+
+#include "Intersection.h"
+
+#include <bit>
+
+namespace Dash
+{
+	// Structure-of-arrays bundle of Width triangles stored as (v0, v1 - v0, v2 - v0).
+	// Unused lanes keep zero edges, which the kernels treat as degenerate and never report as hits.
+	template<std::size_t Width>
+	struct TTrianglePacket
+	{
+	public:
+		TTrianglePacket() noexcept { Clear(); }
+
+		void Clear() noexcept;
+		void SetTriangle(std::size_t lane, const FVector3f& v0, const FVector3f& v1, const FVector3f& v2) noexcept;
+
+		alignas(32) float V0[3][Width];
+		alignas(32) float Edge1[3][Width];
+		alignas(32) float Edge2[3][Width];
+	};
+
+	// Width rays in structure-of-arrays form, copied from the cached inverse direction of each TScalarRay.
+	template<std::size_t Width>
+	struct TRayPacket
+	{
+	public:
+		TRayPacket() noexcept { Clear(); }
+
+		void Clear() noexcept;
+		void SetRay(std::size_t lane, const FRay& r) noexcept;
+
+		alignas(32) float Origin[3][Width];
+		alignas(32) float Direction[3][Width];
+		alignas(32) float InvDirection[3][Width];
+		alignas(32) float TMin[Width];
+		alignas(32) float TMax[Width];
+	};
+
+	// Width boxes in structure-of-arrays form, cleared lanes hold an inverted (empty) box that never hits.
+	template<std::size_t Width>
+	struct TBoundingBoxPacket
+	{
+	public:
+		TBoundingBoxPacket() noexcept { Clear(); }
+
+		void Clear() noexcept;
+		void SetBox(std::size_t lane, const FBoundingBox& b) noexcept;
+
+		alignas(32) float Lower[3][Width];
+		alignas(32) float Upper[3][Width];
+	};
+
+	struct FPacketTriangleHit
+	{
+		uint32 Mask = 0;
+		uint32 Lane = 0;
+		Scalar T = TScalarTraits<Scalar>::Infinity();
+		Scalar U = 0;
+		Scalar V = 0;
+	};
+
+	template<std::size_t Width>
+	struct TPacketBoxHit
+	{
+		uint32 Mask = 0;
+		alignas(32) float TNear[Width];
+		alignas(32) float TFar[Width];
+	};
+
+	using FTrianglePacket4 = TTrianglePacket<4>;
+	using FTrianglePacket8 = TTrianglePacket<8>;
+	using FRayPacket4 = TRayPacket<4>;
+	using FRayPacket8 = TRayPacket<8>;
+	using FBoundingBoxPacket4 = TBoundingBoxPacket<4>;
+
+
+
+
+
+
+	// Non-member Function
+
+	// --Declaration-- //
+
+	// Packet variants of RayTriangleIntersection and RayBoundingBoxIntersection.
+	// One ray against 4/8 triangles returns the hit mask and the nearest hit (lane, t, u, v) inside [TMin, TMax].
+	// 4/8 rays against one box, or one ray against 4 boxes, return the hit mask and the entry/exit distances per lane.
+	// The 8 wide versions use AVX when the translation unit is compiled with it and two 4 wide passes otherwise.
+	namespace FMath
+	{
+		uint32 RayTriangleIntersection(const FRay& r, const FTrianglePacket4& triangles, FPacketTriangleHit& hit) noexcept;
+		uint32 RayTriangleIntersection(const FRay& r, const FTrianglePacket8& triangles, FPacketTriangleHit& hit) noexcept;
+
+		uint32 RayBoundingBoxIntersection(const FRayPacket4& rays, const FBoundingBox& b, TPacketBoxHit<4>& hit) noexcept;
+		uint32 RayBoundingBoxIntersection(const FRayPacket8& rays, const FBoundingBox& b, TPacketBoxHit<8>& hit) noexcept;
+
+		uint32 RayBoundingBoxIntersection(const FRay& r, const FBoundingBoxPacket4& boxes, TPacketBoxHit<4>& hit) noexcept;
+	}
+
+
+
+
+
+
+	// Member Function
+
+	// --Implementation-- //
+
+	template<std::size_t Width>
+	FORCEINLINE void TTrianglePacket<Width>::Clear() noexcept
+	{
+		for (std::size_t i = 0; i < 3; i++)
+		{
+			for (std::size_t lane = 0; lane < Width; lane++)
+			{
+				V0[i][lane] = 0.0f;
+				Edge1[i][lane] = 0.0f;
+				Edge2[i][lane] = 0.0f;
+			}
+		}
+	}
+
+	template<std::size_t Width>
+	FORCEINLINE void TTrianglePacket<Width>::SetTriangle(std::size_t lane, const FVector3f& v0, const FVector3f& v1, const FVector3f& v2) noexcept
+	{
+		ASSERT(lane < Width);
+
+		for (std::size_t i = 0; i < 3; i++)
+		{
+			V0[i][lane] = v0[i];
+			Edge1[i][lane] = v1[i] - v0[i];
+			Edge2[i][lane] = v2[i] - v0[i];
+		}
+	}
+
+	template<std::size_t Width>
+	FORCEINLINE void TBoundingBoxPacket<Width>::Clear() noexcept
+	{
+		for (std::size_t i = 0; i < 3; i++)
+		{
+			for (std::size_t lane = 0; lane < Width; lane++)
+			{
+				Lower[i][lane] = TScalarTraits<float>::Max();
+				Upper[i][lane] = TScalarTraits<float>::Lowest();
+			}
+		}
+	}
+
+	template<std::size_t Width>
+	FORCEINLINE void TBoundingBoxPacket<Width>::SetBox(std::size_t lane, const FBoundingBox& b) noexcept
+	{
+		ASSERT(lane < Width);
+
+		for (std::size_t i = 0; i < 3; i++)
+		{
+			Lower[i][lane] = b.Lower[i];
+			Upper[i][lane] = b.Upper[i];
+		}
+	}
+
+	template<std::size_t Width>
+	FORCEINLINE void TRayPacket<Width>::Clear() noexcept
+	{
+		for (std::size_t lane = 0; lane < Width; lane++)
+		{
+			for (std::size_t i = 0; i < 3; i++)
+			{
+				Origin[i][lane] = 0.0f;
+				Direction[i][lane] = 0.0f;
+				InvDirection[i][lane] = TScalarTraits<float>::Infinity();
+			}
+
+			// An empty interval, cleared lanes never hit.
+			TMin[lane] = 1.0f;
+			TMax[lane] = 0.0f;
+		}
+	}
+
+	template<std::size_t Width>
+	FORCEINLINE void TRayPacket<Width>::SetRay(std::size_t lane, const FRay& r) noexcept
+	{
+		ASSERT(lane < Width);
+
+		for (std::size_t i = 0; i < 3; i++)
+		{
+			Origin[i][lane] = r.Origin[i];
+			Direction[i][lane] = r.Direction[i];
+			InvDirection[i][lane] = r.InvDirection[i];
+		}
+
+		TMin[lane] = r.TMin;
+		TMax[lane] = r.TMax;
+	}
+
+
+
+
+
+
+	// Non-member Function
+
+	// --Implementation-- //
+
+	namespace FMath
+	{
+		// 4 wide Moller-Trumbore over lanes [base, base + 4) of a triangle packet, returns the hit mask in the low 4 bits.
+		template<std::size_t Width>
+		FORCEINLINE uint32 _RayTriangleIntersection4(const FRay& r, const TTrianglePacket<Width>& tri, std::size_t base, __m128& t, __m128& u, __m128& v) noexcept
+		{
+			__m128 dx = _mm_set1_ps(r.Direction.X), dy = _mm_set1_ps(r.Direction.Y), dz = _mm_set1_ps(r.Direction.Z);
+
+			__m128 e1x = _mm_load_ps(tri.Edge1[0] + base), e1y = _mm_load_ps(tri.Edge1[1] + base), e1z = _mm_load_ps(tri.Edge1[2] + base);
+			__m128 e2x = _mm_load_ps(tri.Edge2[0] + base), e2y = _mm_load_ps(tri.Edge2[1] + base), e2z = _mm_load_ps(tri.Edge2[2] + base);
+
+			// pvec = Cross(direction, edge2)
+			__m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+			__m128 py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+			__m128 pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+
+			__m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+			__m128 absDet = _mm_andnot_ps(_mm_set1_ps(-0.0f), det);
+			__m128 mask = _mm_cmpge_ps(absDet, _mm_set1_ps(TScalarTraits<float>::Epsilon()));
+			__m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+
+			__m128 tx = _mm_sub_ps(_mm_set1_ps(r.Origin.X), _mm_load_ps(tri.V0[0] + base));
+			__m128 ty = _mm_sub_ps(_mm_set1_ps(r.Origin.Y), _mm_load_ps(tri.V0[1] + base));
+			__m128 tz = _mm_sub_ps(_mm_set1_ps(r.Origin.Z), _mm_load_ps(tri.V0[2] + base));
+
+			u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(tx, px), _mm_mul_ps(ty, py)), _mm_mul_ps(tz, pz)), invDet);
+
+			// qvec = Cross(tvec, edge1)
+			__m128 qx = _mm_sub_ps(_mm_mul_ps(ty, e1z), _mm_mul_ps(tz, e1y));
+			__m128 qy = _mm_sub_ps(_mm_mul_ps(tz, e1x), _mm_mul_ps(tx, e1z));
+			__m128 qz = _mm_sub_ps(_mm_mul_ps(tx, e1y), _mm_mul_ps(ty, e1x));
+
+			v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)), invDet);
+			t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), invDet);
+
+			mask = _mm_and_ps(mask, _mm_cmpge_ps(u, _mm_setzero_ps()));
+			mask = _mm_and_ps(mask, _mm_cmpge_ps(v, _mm_setzero_ps()));
+			mask = _mm_and_ps(mask, _mm_cmple_ps(_mm_add_ps(u, v), _mm_set1_ps(1.0f)));
+			mask = _mm_and_ps(mask, _mm_cmpge_ps(t, _mm_set1_ps(r.TMin)));
+			mask = _mm_and_ps(mask, _mm_cmple_ps(t, _mm_set1_ps(r.TMax)));
+
+			return static_cast<uint32>(_mm_movemask_ps(mask));
+		}
+
+		FORCEINLINE void _PickNearestHit(uint32 mask, std::size_t base, const float* t, const float* u, const float* v, FPacketTriangleHit& hit) noexcept
+		{
+			while (mask != 0)
+			{
+				uint32 lane = static_cast<uint32>(std::countr_zero(mask));
+				mask &= mask - 1;
+
+				if (t[lane] < hit.T)
+				{
+					hit.Lane = static_cast<uint32>(base) + lane;
+					hit.T = t[lane];
+					hit.U = u[lane];
+					hit.V = v[lane];
+				}
+			}
+		}
+
+		FORCEINLINE uint32 RayTriangleIntersection(const FRay& r, const FTrianglePacket4& triangles, FPacketTriangleHit& hit) noexcept
+		{
+			__m128 t, u, v;
+			uint32 mask = _RayTriangleIntersection4(r, triangles, 0, t, u, v);
+
+			hit = FPacketTriangleHit{};
+			hit.Mask = mask;
+
+			if (mask != 0)
+			{
+				alignas(16) float ts[4], us[4], vs[4];
+				_mm_store_ps(ts, t);
+				_mm_store_ps(us, u);
+				_mm_store_ps(vs, v);
+				_PickNearestHit(mask, 0, ts, us, vs, hit);
+			}
+
+			return mask;
+		}
+
+		FORCEINLINE uint32 RayTriangleIntersection(const FRay& r, const FTrianglePacket8& triangles, FPacketTriangleHit& hit) noexcept
+		{
+			hit = FPacketTriangleHit{};
+
+#if defined(__AVX__)
+			const FTrianglePacket8& tri = triangles;
+
+			__m256 dx = _mm256_set1_ps(r.Direction.X), dy = _mm256_set1_ps(r.Direction.Y), dz = _mm256_set1_ps(r.Direction.Z);
+
+			__m256 e1x = _mm256_load_ps(tri.Edge1[0]), e1y = _mm256_load_ps(tri.Edge1[1]), e1z = _mm256_load_ps(tri.Edge1[2]);
+			__m256 e2x = _mm256_load_ps(tri.Edge2[0]), e2y = _mm256_load_ps(tri.Edge2[1]), e2z = _mm256_load_ps(tri.Edge2[2]);
+
+			__m256 px = _mm256_sub_ps(_mm256_mul_ps(dy, e2z), _mm256_mul_ps(dz, e2y));
+			__m256 py = _mm256_sub_ps(_mm256_mul_ps(dz, e2x), _mm256_mul_ps(dx, e2z));
+			__m256 pz = _mm256_sub_ps(_mm256_mul_ps(dx, e2y), _mm256_mul_ps(dy, e2x));
+
+			__m256 det = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e1x, px), _mm256_mul_ps(e1y, py)), _mm256_mul_ps(e1z, pz));
+			__m256 absDet = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), det);
+			__m256 mask = _mm256_cmp_ps(absDet, _mm256_set1_ps(TScalarTraits<float>::Epsilon()), _CMP_GE_OQ);
+			__m256 invDet = _mm256_div_ps(_mm256_set1_ps(1.0f), det);
+
+			__m256 tx = _mm256_sub_ps(_mm256_set1_ps(r.Origin.X), _mm256_load_ps(tri.V0[0]));
+			__m256 ty = _mm256_sub_ps(_mm256_set1_ps(r.Origin.Y), _mm256_load_ps(tri.V0[1]));
+			__m256 tz = _mm256_sub_ps(_mm256_set1_ps(r.Origin.Z), _mm256_load_ps(tri.V0[2]));
+
+			__m256 u = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(tx, px), _mm256_mul_ps(ty, py)), _mm256_mul_ps(tz, pz)), invDet);
+
+			__m256 qx = _mm256_sub_ps(_mm256_mul_ps(ty, e1z), _mm256_mul_ps(tz, e1y));
+			__m256 qy = _mm256_sub_ps(_mm256_mul_ps(tz, e1x), _mm256_mul_ps(tx, e1z));
+			__m256 qz = _mm256_sub_ps(_mm256_mul_ps(tx, e1y), _mm256_mul_ps(ty, e1x));
+
+			__m256 v = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, qx), _mm256_mul_ps(dy, qy)), _mm256_mul_ps(dz, qz)), invDet);
+			__m256 t = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e2x, qx), _mm256_mul_ps(e2y, qy)), _mm256_mul_ps(e2z, qz)), invDet);
+
+			mask = _mm256_and_ps(mask, _mm256_cmp_ps(u, _mm256_setzero_ps(), _CMP_GE_OQ));
+			mask = _mm256_and_ps(mask, _mm256_cmp_ps(v, _mm256_setzero_ps(), _CMP_GE_OQ));
+			mask = _mm256_and_ps(mask, _mm256_cmp_ps(_mm256_add_ps(u, v), _mm256_set1_ps(1.0f), _CMP_LE_OQ));
+			mask = _mm256_and_ps(mask, _mm256_cmp_ps(t, _mm256_set1_ps(r.TMin), _CMP_GE_OQ));
+			mask = _mm256_and_ps(mask, _mm256_cmp_ps(t, _mm256_set1_ps(r.TMax), _CMP_LE_OQ));
+
+			uint32 bits = static_cast<uint32>(_mm256_movemask_ps(mask));
+			hit.Mask = bits;
+
+			if (bits != 0)
+			{
+				alignas(32) float ts[8], us[8], vs[8];
+				_mm256_store_ps(ts, t);
+				_mm256_store_ps(us, u);
+				_mm256_store_ps(vs, v);
+				_PickNearestHit(bits, 0, ts, us, vs, hit);
+			}
+
+			return bits;
+#else
+			for (std::size_t base = 0; base < 8; base += 4)
+			{
+				__m128 t, u, v;
+				uint32 bits = _RayTriangleIntersection4(r, triangles, base, t, u, v);
+
+				if (bits != 0)
+				{
+					alignas(16) float ts[4], us[4], vs[4];
+					_mm_store_ps(ts, t);
+					_mm_store_ps(us, u);
+					_mm_store_ps(vs, v);
+					_PickNearestHit(bits, base, ts, us, vs, hit);
+					hit.Mask |= bits << base;
+				}
+			}
+
+			return hit.Mask;
+#endif // __AVX__
+		}
+
+		// Slab test over lanes [base, base + 4) of a ray packet, clipped to each ray's [TMin, TMax].
+		template<std::size_t Width>
+		FORCEINLINE uint32 _RayBoundingBoxIntersection4(const TRayPacket<Width>& rays, const FBoundingBox& b, std::size_t base, TPacketBoxHit<Width>& hit) noexcept
+		{
+			const __m128 negativeInfinity = _mm_set1_ps(-TScalarTraits<float>::Infinity());
+			const __m128 positiveInfinity = _mm_set1_ps(TScalarTraits<float>::Infinity());
+
+			__m128 tNear = _mm_load_ps(rays.TMin + base);
+			__m128 tFar = _mm_load_ps(rays.TMax + base);
+
+			for (std::size_t i = 0; i < 3; i++)
+			{
+				__m128 origin = _mm_load_ps(rays.Origin[i] + base);
+				__m128 invDir = _mm_load_ps(rays.InvDirection[i] + base);
+
+				__m128 t0 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(b.Lower[i]), origin), invDir);
+				__m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(b.Upper[i]), origin), invDir);
+
+				// 0 * inf is NaN for a ray parallel to the slab with its origin on a face, that slab does not clip
+				// the ray, as in the scalar test.
+				__m128 nan0 = _mm_cmpunord_ps(t0, t0);
+				__m128 nan1 = _mm_cmpunord_ps(t1, t1);
+
+				tNear = _mm_max_ps(tNear, _mm_min_ps(_Select(nan0, negativeInfinity, t0), _Select(nan1, negativeInfinity, t1)));
+				tFar = _mm_min_ps(tFar, _mm_max_ps(_Select(nan0, positiveInfinity, t0), _Select(nan1, positiveInfinity, t1)));
+			}
+
+			_mm_store_ps(hit.TNear + base, tNear);
+			_mm_store_ps(hit.TFar + base, tFar);
+
+			return static_cast<uint32>(_mm_movemask_ps(_mm_cmple_ps(tNear, tFar)));
+		}
+
+		FORCEINLINE uint32 RayBoundingBoxIntersection(const FRayPacket4& rays, const FBoundingBox& b, TPacketBoxHit<4>& hit) noexcept
+		{
+			hit.Mask = _RayBoundingBoxIntersection4(rays, b, 0, hit);
+			return hit.Mask;
+		}
+
+		FORCEINLINE uint32 RayBoundingBoxIntersection(const FRayPacket8& rays, const FBoundingBox& b, TPacketBoxHit<8>& hit) noexcept
+		{
+#if defined(__AVX__)
+			const __m256 negativeInfinity = _mm256_set1_ps(-TScalarTraits<float>::Infinity());
+			const __m256 positiveInfinity = _mm256_set1_ps(TScalarTraits<float>::Infinity());
+
+			__m256 tNear = _mm256_load_ps(rays.TMin);
+			__m256 tFar = _mm256_load_ps(rays.TMax);
+
+			for (std::size_t i = 0; i < 3; i++)
+			{
+				__m256 origin = _mm256_load_ps(rays.Origin[i]);
+				__m256 invDir = _mm256_load_ps(rays.InvDirection[i]);
+
+				__m256 t0 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(b.Lower[i]), origin), invDir);
+				__m256 t1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(b.Upper[i]), origin), invDir);
+
+				// Same NaN slabs as in _RayBoundingBoxIntersection4.
+				__m256 nan0 = _mm256_cmp_ps(t0, t0, _CMP_UNORD_Q);
+				__m256 nan1 = _mm256_cmp_ps(t1, t1, _CMP_UNORD_Q);
+
+				tNear = _mm256_max_ps(tNear, _mm256_min_ps(_mm256_blendv_ps(t0, negativeInfinity, nan0), _mm256_blendv_ps(t1, negativeInfinity, nan1)));
+				tFar = _mm256_min_ps(tFar, _mm256_max_ps(_mm256_blendv_ps(t0, positiveInfinity, nan0), _mm256_blendv_ps(t1, positiveInfinity, nan1)));
+			}
+
+			_mm256_store_ps(hit.TNear, tNear);
+			_mm256_store_ps(hit.TFar, tFar);
+
+			hit.Mask = static_cast<uint32>(_mm256_movemask_ps(_mm256_cmp_ps(tNear, tFar, _CMP_LE_OQ)));
+#else
+			hit.Mask = _RayBoundingBoxIntersection4(rays, b, 0, hit) | (_RayBoundingBoxIntersection4(rays, b, 4, hit) << 4);
+#endif // __AVX__
+
+			return hit.Mask;
+		}
+
+		FORCEINLINE uint32 RayBoundingBoxIntersection(const FRay& r, const FBoundingBoxPacket4& boxes, TPacketBoxHit<4>& hit) noexcept
+		{
+			__m128 tNear = _mm_set1_ps(r.TMin);
+			__m128 tFar = _mm_set1_ps(r.TMax);
+
+			for (std::size_t i = 0; i < 3; i++)
+			{
+				__m128 origin = _mm_set1_ps(r.Origin[i]);
+				__m128 invDir = _mm_set1_ps(r.InvDirection[i]);
+
+				// Pick the slab order from the ray sign instead of min/max, inverted empty lanes then stay empty.
+				__m128 nearBound = _mm_load_ps(r.Sign[i] ? boxes.Upper[i] : boxes.Lower[i]);
+				__m128 farBound = _mm_load_ps(r.Sign[i] ? boxes.Lower[i] : boxes.Upper[i]);
+
+				__m128 slabNear = _mm_mul_ps(_mm_sub_ps(nearBound, origin), invDir);
+				__m128 slabFar = _mm_mul_ps(_mm_sub_ps(farBound, origin), invDir);
+
+				// A ray parallel to the slab with its origin on a face gives NaN, which must not clip it.
+				slabNear = _Select(_mm_cmpunord_ps(slabNear, slabNear), _mm_set1_ps(-TScalarTraits<float>::Infinity()), slabNear);
+				slabFar = _Select(_mm_cmpunord_ps(slabFar, slabFar), _mm_set1_ps(TScalarTraits<float>::Infinity()), slabFar);
+
+				tNear = _mm_max_ps(tNear, slabNear);
+				tFar = _mm_min_ps(tFar, slabFar);
+			}
+
+			_mm_store_ps(hit.TNear, tNear);
+			_mm_store_ps(hit.TFar, tFar);
+
+			hit.Mask = static_cast<uint32>(_mm_movemask_ps(_mm_cmple_ps(tNear, tFar)));
+			return hit.Mask;
+		}
+	}
+}
@@ -160,11 +160,14 @@ namespace Dash
 		TScalarMatrix<Scalar, 4, 4> Transpose(const TScalarMatrix<Scalar, 4, 4>& a) noexcept;
 
 		template <typename Scalar>
-		TScalarMatrix<Scalar, 4, 4> Determinate(const TScalarMatrix<Scalar, 4, 4>& a) noexcept;
+		Scalar Determinate(const TScalarMatrix<Scalar, 4, 4>& a) noexcept;
 
 		template <typename Scalar>
 		TScalarMatrix<Scalar, 4, 4> Inverse(const TScalarMatrix<Scalar, 4, 4>& a) noexcept;
 
+		template <typename Scalar>
+		TScalarMatrix<Scalar, 4, 4> InverseAffine(const TScalarMatrix<Scalar, 4, 4>& a) noexcept;
+
 		template <typename Scalar>
 		TScalarArray<Scalar, 3> Origin(const TScalarMatrix<Scalar, 4, 4>& a) noexcept;
 
@@ -385,25 +388,7 @@ namespace Dash
 	template<typename Scalar>
 	FORCEINLINE TScalarMatrix<Scalar, 4, 4>& TScalarMatrix<Scalar, 4, 4>::operator*=(TScalarMatrix<Scalar, 4, 4> a) noexcept
 	{
-		mRows[0][0] = FMath::Dot(mRows[0], FMath::Column(a, 0));
-		mRows[0][1] = FMath::Dot(mRows[0], FMath::Column(a, 1));
-		mRows[0][2] = FMath::Dot(mRows[0], FMath::Column(a, 2));
-		mRows[0][3] = FMath::Dot(mRows[0], FMath::Column(a, 3));
-
-		mRows[1][0] = FMath::Dot(mRows[1], FMath::Column(a, 0));
-		mRows[1][1] = FMath::Dot(mRows[1], FMath::Column(a, 1));
-		mRows[1][2] = FMath::Dot(mRows[1], FMath::Column(a, 2));
-		mRows[1][3] = FMath::Dot(mRows[1], FMath::Column(a, 3));
-
-		mRows[2][0] = FMath::Dot(mRows[2], FMath::Column(a, 0));
-		mRows[2][1] = FMath::Dot(mRows[2], FMath::Column(a, 1));
-		mRows[2][2] = FMath::Dot(mRows[2], FMath::Column(a, 2));
-		mRows[2][3] = FMath::Dot(mRows[2], FMath::Column(a, 3));
-
-		mRows[3][0] = FMath::Dot(mRows[3], FMath::Column(a, 0));
-		mRows[3][1] = FMath::Dot(mRows[3], FMath::Column(a, 1));
-		mRows[3][2] = FMath::Dot(mRows[3], FMath::Column(a, 2));
-		mRows[3][3] = FMath::Dot(mRows[3], FMath::Column(a, 3));
+		*this = *this * a;
 
 		return *this;
 	}
@@ -658,7 +643,7 @@ namespace Dash
 		}
 
 		template <typename Scalar>
-		FORCEINLINE TScalarMatrix<Scalar, 4, 4> Determinate(const TScalarMatrix<Scalar, 4, 4>& a) noexcept
+		FORCEINLINE Scalar Determinate(const TScalarMatrix<Scalar, 4, 4>& a) noexcept
 		{
 			//Scalar tmp[12];
 
@@ -778,6 +763,19 @@ namespace Dash
 			return TScalarMatrix<Scalar, 4, 4>(dst[0] * s, dst[1] * s, dst[2] * s, dst[3] * s);
 		}
 
+		template <typename Scalar>
+		FORCEINLINE TScalarMatrix<Scalar, 4, 4> InverseAffine(const TScalarMatrix<Scalar, 4, 4>& a) noexcept
+		{
+			// Only valid when the last column is (0, 0, 0, 1): invert the 3x3 basis and rotate the translation back.
+			TScalarMatrix<Scalar, 3, 3> invBasis = Inverse(Basis(a));
+			TScalarArray<Scalar, 3> invOrigin = -Mul(Origin(a), invBasis);
+
+			return TScalarMatrix<Scalar, 4, 4>{ invBasis[0][0], invBasis[0][1], invBasis[0][2], Scalar{},
+				invBasis[1][0], invBasis[1][1], invBasis[1][2], Scalar{},
+				invBasis[2][0], invBasis[2][1], invBasis[2][2], Scalar{},
+				invOrigin.X, invOrigin.Y, invOrigin.Z, Scalar{ 1 } };
+		}
+
 		template<typename Scalar>
 		FORCEINLINE TScalarArray<Scalar, 3> Origin(const TScalarMatrix<Scalar, 4, 4>& a) noexcept
 		{
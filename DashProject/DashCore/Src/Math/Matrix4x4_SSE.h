@@ -0,0 +1,263 @@
+#pragma once
+
+#include <immintrin.h>
+
+namespace Dash
+{
+	// Row-major float 4x4 kernels. The rows of TScalarMatrix<float, 4, 4> are TScalarArray<float, 4>,
+	// which under USE_SSE is the __m128 specialization from Vector4_SSE.h, so every kernel below works
+	// directly on the row registers. Non-template overloads win over the generic templates in Matrix4x4.h.
+
+	// Non-member Operators
+
+	// --Declaration-- //
+
+	TScalarMatrix<float, 4, 4> operator*(const TScalarMatrix<float, 4, 4>& a, const TScalarMatrix<float, 4, 4>& b) noexcept;
+
+
+
+
+
+
+
+	// Non-member Function
+
+	// --Declaration-- //
+
+	namespace FMath
+	{
+		TScalarArray<float, 4> Mul(const TScalarMatrix<float, 4, 4>& a, const TScalarArray<float, 4>& v) noexcept;
+		TScalarArray<float, 4> Mul(const TScalarArray<float, 4>& v, const TScalarMatrix<float, 4, 4>& a) noexcept;
+		TScalarMatrix<float, 4, 4> Mul(const TScalarMatrix<float, 4, 4>& a, const TScalarMatrix<float, 4, 4>& b) noexcept;
+
+		TScalarMatrix<float, 4, 4> Transpose(const TScalarMatrix<float, 4, 4>& a) noexcept;
+
+		float Determinate(const TScalarMatrix<float, 4, 4>& a) noexcept;
+
+		TScalarMatrix<float, 4, 4> Inverse(const TScalarMatrix<float, 4, 4>& a) noexcept;
+		TScalarMatrix<float, 4, 4> InverseAffine(const TScalarMatrix<float, 4, 4>& a) noexcept;
+	}
+
+
+
+
+
+
+
+
+	// Non-member Operators
+
+	// --Implementation-- //
+
+	FORCEINLINE TScalarMatrix<float, 4, 4> operator*(const TScalarMatrix<float, 4, 4>& a, const TScalarMatrix<float, 4, 4>& b) noexcept
+	{
+		return FMath::Mul(a, b);
+	}
+
+
+
+
+
+
+
+	// Non-member Function
+
+	// --Implementation-- //
+
+	namespace FMath
+	{
+		// 2x2 sub-matrix helpers for the block inverse, each __m128 holds a row-major 2x2 matrix (m00, m01, m10, m11).
+
+		// A * B
+		FORCEINLINE __m128 _Mat2Mul(__m128 a, __m128 b) noexcept
+		{
+			return _mm_add_ps(_mm_mul_ps(a, PERMUTE4(b, 0, 3, 0, 3)), _mm_mul_ps(PERMUTE4(a, 1, 0, 3, 2), PERMUTE4(b, 2, 1, 2, 1)));
+		}
+
+		// adj(A) * B
+		FORCEINLINE __m128 _Mat2AdjMul(__m128 a, __m128 b) noexcept
+		{
+			return _mm_sub_ps(_mm_mul_ps(PERMUTE4(a, 3, 3, 0, 0), b), _mm_mul_ps(PERMUTE4(a, 1, 1, 2, 2), PERMUTE4(b, 2, 3, 0, 1)));
+		}
+
+		// A * adj(B)
+		FORCEINLINE __m128 _Mat2MulAdj(__m128 a, __m128 b) noexcept
+		{
+			return _mm_sub_ps(_mm_mul_ps(a, PERMUTE4(b, 3, 0, 3, 0)), _mm_mul_ps(PERMUTE4(a, 1, 0, 3, 2), PERMUTE4(b, 2, 1, 2, 1)));
+		}
+
+		// v * M, the row combination used by every row-vector product below.
+		FORCEINLINE __m128 _MulRow(__m128 v, const TScalarMatrix<float, 4, 4>& a) noexcept
+		{
+			__m128 result = _mm_mul_ps(PERMUTE4(v, 0, 0, 0, 0), a[0]);
+			result = _MulAdd(PERMUTE4(v, 1, 1, 1, 1), a[1], result);
+			result = _MulAdd(PERMUTE4(v, 2, 2, 2, 2), a[2], result);
+			return _MulAdd(PERMUTE4(v, 3, 3, 3, 3), a[3], result);
+		}
+
+		FORCEINLINE TScalarArray<float, 4> Mul(const TScalarMatrix<float, 4, 4>& a, const TScalarArray<float, 4>& v) noexcept
+		{
+			__m128 r0 = _mm_mul_ps(a[0], v);
+			__m128 r1 = _mm_mul_ps(a[1], v);
+			__m128 r2 = _mm_mul_ps(a[2], v);
+			__m128 r3 = _mm_mul_ps(a[3], v);
+
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+			return TScalarArray<float, 4>{ _mm_add_ps(_mm_add_ps(r0, r1), _mm_add_ps(r2, r3)) };
+		}
+
+		FORCEINLINE TScalarArray<float, 4> Mul(const TScalarArray<float, 4>& v, const TScalarMatrix<float, 4, 4>& a) noexcept
+		{
+			return TScalarArray<float, 4>{ _MulRow(v, a) };
+		}
+
+		FORCEINLINE TScalarMatrix<float, 4, 4> Mul(const TScalarMatrix<float, 4, 4>& a, const TScalarMatrix<float, 4, 4>& b) noexcept
+		{
+#if defined(__AVX__)
+			// Two rows of a per 256-bit register, the rows of b broadcast into both lanes.
+			__m256 b0 = _mm256_broadcast_ps(&b[0].mVec);
+			__m256 b1 = _mm256_broadcast_ps(&b[1].mVec);
+			__m256 b2 = _mm256_broadcast_ps(&b[2].mVec);
+			__m256 b3 = _mm256_broadcast_ps(&b[3].mVec);
+
+			__m256 a01 = _mm256_insertf128_ps(_mm256_castps128_ps256(a[0]), a[1], 1);
+			__m256 a23 = _mm256_insertf128_ps(_mm256_castps128_ps256(a[2]), a[3], 1);
+
+			__m256 r01 = _mm256_mul_ps(_mm256_permute_ps(a01, 0x00), b0);
+			__m256 r23 = _mm256_mul_ps(_mm256_permute_ps(a23, 0x00), b0);
+			r01 = _MulAdd(_mm256_permute_ps(a01, 0x55), b1, r01);
+			r23 = _MulAdd(_mm256_permute_ps(a23, 0x55), b1, r23);
+			r01 = _MulAdd(_mm256_permute_ps(a01, 0xAA), b2, r01);
+			r23 = _MulAdd(_mm256_permute_ps(a23, 0xAA), b2, r23);
+			r01 = _MulAdd(_mm256_permute_ps(a01, 0xFF), b3, r01);
+			r23 = _MulAdd(_mm256_permute_ps(a23, 0xFF), b3, r23);
+
+			return TScalarMatrix<float, 4, 4>{ TScalarArray<float, 4>{ _mm256_castps256_ps128(r01) },
+				TScalarArray<float, 4>{ _mm256_extractf128_ps(r01, 1) },
+				TScalarArray<float, 4>{ _mm256_castps256_ps128(r23) },
+				TScalarArray<float, 4>{ _mm256_extractf128_ps(r23, 1) } };
+#else
+			return TScalarMatrix<float, 4, 4>{ TScalarArray<float, 4>{ _MulRow(a[0], b) },
+				TScalarArray<float, 4>{ _MulRow(a[1], b) },
+				TScalarArray<float, 4>{ _MulRow(a[2], b) },
+				TScalarArray<float, 4>{ _MulRow(a[3], b) } };
+#endif
+		}
+
+		FORCEINLINE TScalarMatrix<float, 4, 4> Transpose(const TScalarMatrix<float, 4, 4>& a) noexcept
+		{
+			__m128 r0 = a[0];
+			__m128 r1 = a[1];
+			__m128 r2 = a[2];
+			__m128 r3 = a[3];
+
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+			return TScalarMatrix<float, 4, 4>{ TScalarArray<float, 4>{ r0 }, TScalarArray<float, 4>{ r1 }, TScalarArray<float, 4>{ r2 }, TScalarArray<float, 4>{ r3 } };
+		}
+
+		FORCEINLINE float Determinate(const TScalarMatrix<float, 4, 4>& a) noexcept
+		{
+			// |M| = |A||D| + |B||C| - tr(adj(A) B adj(D) C) over the 2x2 blocks
+			__m128 A = _mm_movelh_ps(a[0], a[1]);
+			__m128 B = _mm_movehl_ps(a[1], a[0]);
+			__m128 C = _mm_movelh_ps(a[2], a[3]);
+			__m128 D = _mm_movehl_ps(a[3], a[2]);
+
+			__m128 detSub = _mm_sub_ps(
+				_mm_mul_ps(SHUFFLE4(a[0], a[2], 0, 2, 0, 2), SHUFFLE4(a[1], a[3], 1, 3, 1, 3)),
+				_mm_mul_ps(SHUFFLE4(a[0], a[2], 1, 3, 1, 3), SHUFFLE4(a[1], a[3], 0, 2, 0, 2)));
+
+			__m128 trace = _mm_mul_ps(_Mat2AdjMul(A, B), PERMUTE4(_Mat2AdjMul(D, C), 0, 2, 1, 3));
+			trace = _mm_hadd_ps(trace, trace);
+			trace = _mm_hadd_ps(trace, trace);
+
+			float det = _mm_cvtss_f32(_mm_mul_ps(detSub, PERMUTE4(detSub, 3, 2, 1, 0)));
+			det += _mm_cvtss_f32(_mm_mul_ps(PERMUTE4(detSub, 1, 1, 1, 1), PERMUTE4(detSub, 2, 2, 2, 2)));
+
+			return det - _mm_cvtss_f32(trace);
+		}
+
+		FORCEINLINE TScalarMatrix<float, 4, 4> Inverse(const TScalarMatrix<float, 4, 4>& a) noexcept
+		{
+			// Block inverse: M = | A B |, inverse(M) = 1/|M| * | X Y |
+			//                    | C D |                        | Z W |
+			__m128 A = _mm_movelh_ps(a[0], a[1]);
+			__m128 B = _mm_movehl_ps(a[1], a[0]);
+			__m128 C = _mm_movelh_ps(a[2], a[3]);
+			__m128 D = _mm_movehl_ps(a[3], a[2]);
+
+			// (|A|, |B|, |C|, |D|)
+			__m128 detSub = _mm_sub_ps(
+				_mm_mul_ps(SHUFFLE4(a[0], a[2], 0, 2, 0, 2), SHUFFLE4(a[1], a[3], 1, 3, 1, 3)),
+				_mm_mul_ps(SHUFFLE4(a[0], a[2], 1, 3, 1, 3), SHUFFLE4(a[1], a[3], 0, 2, 0, 2)));
+
+			__m128 detA = PERMUTE4(detSub, 0, 0, 0, 0);
+			__m128 detB = PERMUTE4(detSub, 1, 1, 1, 1);
+			__m128 detC = PERMUTE4(detSub, 2, 2, 2, 2);
+			__m128 detD = PERMUTE4(detSub, 3, 3, 3, 3);
+
+			__m128 DC = _Mat2AdjMul(D, C);
+			__m128 AB = _Mat2AdjMul(A, B);
+
+			__m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), _Mat2Mul(B, DC));
+			__m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), _Mat2Mul(C, AB));
+			__m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), _Mat2MulAdj(D, AB));
+			__m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), _Mat2MulAdj(A, DC));
+
+			__m128 trace = _mm_mul_ps(AB, PERMUTE4(DC, 0, 2, 1, 3));
+			trace = _mm_hadd_ps(trace, trace);
+			trace = _mm_hadd_ps(trace, trace);
+
+			__m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+			ASSERT(!IsZero(_mm_cvtss_f32(detM)));
+
+			__m128 invDetM = _Div(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+
+			X = _mm_mul_ps(X, invDetM);
+			Y = _mm_mul_ps(Y, invDetM);
+			Z = _mm_mul_ps(Z, invDetM);
+			W = _mm_mul_ps(W, invDetM);
+
+			// The adjugate swizzle is folded into the store shuffle.
+			return TScalarMatrix<float, 4, 4>{ TScalarArray<float, 4>{ SHUFFLE4(X, Y, 3, 1, 3, 1) },
+				TScalarArray<float, 4>{ SHUFFLE4(X, Y, 2, 0, 2, 0) },
+				TScalarArray<float, 4>{ SHUFFLE4(Z, W, 3, 1, 3, 1) },
+				TScalarArray<float, 4>{ SHUFFLE4(Z, W, 2, 0, 2, 0) } };
+		}
+
+		FORCEINLINE TScalarMatrix<float, 4, 4> InverseAffine(const TScalarMatrix<float, 4, 4>& a) noexcept
+		{
+			// | R 0 |^-1   | inverse(R)      0 |
+			// | t 1 |    = | -t inverse(R)   1 |, inverse(R) built from the cross products of its rows.
+			__m128 c0 = Cross(a[1], a[2]);
+			__m128 c1 = Cross(a[2], a[0]);
+			__m128 c2 = Cross(a[0], a[1]);
+
+			float det = Dot3(a[0], TScalarArray<float, 4>{ c0 });
+
+			ASSERT(!IsZero(det));
+
+			__m128 invDet = _Div(_mm_set1_ps(1.0f), det);
+			__m128 r0 = _mm_mul_ps(c0, invDet);
+			__m128 r1 = _mm_mul_ps(c1, invDet);
+			__m128 r2 = _mm_mul_ps(c2, invDet);
+			__m128 r3 = _mm_setzero_ps();
+
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+			__m128 t = a[3];
+			__m128 translation = _mm_mul_ps(PERMUTE4(t, 0, 0, 0, 0), r0);
+			translation = _MulAdd(PERMUTE4(t, 1, 1, 1, 1), r1, translation);
+			translation = _MulAdd(PERMUTE4(t, 2, 2, 2, 2), r2, translation);
+			translation = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), translation);
+
+			return TScalarMatrix<float, 4, 4>{ TScalarArray<float, 4>{ r0 },
+				TScalarArray<float, 4>{ r1 },
+				TScalarArray<float, 4>{ r2 },
+				TScalarArray<float, 4>{ translation } };
+		}
+	}
+}
@@ -0,0 +1,416 @@
+#include "PCH.h"
+#include "PackedFormat.h"
+#include "Utility/CpuFeatures.h"
+
+#include <immintrin.h>
+
+namespace Dash
+{
+	static_assert(sizeof(FVector3f) == sizeof(float) * 3, "FVector3f is expected to be tightly packed.");
+	static_assert(sizeof(FVector4f) == sizeof(float) * 4, "FVector4f is expected to be tightly packed.");
+
+	// Runs a kernel over Width elements at a time, the tail goes through a zero padded block so every element
+	// sees exactly the same code path.
+	template<std::size_t Width, typename InType, typename OutType, typename Kernel>
+	static void ConvertStream(std::span<const InType> in, std::span<OutType> out, Kernel&& kernel) noexcept
+	{
+		ASSERT(in.size() <= out.size());
+
+		const std::size_t count = in.size();
+		std::size_t i = 0;
+
+		for (; i + Width <= count; i += Width)
+		{
+			kernel(in.data() + i, out.data() + i);
+		}
+
+		if (i < count)
+		{
+			InType blockIn[Width] = {};
+			OutType blockOut[Width];
+			std::copy(in.begin() + i, in.end(), blockIn);
+
+			kernel(blockIn, blockOut);
+			std::copy(blockOut, blockOut + (count - i), out.begin() + i);
+		}
+	}
+
+	static FORCEINLINE __m128 _Clamp(__m128 x, __m128 lower, __m128 upper)
+	{
+		return _mm_min_ps(_mm_max_ps(x, lower), upper);
+	}
+
+	// Returns |a| with the sign of b.
+	static FORCEINLINE __m128 _CopySign(__m128 a, __m128 b)
+	{
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		return _mm_or_ps(_mm_andnot_ps(signMask, a), _mm_and_ps(signMask, b));
+	}
+
+	static FORCEINLINE void _OctahedralEncode(__m128 x, __m128 y, __m128 z, __m128& u, __m128& v)
+	{
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		const __m128 one = _mm_set1_ps(1.0f);
+
+		__m128 absX = _mm_andnot_ps(signMask, x);
+		__m128 absY = _mm_andnot_ps(signMask, y);
+		__m128 absZ = _mm_andnot_ps(signMask, z);
+
+		// Zero length inputs map to (0, 0), which decodes to +z.
+		__m128 invLength = _mm_div_ps(one, _mm_max_ps(_mm_add_ps(_mm_add_ps(absX, absY), absZ), _mm_set1_ps(TScalarTraits<float>::Epsilon())));
+		u = _mm_mul_ps(x, invLength);
+		v = _mm_mul_ps(y, invLength);
+
+		// The lower hemisphere is folded over the diagonals.
+		__m128 lower = _mm_cmplt_ps(z, _mm_setzero_ps());
+		__m128 foldU = _CopySign(_mm_sub_ps(one, _mm_andnot_ps(signMask, v)), u);
+		__m128 foldV = _CopySign(_mm_sub_ps(one, _mm_andnot_ps(signMask, u)), v);
+
+		u = _Select(lower, foldU, u);
+		v = _Select(lower, foldV, v);
+	}
+
+	static FORCEINLINE void _OctahedralDecode(__m128 u, __m128 v, __m128& x, __m128& y, __m128& z)
+	{
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+
+		z = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_andnot_ps(signMask, u)), _mm_andnot_ps(signMask, v));
+
+		__m128 t = _mm_max_ps(_mm_sub_ps(_mm_setzero_ps(), z), _mm_setzero_ps());
+		x = _mm_sub_ps(u, _CopySign(t, u));
+		y = _mm_sub_ps(v, _CopySign(t, v));
+
+		__m128 lengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+		__m128 invLength = _RSqrt(lengthSq);
+
+		x = _mm_mul_ps(x, invLength);
+		y = _mm_mul_ps(y, invLength);
+		z = _mm_mul_ps(z, invLength);
+	}
+
+	// Two's complement 16 bit fields to float, field 0 is the low half.
+	static FORCEINLINE __m128 _LowSnorm16ToFloat(__m128i packed)
+	{
+		__m128 value = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(packed, 16), 16));
+		return _mm_max_ps(_mm_mul_ps(value, _mm_set1_ps(1.0f / 32767.0f)), _mm_set1_ps(-1.0f));
+	}
+
+	static FORCEINLINE __m128 _HighSnorm16ToFloat(__m128i packed)
+	{
+		__m128 value = _mm_cvtepi32_ps(_mm_srai_epi32(packed, 16));
+		return _mm_max_ps(_mm_mul_ps(value, _mm_set1_ps(1.0f / 32767.0f)), _mm_set1_ps(-1.0f));
+	}
+
+	static FORCEINLINE __m128i _FloatToSnorm16(__m128 x)
+	{
+		// NaN to 0 as in D3D, the clamp alone would turn it into -1. The UNORM clamp already gives 0.
+		x = _mm_and_ps(x, _mm_cmpord_ps(x, x));
+		return _mm_cvtps_epi32(_mm_mul_ps(_Clamp(x, _mm_set1_ps(-1.0f), _mm_set1_ps(1.0f)), _mm_set1_ps(32767.0f)));
+	}
+
+	static FORCEINLINE __m128i _FloatToUnorm(__m128 x, float scale)
+	{
+		return _mm_cvtps_epi32(_mm_mul_ps(_Clamp(x, _mm_setzero_ps(), _mm_set1_ps(1.0f)), _mm_set1_ps(scale)));
+	}
+
+	static FORCEINLINE __m128 _UnormToFloat(__m128i x, uint32 mask, float scale)
+	{
+		return _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(x, _mm_set1_epi32(mask))), _mm_set1_ps(1.0f / scale));
+	}
+
+	template<typename InType, typename OutType>
+	using FHalfConvertFunction = void(const InType* in, OutType* out, std::size_t count) noexcept;
+
+	static void FloatToHalfScalar(const float* in, uint16* out, std::size_t count) noexcept
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			out[i] = FMath::FloatToHalf(in[i]);
+		}
+	}
+
+	static void HalfToFloatScalar(const uint16* in, float* out, std::size_t count) noexcept
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			out[i] = FMath::HalfToFloat(in[i]);
+		}
+	}
+
+DASH_TARGET_AVX2_BEGIN
+	static void FloatToHalfF16C(const float* in, uint16* out, std::size_t count) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+		}
+
+		for (; i < count; ++i)
+		{
+			out[i] = static_cast<uint16>(_mm_cvtsi128_si32(_mm_cvtps_ph(_mm_set_ss(in[i]), _MM_FROUND_TO_NEAREST_INT)));
+		}
+	}
+
+	static void HalfToFloatF16C(const uint16* in, float* out, std::size_t count) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			_mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))));
+		}
+
+		for (; i < count; ++i)
+		{
+			out[i] = _mm_cvtss_f32(_mm_cvtph_ps(_mm_cvtsi32_si128(in[i])));
+		}
+	}
+DASH_TARGET_END
+
+	namespace FMath
+	{
+		uint16 FloatToHalf(float value) noexcept
+		{
+			// Round to nearest even, after F. Giesen's float_to_half_fast3_rtne.
+			uint32 f = std::bit_cast<uint32>(value);
+			const uint32 sign = f & 0x80000000u;
+			f ^= sign;
+
+			uint32 result;
+			if (f >= 0x47800000u)
+			{
+				// Overflow to inf, NaN stays a quiet NaN.
+				result = f > 0x7f800000u ? 0x7e00u : 0x7c00u;
+			}
+			else if (f < 0x38800000u)
+			{
+				// Denormal or zero, the float add performs the rounding.
+				const uint32 denormMagic = ((127 - 15) + (23 - 10) + 1) << 23;
+				result = std::bit_cast<uint32>(std::bit_cast<float>(f) + std::bit_cast<float>(denormMagic)) - denormMagic;
+			}
+			else
+			{
+				const uint32 mantissaOdd = (f >> 13) & 1;
+				f += (uint32(15 - 127) << 23) + 0xfff;
+				f += mantissaOdd;
+				result = f >> 13;
+			}
+
+			return static_cast<uint16>(result | (sign >> 16));
+		}
+
+		float HalfToFloat(uint16 value) noexcept
+		{
+			const uint32 shiftedExp = 0x7c00u << 13;
+			const float magic = std::bit_cast<float>(113u << 23);
+
+			uint32 f = (value & 0x7fffu) << 13;
+			const uint32 exp = shiftedExp & f;
+			f += (127 - 15) << 23;
+
+			if (exp == shiftedExp)
+			{
+				// Inf / NaN.
+				f += (128 - 16) << 23;
+			}
+			else if (exp == 0)
+			{
+				// Zero / denormal, renormalized through the float unit.
+				f += 1 << 23;
+				f = std::bit_cast<uint32>(std::bit_cast<float>(f) - magic);
+			}
+
+			return std::bit_cast<float>(f | (uint32(value & 0x8000u) << 16));
+		}
+
+		void FloatToHalf(std::span<const float> in, std::span<uint16> out) noexcept
+		{
+			ASSERT(in.size() <= out.size());
+
+			static FHalfConvertFunction<float, uint16>* const Function = SelectCpuFunction<FHalfConvertFunction<float, uint16>>({
+				{ ECpuIsa::AVX2, &FloatToHalfF16C },
+				{ ECpuIsa::SSE2, &FloatToHalfScalar },
+			});
+
+			Function(in.data(), out.data(), in.size());
+		}
+
+		void HalfToFloat(std::span<const uint16> in, std::span<float> out) noexcept
+		{
+			ASSERT(in.size() <= out.size());
+
+			static FHalfConvertFunction<uint16, float>* const Function = SelectCpuFunction<FHalfConvertFunction<uint16, float>>({
+				{ ECpuIsa::AVX2, &HalfToFloatF16C },
+				{ ECpuIsa::SSE2, &HalfToFloatScalar },
+			});
+
+			Function(in.data(), out.data(), in.size());
+		}
+
+		void FloatToSnorm16(std::span<const float> in, std::span<int16> out) noexcept
+		{
+			ConvertStream<8>(in, out, [](const float* src, int16* dst)
+			{
+				__m128i low = _FloatToSnorm16(_mm_loadu_ps(src));
+				__m128i high = _FloatToSnorm16(_mm_loadu_ps(src + 4));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packs_epi32(low, high));
+			});
+		}
+
+		void Snorm16ToFloat(std::span<const int16> in, std::span<float> out) noexcept
+		{
+			ConvertStream<8>(in, out, [](const int16* src, float* dst)
+			{
+				__m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+				_mm_storeu_ps(dst, _HighSnorm16ToFloat(_mm_unpacklo_epi16(packed, packed)));
+				_mm_storeu_ps(dst + 4, _HighSnorm16ToFloat(_mm_unpackhi_epi16(packed, packed)));
+			});
+		}
+
+		void FloatToUnorm8(std::span<const float> in, std::span<uint8> out) noexcept
+		{
+			ConvertStream<16>(in, out, [](const float* src, uint8* dst)
+			{
+				__m128i a = _mm_packs_epi32(_FloatToUnorm(_mm_loadu_ps(src), 255.0f), _FloatToUnorm(_mm_loadu_ps(src + 4), 255.0f));
+				__m128i b = _mm_packs_epi32(_FloatToUnorm(_mm_loadu_ps(src + 8), 255.0f), _FloatToUnorm(_mm_loadu_ps(src + 12), 255.0f));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(a, b));
+			});
+		}
+
+		void Unorm8ToFloat(std::span<const uint8> in, std::span<float> out) noexcept
+		{
+			ConvertStream<16>(in, out, [](const uint8* src, float* dst)
+			{
+				const __m128i zero = _mm_setzero_si128();
+				const __m128 scale = _mm_set1_ps(1.0f / 255.0f);
+
+				__m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+				__m128i low = _mm_unpacklo_epi8(packed, zero);
+				__m128i high = _mm_unpackhi_epi8(packed, zero);
+
+				_mm_storeu_ps(dst, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero)), scale));
+				_mm_storeu_ps(dst + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero)), scale));
+				_mm_storeu_ps(dst + 8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)), scale));
+				_mm_storeu_ps(dst + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)), scale));
+			});
+		}
+
+		void PackR10G10B10A2(std::span<const FVector4f> in, std::span<uint32> out) noexcept
+		{
+			ConvertStream<4>(in, out, [](const FVector4f* src, uint32* dst)
+			{
+				const float* p = reinterpret_cast<const float*>(src);
+				__m128 x = _mm_loadu_ps(p);
+				__m128 y = _mm_loadu_ps(p + 4);
+				__m128 z = _mm_loadu_ps(p + 8);
+				__m128 w = _mm_loadu_ps(p + 12);
+				_MM_TRANSPOSE4_PS(x, y, z, w);
+
+				__m128i packed = _FloatToUnorm(x, 1023.0f);
+				packed = _mm_or_si128(packed, _mm_slli_epi32(_FloatToUnorm(y, 1023.0f), 10));
+				packed = _mm_or_si128(packed, _mm_slli_epi32(_FloatToUnorm(z, 1023.0f), 20));
+				packed = _mm_or_si128(packed, _mm_slli_epi32(_FloatToUnorm(w, 3.0f), 30));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), packed);
+			});
+		}
+
+		void UnpackR10G10B10A2(std::span<const uint32> in, std::span<FVector4f> out) noexcept
+		{
+			ConvertStream<4>(in, out, [](const uint32* src, FVector4f* dst)
+			{
+				__m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+
+				__m128 x = _UnormToFloat(packed, 0x3ff, 1023.0f);
+				__m128 y = _UnormToFloat(_mm_srli_epi32(packed, 10), 0x3ff, 1023.0f);
+				__m128 z = _UnormToFloat(_mm_srli_epi32(packed, 20), 0x3ff, 1023.0f);
+				__m128 w = _UnormToFloat(_mm_srli_epi32(packed, 30), 0x3, 3.0f);
+				_MM_TRANSPOSE4_PS(x, y, z, w);
+
+				float* p = reinterpret_cast<float*>(dst);
+				_mm_storeu_ps(p, x);
+				_mm_storeu_ps(p + 4, y);
+				_mm_storeu_ps(p + 8, z);
+				_mm_storeu_ps(p + 12, w);
+			});
+		}
+
+		void EncodeOctahedralNormals(std::span<const FVector3f> in, std::span<uint32> out) noexcept
+		{
+			ConvertStream<4>(in, out, [](const FVector3f* src, uint32* dst)
+			{
+				__m128 x, y, z, u, v;
+				_LoadVector3x4(reinterpret_cast<const float*>(src), x, y, z);
+				_OctahedralEncode(x, y, z, u, v);
+
+				__m128i packed = _mm_and_si128(_FloatToSnorm16(u), _mm_set1_epi32(0xffff));
+				packed = _mm_or_si128(packed, _mm_slli_epi32(_FloatToSnorm16(v), 16));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), packed);
+			});
+		}
+
+		void DecodeOctahedralNormals(std::span<const uint32> in, std::span<FVector3f> out) noexcept
+		{
+			ConvertStream<4>(in, out, [](const uint32* src, FVector3f* dst)
+			{
+				__m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+
+				__m128 x, y, z;
+				_OctahedralDecode(_LowSnorm16ToFloat(packed), _HighSnorm16ToFloat(packed), x, y, z);
+				_StoreVector3x4(reinterpret_cast<float*>(dst), x, y, z);
+			});
+		}
+
+		void PackTangents(std::span<const FVector4f> in, std::span<uint32> out) noexcept
+		{
+			ConvertStream<4>(in, out, [](const FVector4f* src, uint32* dst)
+			{
+				const float* p = reinterpret_cast<const float*>(src);
+				__m128 x = _mm_loadu_ps(p);
+				__m128 y = _mm_loadu_ps(p + 4);
+				__m128 z = _mm_loadu_ps(p + 8);
+				__m128 w = _mm_loadu_ps(p + 12);
+				_MM_TRANSPOSE4_PS(x, y, z, w);
+
+				__m128 u, v;
+				_OctahedralEncode(x, y, z, u, v);
+
+				const __m128 half = _mm_set1_ps(0.5f);
+				__m128i packed = _FloatToUnorm(_mm_add_ps(_mm_mul_ps(u, half), half), 65535.0f);
+				packed = _mm_or_si128(packed, _mm_slli_epi32(_FloatToUnorm(_mm_add_ps(_mm_mul_ps(v, half), half), 32767.0f), 16));
+				packed = _mm_or_si128(packed, _mm_slli_epi32(_mm_castps_si128(_mm_cmplt_ps(w, _mm_setzero_ps())), 31));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), packed);
+			});
+		}
+
+		void UnpackTangents(std::span<const uint32> in, std::span<FVector4f> out) noexcept
+		{
+			ConvertStream<4>(in, out, [](const uint32* src, FVector4f* dst)
+			{
+				const __m128 one = _mm_set1_ps(1.0f);
+				const __m128 two = _mm_set1_ps(2.0f);
+
+				__m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+				__m128 u = _mm_sub_ps(_mm_mul_ps(_UnormToFloat(packed, 0xffff, 65535.0f), two), one);
+				__m128 v = _mm_sub_ps(_mm_mul_ps(_UnormToFloat(_mm_srli_epi32(packed, 16), 0x7fff, 32767.0f), two), one);
+
+				__m128 x, y, z;
+				_OctahedralDecode(u, v, x, y, z);
+
+				// Bit 31 moved into the float sign bit of 1.0.
+				__m128 w = _mm_or_ps(one, _mm_castsi128_ps(_mm_slli_epi32(_mm_srli_epi32(packed, 31), 31)));
+				_MM_TRANSPOSE4_PS(x, y, z, w);
+
+				float* p = reinterpret_cast<float*>(dst);
+				_mm_storeu_ps(p, x);
+				_mm_storeu_ps(p + 4, y);
+				_mm_storeu_ps(p + 8, z);
+				_mm_storeu_ps(p + 12, w);
+			});
+		}
+	}
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "MathType.h"
+
+#include <span>
+
+namespace Dash
+{
+	// Conversions between float data and the compact formats used for vertex and instance streams.
+	// Rounding is to nearest, out of range inputs are clamped (saturated) to the format range. The normalized
+	// formats convert NaN to 0, as D3D does.
+	//
+	//   Half          IEEE binary16, round to nearest even, keeps inf / NaN / denormals
+	//   SNORM16       round(clamp(x, -1, 1) * 32767), -32768 decodes to -1 as in D3D
+	//   UNORM8        round(clamp(x, 0, 1) * 255)
+	//   R10G10B10A2   UNORM, x | y << 10 | z << 20 | w << 30 (DXGI_FORMAT_R10G10B10A2_UNORM)
+	//   Octahedral    unit normal folded onto the octahedron, two SNORM16 in one uint32 (u in the low half)
+	//   Tangent       octahedral tangent as UNORM16 u | UNORM15 v << 16 | bitangent sign << 31 (set when w < 0)
+	//
+	// The span versions use F16C for half conversions when FCpuFeatures reports AVX2 and SSE2 otherwise,
+	// out must be at least as large as the input.
+
+	// Non-member Function
+
+	// --Declaration-- //
+
+	namespace FMath
+	{
+		uint16 FloatToHalf(float value) noexcept;
+		float HalfToFloat(uint16 value) noexcept;
+
+		void FloatToHalf(std::span<const float> in, std::span<uint16> out) noexcept;
+		void HalfToFloat(std::span<const uint16> in, std::span<float> out) noexcept;
+
+		void FloatToSnorm16(std::span<const float> in, std::span<int16> out) noexcept;
+		void Snorm16ToFloat(std::span<const int16> in, std::span<float> out) noexcept;
+
+		void FloatToUnorm8(std::span<const float> in, std::span<uint8> out) noexcept;
+		void Unorm8ToFloat(std::span<const uint8> in, std::span<float> out) noexcept;
+
+		void PackR10G10B10A2(std::span<const FVector4f> in, std::span<uint32> out) noexcept;
+		void UnpackR10G10B10A2(std::span<const uint32> in, std::span<FVector4f> out) noexcept;
+
+		void EncodeOctahedralNormals(std::span<const FVector3f> in, std::span<uint32> out) noexcept;
+		void DecodeOctahedralNormals(std::span<const uint32> in, std::span<FVector3f> out) noexcept;
+
+		void PackTangents(std::span<const FVector4f> in, std::span<uint32> out) noexcept;
+		void UnpackTangents(std::span<const uint32> in, std::span<FVector4f> out) noexcept;
+	}
+}
@@ -394,7 +394,7 @@ namespace Dash
 		template<typename Scalar>
 		FORCEINLINE TScalarQuaternion<Scalar> Inverse(const TScalarQuaternion<Scalar>& q) noexcept
 		{
-			Scalar invLength = Scalar(1) / Length(q);
+			Scalar invLength = Scalar(1) / Sqrt(Dot(q, q));
 			ASSERT(IsPositive(invLength));
 			return TScalarQuaternion<Scalar>(-q.X * invLength, -q.Y * invLength, -q.Z * invLength, q.W * invLength);
 		}
@@ -580,9 +580,9 @@ namespace Dash
 				Scalar d = Sqrt(t + Scalar{ 1 });
 				Scalar s = Scalar(0.5) / d;
 
-				return TScalarQuaternion<Scalar>{(a[2][1] - a[1][2])* s,
-					(a[0][2] - a[2][0])* s,
-					(a[1][0] - a[0][1])* s,
+				return TScalarQuaternion<Scalar>{(a[1][2] - a[2][1])* s,
+					(a[2][0] - a[0][2])* s,
+					(a[0][1] - a[1][0])* s,
 					d* Scalar{ 0.5 }};
 			}
 			else
@@ -599,7 +599,7 @@ namespace Dash
 				result[i] = d * Scalar{ 0.5 };
 				result[j] = (a[j][i] + a[i][j]) * s;
 				result[k] = (a[k][i] + a[i][k]) * s;
-				result[3] = (a[k][j] - a[j][k]) * s;
+				result[3] = (a[j][k] - a[k][j]) * s;
 
 				return result;
 			}
@@ -648,7 +648,7 @@ namespace Dash
 		template<typename Scalar>
 		FORCEINLINE TScalarQuaternion<Scalar> Normalize(const TScalarQuaternion<Scalar>& a) noexcept
 		{
-			Scalar invLength = Scalar(1) / Length(a);
+			Scalar invLength = Scalar(1) / Sqrt(Dot(a, a));
 			return TScalarQuaternion<Scalar>(a.X * invLength, a.Y * invLength, a.Z * invLength, a.W * invLength);
 		}
 
@@ -656,31 +656,32 @@ namespace Dash
 		FORCEINLINE TScalarQuaternion<Scalar> LerpAndNormalize(const TScalarQuaternion<Scalar>& a, const TScalarQuaternion<Scalar>& b, Scalar t) noexcept
 		{
 			Scalar lerpParam = 1 - t;
-			return Normalize(a + TScalarQuaternion<Scalar>{ b.X* lerpParam, b.Y* lerpParam, b.Z* lerpParam, b.W* lerpParam  });
+			return Normalize(TScalarQuaternion<Scalar>(a.X * lerpParam + b.X * t, a.Y * lerpParam + b.Y * t, a.Z * lerpParam + b.Z * t, a.W * lerpParam + b.W * t));
 		}
 
 		template<typename Scalar>
 		FORCEINLINE TScalarQuaternion<Scalar> Slerp(const TScalarQuaternion<Scalar>& a, const TScalarQuaternion<Scalar>& b, Scalar t) noexcept
 		{
-			TScalarArray<Scalar, 4> shortQx{ b };
-			TScalarArray<Scalar, 4> vx{ b };
-			TScalarArray<Scalar, 4> vy{ b };
-			if (LengthSquared(vx - vy) > LengthSquared(vx + vy))
+			// q and -q are the same rotation, interpolate along the shorter arc.
+			Scalar cosTheta = Dot(a, b);
+			TScalarQuaternion<Scalar> shortB = b;
+			if (cosTheta < Scalar(0))
 			{
-				shortQx *= Scalar(-1);
+				cosTheta = -cosTheta;
+				shortB = TScalarQuaternion<Scalar>(-b.X, -b.Y, -b.Z, -b.W);
 			}
 
-			Scalar cosTheta = Dot(vx, shortQx);
-
 			if (cosTheta > Scalar(0.9999))
 			{
-				return LerpAndNormalize(a, TScalarQuaternion{ shortQx }, t);
+				return LerpAndNormalize(a, shortB, t);
 			}
 
 			Scalar theta = ACos(cosTheta);
-			Scalar sinTheta = ASin(theta);
+			Scalar invSinTheta = Scalar(1) / Sin(theta);
+			Scalar wa = Sin((Scalar(1) - t) * theta) * invSinTheta;
+			Scalar wb = Sin(t * theta) * invSinTheta;
 
-			return TScalarQuaternion<Scalar>((vx * Sin(Scalar(1) - t) * theta + shortQx * Sin(t * theta)) / sinTheta);
+			return TScalarQuaternion<Scalar>(a.X * wa + shortB.X * wb, a.Y * wa + shortB.Y * wb, a.Z * wa + shortB.Z * wb, a.W * wa + shortB.W * wb);
 		}
 
 		template<typename Scalar>
@@ -17,10 +17,17 @@ namespace Dash
 
 		TScalarArray<Scalar, 3> operator()(Scalar t) const noexcept;
 
+		// Refreshes InvDirection and Sign, must be called after Direction is modified directly.
+		void UpdateInverseDirection() noexcept;
+
 		TScalarArray<Scalar, 3> Origin;
 		Scalar TMin;
 		TScalarArray<Scalar, 3> Direction;
 		Scalar TMax;
+
+		// Cached for slab tests, Sign[i] is 1 when Direction[i] is negative.
+		TScalarArray<Scalar, 3> InvDirection;
+		TScalarArray<int, 3> Sign;
 	};
 
 
@@ -39,6 +46,7 @@ namespace Dash
 		, TMin(TScalarTraits<Scalar>::Epsilon())
 		, TMax(TScalarTraits<Scalar>::Infinity())
 	{
+		UpdateInverseDirection();
 	}
 
 	template<typename Scalar>
@@ -48,6 +56,7 @@ namespace Dash
 		, Direction(dir)
 		, TMax(tmax)
 	{
+		UpdateInverseDirection();
 	}
 
 	template<typename Scalar>
@@ -56,6 +65,8 @@ namespace Dash
 		, Direction(r.Direction)
 		, TMin(r.TMin)
 		, TMax(r.TMax)
+		, InvDirection(r.InvDirection)
+		, Sign(r.Sign)
 	{
 	}
 
@@ -66,6 +77,8 @@ namespace Dash
 		Direction = r.Direction;
 		TMin = r.TMin;
 		TMax = r.TMax;
+		InvDirection = r.InvDirection;
+		Sign = r.Sign;
 
 		return *this;
 	}
@@ -76,5 +89,15 @@ namespace Dash
 		return Origin + Direction * t;
 	}
 
+	template<typename Scalar>
+	FORCEINLINE void TScalarRay<Scalar>::UpdateInverseDirection() noexcept
+	{
+		for (std::size_t i = 0; i < 3; i++)
+		{
+			InvDirection[i] = Scalar{ 1 } / Direction[i];
+			Sign[i] = InvDirection[i] < Scalar{ 0 } ? 1 : 0;
+		}
+	}
+
 
 }
\ No newline at end of file
@@ -0,0 +1,130 @@
+#include "PCH.h"
+#include "SIMDMath.h"
+
+namespace Dash
+{
+	// Runs a 4 wide kernel over the stream, the tail goes through a zero padded block so every element
+	// sees exactly the same code path.
+	template<typename Kernel>
+	static void TransformStream(std::span<const float> in, std::span<float> out, Kernel&& kernel) noexcept
+	{
+		ASSERT(in.size() <= out.size());
+
+		const std::size_t count = in.size();
+		std::size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm_storeu_ps(out.data() + i, kernel(_mm_loadu_ps(in.data() + i)));
+		}
+
+		if (i < count)
+		{
+			alignas(16) float block[4] = {};
+			std::copy(in.begin() + i, in.end(), block);
+
+			_mm_store_ps(block, kernel(_mm_load_ps(block)));
+			std::copy(block, block + (count - i), out.begin() + i);
+		}
+	}
+
+	template<typename Kernel>
+	static void TransformStream(std::span<const float> a, std::span<const float> b, std::span<float> out, Kernel&& kernel) noexcept
+	{
+		ASSERT(a.size() == b.size() && a.size() <= out.size());
+
+		const std::size_t count = a.size();
+		std::size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm_storeu_ps(out.data() + i, kernel(_mm_loadu_ps(a.data() + i), _mm_loadu_ps(b.data() + i)));
+		}
+
+		if (i < count)
+		{
+			alignas(16) float blockA[4] = {};
+			alignas(16) float blockB[4] = {};
+			std::copy(a.begin() + i, a.end(), blockA);
+			std::copy(b.begin() + i, b.end(), blockB);
+
+			_mm_store_ps(blockA, kernel(_mm_load_ps(blockA), _mm_load_ps(blockB)));
+			std::copy(blockA, blockA + (count - i), out.begin() + i);
+		}
+	}
+
+	namespace FMath
+	{
+		void Sin(std::span<const float> in, std::span<float> out) noexcept
+		{
+			TransformStream(in, out, [](__m128 x) { return _Sin(x); });
+		}
+
+		void Cos(std::span<const float> in, std::span<float> out) noexcept
+		{
+			TransformStream(in, out, [](__m128 x) { return _Cos(x); });
+		}
+
+		void SinCos(std::span<const float> in, std::span<float> outSin, std::span<float> outCos) noexcept
+		{
+			ASSERT(in.size() <= outSin.size() && in.size() <= outCos.size());
+
+			const std::size_t count = in.size();
+			std::size_t i = 0;
+
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 s, c;
+				_SinCos(_mm_loadu_ps(in.data() + i), s, c);
+				_mm_storeu_ps(outSin.data() + i, s);
+				_mm_storeu_ps(outCos.data() + i, c);
+			}
+
+			if (i < count)
+			{
+				alignas(16) float block[4] = {};
+				alignas(16) float blockCos[4];
+				std::copy(in.begin() + i, in.end(), block);
+
+				__m128 s, c;
+				_SinCos(_mm_load_ps(block), s, c);
+				_mm_store_ps(block, s);
+				_mm_store_ps(blockCos, c);
+
+				std::copy(block, block + (count - i), outSin.begin() + i);
+				std::copy(blockCos, blockCos + (count - i), outCos.begin() + i);
+			}
+		}
+
+		void Exp(std::span<const float> in, std::span<float> out) noexcept
+		{
+			TransformStream(in, out, [](__m128 x) { return _Exp(x); });
+		}
+
+		void Log(std::span<const float> in, std::span<float> out) noexcept
+		{
+			TransformStream(in, out, [](__m128 x) { return _Log(x); });
+		}
+
+		void Pow(std::span<const float> base, float exp, std::span<float> out) noexcept
+		{
+			const __m128 e = _mm_set1_ps(exp);
+			TransformStream(base, out, [e](__m128 x) { return _Pow(x, e); });
+		}
+
+		void Pow(std::span<const float> base, std::span<const float> exp, std::span<float> out) noexcept
+		{
+			TransformStream(base, exp, out, [](__m128 x, __m128 e) { return _Pow(x, e); });
+		}
+
+		void ATan2(std::span<const float> y, std::span<const float> x, std::span<float> out) noexcept
+		{
+			TransformStream(y, x, out, [](__m128 a, __m128 b) { return _ATan2(a, b); });
+		}
+
+		void RSqrt(std::span<const float> in, std::span<float> out) noexcept
+		{
+			TransformStream(in, out, [](__m128 x) { return _RSqrt(x); });
+		}
+	}
+}
@@ -0,0 +1,375 @@
+#pragma once
+
+#include <span>
+
+// Polynomial approximations of the transcendental functions, four lanes at a time with SSE2 only.
+//
+// Accuracy against the double precision result rounded to float (measured, default build):
+//   Sin, Cos, SinCos   |x| <= 100        max 2 ulp, up to |x| <= 8192 the absolute error stays below 1e-7
+//   Exp                [-87.3, 88.7]     max 1 ulp
+//   Log                (0, FLT_MAX]      max 1 ulp, denormal inputs are treated as FLT_MIN
+//   Pow                x > 0             relative error below 1e-7 * (1 + |y * ln(x)|)
+//   ATan2              all finite        max 3 ulp
+//   RSqrt              (0, FLT_MAX]      max 4 ulp (hardware estimate plus one Newton step), denormals included
+//
+// With FAST_APPROX defined (the same switch as the rcp division in Vector4_SSE.h) shorter polynomials are used:
+//   Sin, Cos           2e-6 relative     Exp 6e-6 relative     Log 3e-5 absolute
+//   ATan2              2e-4 absolute     RSqrt 4e-4 relative (raw estimate, no Newton step)
+//
+// Exp results below FLT_MIN are flushed to zero. Special values: Sin(+-inf) = Cos(+-inf) = NaN, Exp(+inf) = +inf, Log(0) = -inf,
+// Log(x < 0) = NaN, NaN inputs return NaN. Both builds handle special values the same way.
+
+namespace Dash
+{
+	static FORCEINLINE __m128 _Select(__m128 mask, __m128 a, __m128 b)
+	{
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+	}
+
+	static FORCEINLINE __m128 _Poly(__m128 x, __m128 c0, __m128 c1)
+	{
+		return _mm_add_ps(_mm_mul_ps(c0, x), c1);
+	}
+
+	// Four tightly packed 3D vectors to and from SoA registers:
+	// (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3) <-> (x0 x1 x2 x3) (y0 y1 y2 y3) (z0 z1 z2 z3)
+	static FORCEINLINE void _LoadVector3x4(const float* p, __m128& x, __m128& y, __m128& z) noexcept
+	{
+		__m128 a = _mm_loadu_ps(p);
+		__m128 b = _mm_loadu_ps(p + 4);
+		__m128 c = _mm_loadu_ps(p + 8);
+
+		x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+		y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+	}
+
+	static FORCEINLINE void _StoreVector3x4(float* p, __m128 x, __m128 y, __m128 z) noexcept
+	{
+		__m128 a = _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+		__m128 b = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+		__m128 c = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+
+		_mm_storeu_ps(p, a);
+		_mm_storeu_ps(p + 4, b);
+		_mm_storeu_ps(p + 8, c);
+	}
+
+	static FORCEINLINE void _SinCos(__m128 x, __m128& sinResult, __m128& cosResult)
+	{
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+
+		__m128 ax = _mm_andnot_ps(signMask, x);
+		__m128 sinSign = _mm_and_ps(x, signMask);
+
+		// j = nearest even octant, the reduced argument lies in [-pi / 4, pi / 4].
+		__m128i j = _mm_cvttps_epi32(_mm_mul_ps(ax, _mm_set1_ps(1.27323954473516f)));
+		j = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+		__m128 y = _mm_cvtepi32_ps(j);
+
+		__m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), _mm_set1_epi32(2)));
+		sinSign = _mm_xor_ps(sinSign, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29)));
+		__m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(j, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+
+		// pi / 4 in four parts, the first three short enough that their products with y are exact below |x| = 4096,
+		// so r keeps its relative accuracy next to the zeros of sin and cos.
+		__m128 r = _mm_sub_ps(ax, _mm_mul_ps(y, _mm_set1_ps(0.78515625f)));
+		r = _mm_sub_ps(r, _mm_mul_ps(y, _mm_set1_ps(2.4187564849853515625e-4f)));
+		r = _mm_sub_ps(r, _mm_mul_ps(y, _mm_set1_ps(3.774766810238361358642578125e-8f)));
+		r = _mm_sub_ps(r, _mm_mul_ps(y, _mm_set1_ps(1.2816720341285448e-12f)));
+
+		__m128 z = _mm_mul_ps(r, r);
+
+#ifdef FAST_APPROX
+		__m128 ps = _Poly(z, _mm_set1_ps(0.008163282464439812f), _mm_set1_ps(-0.16663390404655462f));
+		ps = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(ps, z), r), r);
+
+		__m128 pc = _Poly(z, _mm_set1_ps(-0.0013648711210000634f), _mm_set1_ps(0.04166107112682405f));
+#else
+		__m128 ps = _Poly(z, _mm_set1_ps(-1.9515295891e-4f), _mm_set1_ps(8.3321608736e-3f));
+		ps = _Poly(z, ps, _mm_set1_ps(-1.6666654611e-1f));
+		ps = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(ps, z), r), r);
+
+		__m128 pc = _Poly(z, _mm_set1_ps(2.443315711809948e-5f), _mm_set1_ps(-1.388731625493765e-3f));
+		pc = _Poly(z, pc, _mm_set1_ps(4.166664568298827e-2f));
+#endif // FAST_APPROX
+		pc = _mm_mul_ps(_mm_mul_ps(pc, z), z);
+		pc = _mm_add_ps(_mm_sub_ps(pc, _mm_mul_ps(z, _mm_set1_ps(0.5f))), _mm_set1_ps(1.0f));
+
+		// Infinite and NaN inputs have no reduced argument, all bits set gives NaN in both results.
+		__m128 notFinite = _mm_cmpnlt_ps(ax, _mm_set1_ps(TScalarTraits<float>::Infinity()));
+
+		sinResult = _mm_or_ps(_mm_xor_ps(_Select(swap, pc, ps), sinSign), notFinite);
+		cosResult = _mm_or_ps(_mm_xor_ps(_Select(swap, ps, pc), cosSign), notFinite);
+	}
+
+	static FORCEINLINE __m128 _Sin(__m128 x)
+	{
+		__m128 s, c;
+		_SinCos(x, s, c);
+		return s;
+	}
+
+	static FORCEINLINE __m128 _Cos(__m128 x)
+	{
+		__m128 s, c;
+		_SinCos(x, s, c);
+		return c;
+	}
+
+	static FORCEINLINE __m128 _Exp(__m128 x)
+	{
+		const __m128 maxInput = _mm_set1_ps(88.7228391f);
+		const __m128 minInput = _mm_set1_ps(-87.3365447f);
+
+		// x = n * ln2 + r, 2^n is applied in two halves so that n = 128 near overflow and n = -126 near the flush
+		// to zero stay representable, and r stays within [-ln2 / 2, ln2 / 2] over the whole range.
+		__m128 fn = _mm_cvtepi32_ps(_mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(1.44269504088896341f))));
+		fn = _mm_max_ps(_mm_min_ps(fn, _mm_set1_ps(128.0f)), _mm_set1_ps(-126.0f));
+
+		__m128 r = _mm_sub_ps(x, _mm_mul_ps(fn, _mm_set1_ps(0.693359375f)));
+		r = _mm_add_ps(r, _mm_mul_ps(fn, _mm_set1_ps(2.12194440e-4f)));
+
+		__m128 z = _mm_mul_ps(r, r);
+
+#ifdef FAST_APPROX
+		__m128 p = _Poly(r, _mm_set1_ps(0.04127769854333491f), _mm_set1_ps(0.16753515707814476f));
+		p = _Poly(r, p, _mm_set1_ps(0.5000511662569915f));
+#else
+		__m128 p = _Poly(r, _mm_set1_ps(1.9875691500e-4f), _mm_set1_ps(1.3981999507e-3f));
+		p = _Poly(r, p, _mm_set1_ps(8.3334519073e-3f));
+		p = _Poly(r, p, _mm_set1_ps(4.1665795894e-2f));
+		p = _Poly(r, p, _mm_set1_ps(1.6666665459e-1f));
+		p = _Poly(r, p, _mm_set1_ps(5.0000001201e-1f));
+#endif // FAST_APPROX
+		p = _mm_add_ps(_mm_add_ps(_mm_mul_ps(p, z), r), _mm_set1_ps(1.0f));
+
+		__m128i n = _mm_cvttps_epi32(fn);
+		__m128i n1 = _mm_srai_epi32(n, 1);
+		__m128i n2 = _mm_sub_epi32(n, n1);
+		__m128 pow2n1 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n1, _mm_set1_epi32(127)), 23));
+		__m128 pow2n2 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n2, _mm_set1_epi32(127)), 23));
+		__m128 result = _mm_mul_ps(_mm_mul_ps(p, pow2n1), pow2n2);
+
+		result = _Select(_mm_cmpgt_ps(x, maxInput), _mm_set1_ps(TScalarTraits<float>::Infinity()), result);
+		result = _Select(_mm_cmplt_ps(x, minInput), _mm_setzero_ps(), result);
+		return _Select(_mm_cmpunord_ps(x, x), x, result);
+	}
+
+	static FORCEINLINE __m128 _Log(__m128 x)
+	{
+		__m128 input = x;
+		x = _mm_max_ps(x, _mm_set1_ps(std::numeric_limits<float>::min()));
+
+		// x = m * 2^e with m in [0.5, 1).
+		__m128i bits = _mm_castps_si128(x);
+		__m128 e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126)));
+		__m128 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f000000)));
+
+		// Move m into [sqrt(1/2), sqrt(2)) and take m - 1.
+		__m128 small = _mm_cmplt_ps(m, _mm_set1_ps(0.707106781186547524f));
+		e = _mm_sub_ps(e, _mm_and_ps(small, _mm_set1_ps(1.0f)));
+		m = _mm_sub_ps(_mm_add_ps(m, _mm_and_ps(small, m)), _mm_set1_ps(1.0f));
+
+		__m128 z = _mm_mul_ps(m, m);
+
+#ifdef FAST_APPROX
+		__m128 p = _Poly(m, _mm_set1_ps(0.1784005469231712f), _mm_set1_ps(-0.26991332051454464f));
+		p = _Poly(m, p, _mm_set1_ps(0.33570772913904334f));
+		__m128 y = _mm_mul_ps(_mm_mul_ps(p, m), z);
+		y = _mm_add_ps(y, _mm_mul_ps(z, _mm_set1_ps(-0.49953596725149035f)));
+#else
+		__m128 p = _Poly(m, _mm_set1_ps(7.0376836292e-2f), _mm_set1_ps(-1.1514610310e-1f));
+		p = _Poly(m, p, _mm_set1_ps(1.1676998740e-1f));
+		p = _Poly(m, p, _mm_set1_ps(-1.2420140846e-1f));
+		p = _Poly(m, p, _mm_set1_ps(1.4249322787e-1f));
+		p = _Poly(m, p, _mm_set1_ps(-1.6668057665e-1f));
+		p = _Poly(m, p, _mm_set1_ps(2.0000714765e-1f));
+		p = _Poly(m, p, _mm_set1_ps(-2.4999993993e-1f));
+		p = _Poly(m, p, _mm_set1_ps(3.3333331174e-1f));
+		__m128 y = _mm_mul_ps(_mm_mul_ps(p, m), z);
+		y = _mm_sub_ps(y, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+#endif // FAST_APPROX
+		y = _mm_sub_ps(y, _mm_mul_ps(e, _mm_set1_ps(2.12194440e-4f)));
+
+		__m128 result = _mm_add_ps(_mm_add_ps(m, y), _mm_mul_ps(e, _mm_set1_ps(0.693359375f)));
+
+		result = _Select(_mm_cmpeq_ps(input, _mm_set1_ps(TScalarTraits<float>::Infinity())), input, result);
+		result = _Select(_mm_cmpeq_ps(input, _mm_setzero_ps()), _mm_set1_ps(-TScalarTraits<float>::Infinity()), result);
+		result = _Select(_mm_cmplt_ps(input, _mm_setzero_ps()), _mm_set1_ps(std::numeric_limits<float>::quiet_NaN()), result);
+		return _Select(_mm_cmpunord_ps(input, input), input, result);
+	}
+
+	// exp(y * log(x)). The error of log is scaled by |y * log(x)|, so large results lose accuracy.
+	// x == 0 gives 0 for y > 0 and +inf for y < 0, y == 0 gives 1, negative bases give NaN.
+	static FORCEINLINE __m128 _Pow(__m128 x, __m128 y)
+	{
+		__m128 result = _Exp(_mm_mul_ps(y, _Log(x)));
+		return _Select(_mm_cmpeq_ps(y, _mm_setzero_ps()), _mm_set1_ps(1.0f), result);
+	}
+
+	static FORCEINLINE __m128 _ATan2(__m128 y, __m128 x)
+	{
+		// pi / 2 and pi as float plus the rounding error of the float, which the mirroring below adds back.
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		const __m128 halfPi = _mm_set1_ps(1.57079632679489661923f);
+		const __m128 halfPiLow = _mm_set1_ps(-4.3711388287e-8f);
+		const __m128 pi = _mm_set1_ps(3.14159265358979323846f);
+		const __m128 piLow = _mm_set1_ps(-8.7422776573e-8f);
+
+		__m128 ax = _mm_andnot_ps(signMask, x);
+		__m128 ay = _mm_andnot_ps(signMask, y);
+		__m128 maxAbs = _mm_max_ps(ax, ay);
+		__m128 minAbs = _mm_min_ps(ax, ay);
+
+		// t in [0, 1], atan(t) is mirrored into the full circle below.
+#ifdef FAST_APPROX
+		__m128 t = _mm_mul_ps(minAbs, _mm_rcp_ps(maxAbs));
+		t = _mm_andnot_ps(_mm_cmpeq_ps(maxAbs, _mm_setzero_ps()), t);
+		__m128 z = _mm_mul_ps(t, t);
+
+		__m128 p = _Poly(z, _mm_set1_ps(-0.013954793661743521f), _mm_set1_ps(0.058769518621811685f));
+		p = _Poly(z, p, _mm_set1_ps(-0.12251440888781148f));
+		p = _Poly(z, p, _mm_set1_ps(0.19618290079230602f));
+		p = _Poly(z, p, _mm_set1_ps(-0.3330889815667246f));
+		__m128 a = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(p, z), t), t);
+#else
+		__m128 t = _mm_div_ps(minAbs, maxAbs);
+		t = _mm_andnot_ps(_mm_cmpeq_ps(maxAbs, _mm_setzero_ps()), t);
+
+		// Above tan(pi / 8) use atan(t) = pi / 4 + atan((t - 1) / (t + 1)).
+		__m128 reduce = _mm_cmpgt_ps(t, _mm_set1_ps(0.4142135623730950f));
+		t = _Select(reduce, _mm_div_ps(_mm_sub_ps(t, _mm_set1_ps(1.0f)), _mm_add_ps(t, _mm_set1_ps(1.0f))), t);
+		__m128 z = _mm_mul_ps(t, t);
+
+		__m128 p = _Poly(z, _mm_set1_ps(8.05374449538e-2f), _mm_set1_ps(-1.38776856032e-1f));
+		p = _Poly(z, p, _mm_set1_ps(1.99777106478e-1f));
+		p = _Poly(z, p, _mm_set1_ps(-3.33329491539e-1f));
+		__m128 a = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(p, z), t), t);
+		a = _mm_add_ps(_mm_add_ps(a, _mm_and_ps(reduce, _mm_set1_ps(-2.1855694143e-8f))), _mm_and_ps(reduce, _mm_set1_ps(0.78539816339744830962f)));
+#endif // FAST_APPROX
+
+		a = _Select(_mm_cmpgt_ps(ay, ax), _mm_add_ps(_mm_sub_ps(halfPi, a), halfPiLow), a);
+
+		__m128 xNegative = _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(x), 31));
+		a = _Select(xNegative, _mm_add_ps(_mm_sub_ps(pi, a), piLow), a);
+
+		return _mm_or_ps(a, _mm_and_ps(y, signMask));
+	}
+
+	static FORCEINLINE __m128 _RSqrt(__m128 x)
+	{
+		// The estimate reads denormals as zero, so they are scaled by 2^24 into the normal range and the result by 2^12.
+		__m128 denormal = _mm_and_ps(_mm_cmpgt_ps(x, _mm_setzero_ps()), _mm_cmplt_ps(x, _mm_set1_ps(std::numeric_limits<float>::min())));
+		x = _Select(denormal, _mm_mul_ps(x, _mm_set1_ps(16777216.0f)), x);
+		__m128 scale = _Select(denormal, _mm_set1_ps(4096.0f), _mm_set1_ps(1.0f));
+
+		__m128 r = _mm_rsqrt_ps(x);
+
+#ifdef FAST_APPROX
+		return _mm_mul_ps(r, scale);
+#else
+		// r' = r * (1.5 - 0.5 * x * r * r), zero / infinite / negative inputs keep the estimate (inf / 0 / NaN).
+		__m128 newton = _mm_mul_ps(r, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(x, r), _mm_mul_ps(r, _mm_set1_ps(0.5f)))));
+		__m128 valid = _mm_and_ps(_mm_cmpgt_ps(x, _mm_setzero_ps()), _mm_cmplt_ps(x, _mm_set1_ps(TScalarTraits<float>::Infinity())));
+		return _mm_mul_ps(_Select(valid, newton, r), scale);
+#endif // FAST_APPROX
+	}
+
+
+
+
+
+
+	// Non-member Function
+
+	// --Declaration-- //
+
+	namespace FMath
+	{
+		// Batch versions over spans, out must be at least as large as the input and may alias it.
+		void Sin(std::span<const float> in, std::span<float> out) noexcept;
+		void Cos(std::span<const float> in, std::span<float> out) noexcept;
+		void SinCos(std::span<const float> in, std::span<float> outSin, std::span<float> outCos) noexcept;
+		void Exp(std::span<const float> in, std::span<float> out) noexcept;
+		void Log(std::span<const float> in, std::span<float> out) noexcept;
+		void Pow(std::span<const float> base, float exp, std::span<float> out) noexcept;
+		void Pow(std::span<const float> base, std::span<const float> exp, std::span<float> out) noexcept;
+		void ATan2(std::span<const float> y, std::span<const float> x, std::span<float> out) noexcept;
+		void RSqrt(std::span<const float> in, std::span<float> out) noexcept;
+
+#ifdef USE_SSE
+		TScalarArray<float, 4> Sin(const TScalarArray<float, 4>& v) noexcept;
+		TScalarArray<float, 4> Cos(const TScalarArray<float, 4>& v) noexcept;
+		void SinCos(const TScalarArray<float, 4>& v, TScalarArray<float, 4>& outSin, TScalarArray<float, 4>& outCos) noexcept;
+		TScalarArray<float, 4> Exp(const TScalarArray<float, 4>& v) noexcept;
+		TScalarArray<float, 4> Log(const TScalarArray<float, 4>& v) noexcept;
+		TScalarArray<float, 4> Pow(const TScalarArray<float, 4>& base, float exp) noexcept;
+		TScalarArray<float, 4> Pow(const TScalarArray<float, 4>& base, const TScalarArray<float, 4>& exp) noexcept;
+		TScalarArray<float, 4> ATan2(const TScalarArray<float, 4>& y, const TScalarArray<float, 4>& x) noexcept;
+		TScalarArray<float, 4> RSqrt(const TScalarArray<float, 4>& v) noexcept;
+#endif // USE_SSE
+	}
+
+
+
+
+
+
+	// Non-member Function
+
+	// --Implementation-- //
+
+#ifdef USE_SSE
+	namespace FMath
+	{
+		FORCEINLINE TScalarArray<float, 4> Sin(const TScalarArray<float, 4>& v) noexcept
+		{
+			return TScalarArray<float, 4>{ _Sin(v.mVec) };
+		}
+
+		FORCEINLINE TScalarArray<float, 4> Cos(const TScalarArray<float, 4>& v) noexcept
+		{
+			return TScalarArray<float, 4>{ _Cos(v.mVec) };
+		}
+
+		FORCEINLINE void SinCos(const TScalarArray<float, 4>& v, TScalarArray<float, 4>& outSin, TScalarArray<float, 4>& outCos) noexcept
+		{
+			__m128 s, c;
+			_SinCos(v.mVec, s, c);
+			outSin = s;
+			outCos = c;
+		}
+
+		FORCEINLINE TScalarArray<float, 4> Exp(const TScalarArray<float, 4>& v) noexcept
+		{
+			return TScalarArray<float, 4>{ _Exp(v.mVec) };
+		}
+
+		FORCEINLINE TScalarArray<float, 4> Log(const TScalarArray<float, 4>& v) noexcept
+		{
+			return TScalarArray<float, 4>{ _Log(v.mVec) };
+		}
+
+		FORCEINLINE TScalarArray<float, 4> Pow(const TScalarArray<float, 4>& base, float exp) noexcept
+		{
+			return TScalarArray<float, 4>{ _Pow(base.mVec, _mm_set1_ps(exp)) };
+		}
+
+		FORCEINLINE TScalarArray<float, 4> Pow(const TScalarArray<float, 4>& base, const TScalarArray<float, 4>& exp) noexcept
+		{
+			return TScalarArray<float, 4>{ _Pow(base.mVec, exp.mVec) };
+		}
+
+		FORCEINLINE TScalarArray<float, 4> ATan2(const TScalarArray<float, 4>& y, const TScalarArray<float, 4>& x) noexcept
+		{
+			return TScalarArray<float, 4>{ _ATan2(y.mVec, x.mVec) };
+		}
+
+		FORCEINLINE TScalarArray<float, 4> RSqrt(const TScalarArray<float, 4>& v) noexcept
+		{
+			return TScalarArray<float, 4>{ _RSqrt(v.mVec) };
+		}
+	}
+#endif // USE_SSE
+}
@@ -1055,3 +1055,5 @@ namespace Dash
 #include "Vector4_SSE.h"
 #endif // USE_SSE
 
+#include "SIMDMath.h"
+
@@ -586,4 +586,8 @@ namespace Dash
 }
 
 #include "Matrix3x3.h"
-#include "Matrix4x4.h"
\ No newline at end of file
+#include "Matrix4x4.h"
+
+#ifdef USE_SSE
+#include "Matrix4x4_SSE.h"
+#endif // USE_SSE
\ No newline at end of file
@@ -248,7 +248,7 @@ namespace Dash
 	FORCEINLINE FTransform& FTransform::operator*=(const FTransform& t) noexcept
 	{
 		mMatrix *= t.mMatrix;
-		mInverseMatrix = FMath::Inverse(mMatrix);
+		mInverseMatrix = FMath::InverseAffine(mMatrix);
 		mDirty = false;
 
 		FMath::DecomposeAffineMatrix4x4(mScale, mRotation, mPosition, mMatrix);
@@ -348,7 +348,7 @@ namespace Dash
 		mMatrix.SetRow(2, look);
 		mMatrix.SetRow(3, eye);
 
-		mInverseMatrix = FMath::Inverse(mMatrix);
+		mInverseMatrix = FMath::InverseAffine(mMatrix);
 
 		FMath::DecomposeAffineMatrix4x4(mScale, mRotation, mPosition, mMatrix);
 
@@ -572,7 +572,7 @@ namespace Dash
 		if (mDirty)
 		{
 			mMatrix = FMath::ScaleMatrix4x4<float>(mScale) * FMath::RotateMatrix4x4<float>(mRotation) * FMath::TranslateMatrix4x4<float>(mPosition);
-			mInverseMatrix = FMath::Inverse(mMatrix);
+			mInverseMatrix = FMath::InverseAffine(mMatrix);
 			mDirty = false;
 		}
 	}
@@ -0,0 +1,131 @@
+#include "PCH.h"
+#include "TransformHierarchy.h"
+#include "Utility/ParallelAlgorithms.h"
+
+namespace Dash
+{
+	int32 FTransformHierarchy::Add(const FTransformTRS& local, int32 parent)
+	{
+		const int32 index = static_cast<int32>(mLocal.size());
+		ASSERT(parent < index);
+
+		mLocal.push_back(local);
+		mParent.push_back(parent);
+		mWorld.emplace_back(FIdentity{});
+		mDirty.push_back(1);
+		mAnyDirty = true;
+
+		return index;
+	}
+
+	void FTransformHierarchy::Reserve(std::size_t count)
+	{
+		mLocal.reserve(count);
+		mParent.reserve(count);
+		mWorld.reserve(count);
+		mDirty.reserve(count);
+	}
+
+	void FTransformHierarchy::Clear()
+	{
+		mLocal.clear();
+		mParent.clear();
+		mWorld.clear();
+		mDirty.clear();
+		mAnyDirty = false;
+	}
+
+	void FTransformHierarchy::SetLocalTransform(int32 index, const FTransformTRS& local)
+	{
+		mLocal[index] = local;
+		mDirty[index] = 1;
+		mAnyDirty = true;
+	}
+
+	void FTransformHierarchy::UpdateWorldMatrices()
+	{
+		if (!mAnyDirty)
+		{
+			return;
+		}
+
+		const std::size_t count = mLocal.size();
+		if (count < ParallelUpdateMinSize)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const int32 parent = mParent[i];
+
+				// Parents come first, so their flag already includes every modified ancestor.
+				if (parent != InvalidIndex)
+				{
+					mDirty[i] |= mDirty[parent];
+				}
+
+				if (mDirty[i])
+				{
+					const FAffineMatrix3x4 local = FMath::ToAffineMatrix(mLocal[i]);
+					mWorld[i] = parent == InvalidIndex ? local : FMath::Mul(local, mWorld[parent]);
+				}
+			}
+		}
+		else
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const int32 parent = mParent[i];
+				if (parent != InvalidIndex)
+				{
+					mDirty[i] |= mDirty[parent];
+				}
+			}
+
+			// The local matrices do not depend on each other, they go to the world array first and the
+			// forward pass that follows only has to concatenate them with the parents.
+			ParallelForRange(count, [this](std::size_t begin, std::size_t end)
+			{
+				for (std::size_t i = begin; i < end; ++i)
+				{
+					if (mDirty[i])
+					{
+						mWorld[i] = FMath::ToAffineMatrix(mLocal[i]);
+					}
+				}
+			}, ParallelUpdateMinSize / 2, "UpdateWorldMatrices");
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const int32 parent = mParent[i];
+				if (mDirty[i] && parent != InvalidIndex)
+				{
+					mWorld[i] = FMath::Mul(mWorld[i], mWorld[parent]);
+				}
+			}
+		}
+
+		std::fill(mDirty.begin(), mDirty.end(), uint8(0));
+		mAnyDirty = false;
+	}
+
+	namespace FMath
+	{
+		void ComputeWorldMatrices(std::span<const FTransformTRS> local, std::span<const int32> parent, std::span<FAffineMatrix3x4> world) noexcept
+		{
+			ASSERT(local.size() == parent.size() && world.size() >= local.size());
+
+			for (std::size_t i = 0; i < local.size(); ++i)
+			{
+				const FAffineMatrix3x4 localMatrix = ToAffineMatrix(local[i]);
+				if (parent[i] < 0)
+				{
+					world[i] = localMatrix;
+				}
+				else
+				{
+					ASSERT(static_cast<std::size_t>(parent[i]) < i);
+					world[i] = Mul(localMatrix, world[parent[i]]);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "TransformTRS.h"
+
+#include <span>
+
+namespace Dash
+{
+	// Flat transform hierarchy: local transforms, parent indices and world matrices live in separate contiguous arrays,
+	// so the world matrix update is one forward pass over memory instead of a walk through scattered objects.
+	// Nodes are appended after their parent, which keeps parent[i] < i and lets a single pass resolve every level.
+	class FTransformHierarchy
+	{
+	public:
+		static constexpr int32 InvalidIndex = -1;
+
+		int32 Add(const FTransformTRS& local, int32 parent = InvalidIndex);
+		void Reserve(std::size_t count);
+		void Clear();
+
+		void SetLocalTransform(int32 index, const FTransformTRS& local);
+		const FTransformTRS& GetLocalTransform(int32 index) const { return mLocal[index]; }
+
+		int32 GetParent(int32 index) const { return mParent[index]; }
+		std::size_t GetSize() const { return mLocal.size(); }
+
+		// Recomputes the world matrices of the modified nodes and everything below them.
+		void UpdateWorldMatrices();
+
+		// Valid after UpdateWorldMatrices.
+		const FAffineMatrix3x4& GetWorldMatrix(int32 index) const { return mWorld[index]; }
+		std::span<const FAffineMatrix3x4> GetWorldMatrices() const { return mWorld; }
+
+	private:
+		// Smaller hierarchies are updated in a single pass on the calling thread.
+		static constexpr std::size_t ParallelUpdateMinSize = 4096;
+
+		std::vector<FTransformTRS> mLocal;
+		std::vector<int32> mParent;
+		std::vector<FAffineMatrix3x4> mWorld;
+		std::vector<uint8> mDirty;
+		bool mAnyDirty = false;
+	};
+
+
+
+
+
+
+	// Non-member Function
+
+	// --Declaration-- //
+
+	namespace FMath
+	{
+		// world[i] = local[i] * world[parent[i]], parent[i] is -1 for roots and must be smaller than i.
+		void ComputeWorldMatrices(std::span<const FTransformTRS> local, std::span<const int32> parent, std::span<FAffineMatrix3x4> world) noexcept;
+	}
+}
@@ -0,0 +1,296 @@
+#include "PCH.h"
+#include "TransformStream.h"
+#include "Utility/CpuFeatures.h"
+
+#include <immintrin.h>
+
+namespace Dash
+{
+	static_assert(sizeof(FVector3f) == sizeof(float) * 3, "AoS kernels assume tightly packed FVector3f.");
+
+	// Row-vector affine transform reduced to the 3x4 coefficients the kernels need:
+	// out = in.x * Row[0] + in.y * Row[1] + in.z * Row[2] (+ Row[3] for points).
+	struct FStreamMatrix
+	{
+		float Row[4][3];
+	};
+
+	static FStreamMatrix MakeStreamMatrix(const FMatrix4x4& m, bool translate) noexcept
+	{
+		FStreamMatrix result;
+
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 3; ++j)
+			{
+				result.Row[i][j] = (i < 3 || translate) ? m[i][j] : 0.0f;
+			}
+		}
+
+		return result;
+	}
+
+	static FStreamMatrix MakeNormalStreamMatrix(const FMatrix4x4& m) noexcept
+	{
+		// Same convention as FTransform::TransformNormal: n' = n * transpose(inverse(m)).
+		return MakeStreamMatrix(FMath::Transpose(FMath::InverseAffine(m)), false);
+	}
+
+	static FORCEINLINE void TransformScalar(const FStreamMatrix& m, float x, float y, float z, float& outX, float& outY, float& outZ) noexcept
+	{
+		outX = x * m.Row[0][0] + y * m.Row[1][0] + z * m.Row[2][0] + m.Row[3][0];
+		outY = x * m.Row[0][1] + y * m.Row[1][1] + z * m.Row[2][1] + m.Row[3][1];
+		outZ = x * m.Row[0][2] + y * m.Row[1][2] + z * m.Row[2][2] + m.Row[3][2];
+	}
+
+	struct FStreamMatrix4
+	{
+		explicit FStreamMatrix4(const FStreamMatrix& m) noexcept
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				for (int j = 0; j < 3; ++j)
+				{
+					Row[i][j] = _mm_set1_ps(m.Row[i][j]);
+				}
+			}
+		}
+
+		FORCEINLINE void Transform(__m128& x, __m128& y, __m128& z) const noexcept
+		{
+			__m128 outX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, Row[0][0]), _mm_mul_ps(y, Row[1][0])), _mm_add_ps(_mm_mul_ps(z, Row[2][0]), Row[3][0]));
+			__m128 outY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, Row[0][1]), _mm_mul_ps(y, Row[1][1])), _mm_add_ps(_mm_mul_ps(z, Row[2][1]), Row[3][1]));
+			__m128 outZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, Row[0][2]), _mm_mul_ps(y, Row[1][2])), _mm_add_ps(_mm_mul_ps(z, Row[2][2]), Row[3][2]));
+
+			x = outX;
+			y = outY;
+			z = outZ;
+		}
+
+		__m128 Row[4][3];
+	};
+
+	// Shared SSE2 path, also finishes the tail of the wider kernels from element first on.
+	static void TransformStreamAoS4(const float* in, float* out, std::size_t count, const FStreamMatrix& m, std::size_t first = 0) noexcept
+	{
+		const FStreamMatrix4 m4{ m };
+		std::size_t i = first;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 x, y, z;
+			_LoadVector3x4(in + i * 3, x, y, z);
+
+			m4.Transform(x, y, z);
+
+			_StoreVector3x4(out + i * 3, x, y, z);
+		}
+
+		for (; i < count; ++i)
+		{
+			const float* p = in + i * 3;
+			float* o = out + i * 3;
+			TransformScalar(m, p[0], p[1], p[2], o[0], o[1], o[2]);
+		}
+	}
+
+	static void TransformStreamSoA4(const float* inX, const float* inY, const float* inZ, float* outX, float* outY, float* outZ, std::size_t count, const FStreamMatrix& m, std::size_t first = 0) noexcept
+	{
+		const FStreamMatrix4 m4{ m };
+		std::size_t i = first;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 x = _mm_loadu_ps(inX + i);
+			__m128 y = _mm_loadu_ps(inY + i);
+			__m128 z = _mm_loadu_ps(inZ + i);
+
+			m4.Transform(x, y, z);
+
+			_mm_storeu_ps(outX + i, x);
+			_mm_storeu_ps(outY + i, y);
+			_mm_storeu_ps(outZ + i, z);
+		}
+
+		for (; i < count; ++i)
+		{
+			TransformScalar(m, inX[i], inY[i], inZ[i], outX[i], outY[i], outZ[i]);
+		}
+	}
+
+DASH_TARGET_AVX2_BEGIN
+	struct FStreamMatrix8
+	{
+		explicit FStreamMatrix8(const FStreamMatrix& m) noexcept
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				for (int j = 0; j < 3; ++j)
+				{
+					Row[i][j] = _mm256_set1_ps(m.Row[i][j]);
+				}
+			}
+		}
+
+		FORCEINLINE void Transform(__m256& x, __m256& y, __m256& z) const noexcept
+		{
+			__m256 outX = _mm256_fmadd_ps(x, Row[0][0], _mm256_fmadd_ps(y, Row[1][0], _mm256_fmadd_ps(z, Row[2][0], Row[3][0])));
+			__m256 outY = _mm256_fmadd_ps(x, Row[0][1], _mm256_fmadd_ps(y, Row[1][1], _mm256_fmadd_ps(z, Row[2][1], Row[3][1])));
+			__m256 outZ = _mm256_fmadd_ps(x, Row[0][2], _mm256_fmadd_ps(y, Row[1][2], _mm256_fmadd_ps(z, Row[2][2], Row[3][2])));
+
+			x = outX;
+			y = outY;
+			z = outZ;
+		}
+
+		__m256 Row[4][3];
+	};
+
+	static FORCEINLINE __m256 Combine(__m128 lo, __m128 hi) noexcept
+	{
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+	}
+
+	static void TransformStreamAoS8(const float* in, float* out, std::size_t count, const FStreamMatrix& m) noexcept
+	{
+		const FStreamMatrix8 m8{ m };
+		std::size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128 x0, y0, z0, x1, y1, z1;
+			_LoadVector3x4(in + i * 3, x0, y0, z0);
+			_LoadVector3x4(in + i * 3 + 12, x1, y1, z1);
+
+			__m256 x = Combine(x0, x1);
+			__m256 y = Combine(y0, y1);
+			__m256 z = Combine(z0, z1);
+
+			m8.Transform(x, y, z);
+
+			_StoreVector3x4(out + i * 3, _mm256_castps256_ps128(x), _mm256_castps256_ps128(y), _mm256_castps256_ps128(z));
+			_StoreVector3x4(out + i * 3 + 12, _mm256_extractf128_ps(x, 1), _mm256_extractf128_ps(y, 1), _mm256_extractf128_ps(z, 1));
+		}
+
+		_mm256_zeroupper();
+		TransformStreamAoS4(in, out, count, m, i);
+	}
+
+	static void TransformStreamSoA8(const float* inX, const float* inY, const float* inZ, float* outX, float* outY, float* outZ, std::size_t count, const FStreamMatrix& m) noexcept
+	{
+		const FStreamMatrix8 m8{ m };
+		std::size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 x = _mm256_loadu_ps(inX + i);
+			__m256 y = _mm256_loadu_ps(inY + i);
+			__m256 z = _mm256_loadu_ps(inZ + i);
+
+			m8.Transform(x, y, z);
+
+			_mm256_storeu_ps(outX + i, x);
+			_mm256_storeu_ps(outY + i, y);
+			_mm256_storeu_ps(outZ + i, z);
+		}
+
+		_mm256_zeroupper();
+		TransformStreamSoA4(inX, inY, inZ, outX, outY, outZ, count, m, i);
+	}
+DASH_TARGET_END
+
+DASH_TARGET_AVX512_BEGIN
+	static void TransformStreamSoA16(const float* inX, const float* inY, const float* inZ, float* outX, float* outY, float* outZ, std::size_t count, const FStreamMatrix& m) noexcept
+	{
+		__m512 row[4][3];
+		for (int r = 0; r < 4; ++r)
+		{
+			for (int c = 0; c < 3; ++c)
+			{
+				row[r][c] = _mm512_set1_ps(m.Row[r][c]);
+			}
+		}
+
+		std::size_t i = 0;
+
+		for (; i + 16 <= count; i += 16)
+		{
+			__m512 x = _mm512_loadu_ps(inX + i);
+			__m512 y = _mm512_loadu_ps(inY + i);
+			__m512 z = _mm512_loadu_ps(inZ + i);
+
+			_mm512_storeu_ps(outX + i, _mm512_fmadd_ps(x, row[0][0], _mm512_fmadd_ps(y, row[1][0], _mm512_fmadd_ps(z, row[2][0], row[3][0]))));
+			_mm512_storeu_ps(outY + i, _mm512_fmadd_ps(x, row[0][1], _mm512_fmadd_ps(y, row[1][1], _mm512_fmadd_ps(z, row[2][1], row[3][1]))));
+			_mm512_storeu_ps(outZ + i, _mm512_fmadd_ps(x, row[0][2], _mm512_fmadd_ps(y, row[1][2], _mm512_fmadd_ps(z, row[2][2], row[3][2]))));
+		}
+
+		_mm256_zeroupper();
+		TransformStreamSoA4(inX, inY, inZ, outX, outY, outZ, count, m, i);
+	}
+DASH_TARGET_END
+
+	using FTransformStreamAoSFunction = void(const float* in, float* out, std::size_t count, const FStreamMatrix& m) noexcept;
+	using FTransformStreamSoAFunction = void(const float* inX, const float* inY, const float* inZ, float* outX, float* outY, float* outZ, std::size_t count, const FStreamMatrix& m) noexcept;
+
+	static void TransformStreamAoS(const float* in, float* out, std::size_t count, const FStreamMatrix& m) noexcept
+	{
+		static FTransformStreamAoSFunction* const Function = SelectCpuFunction<FTransformStreamAoSFunction>({
+			{ ECpuIsa::AVX2, &TransformStreamAoS8 },
+			{ ECpuIsa::SSE2, [](const float* in, float* out, std::size_t count, const FStreamMatrix& m) noexcept { TransformStreamAoS4(in, out, count, m); } },
+		});
+
+		Function(in, out, count, m);
+	}
+
+	static void TransformStreamSoA(const FConstVector3fSoA& in, const FVector3fSoA& out, const FStreamMatrix& m) noexcept
+	{
+		ASSERT(in.X.size() == in.Y.size() && in.X.size() == in.Z.size());
+		ASSERT(out.X.size() == out.Y.size() && out.X.size() == out.Z.size());
+		ASSERT(in.GetSize() <= out.GetSize());
+
+		static FTransformStreamSoAFunction* const Function = SelectCpuFunction<FTransformStreamSoAFunction>({
+			{ ECpuIsa::AVX512, &TransformStreamSoA16 },
+			{ ECpuIsa::AVX2, &TransformStreamSoA8 },
+			{ ECpuIsa::SSE2, [](const float* inX, const float* inY, const float* inZ, float* outX, float* outY, float* outZ, std::size_t count, const FStreamMatrix& m) noexcept
+				{ TransformStreamSoA4(inX, inY, inZ, outX, outY, outZ, count, m); } },
+		});
+
+		Function(in.X.data(), in.Y.data(), in.Z.data(), out.X.data(), out.Y.data(), out.Z.data(), in.GetSize(), m);
+	}
+
+	namespace FMath
+	{
+		void TransformPoints(std::span<const FVector3f> in, std::span<FVector3f> out, const FMatrix4x4& m) noexcept
+		{
+			ASSERT(in.size() <= out.size());
+			TransformStreamAoS(reinterpret_cast<const float*>(in.data()), reinterpret_cast<float*>(out.data()), in.size(), MakeStreamMatrix(m, true));
+		}
+
+		void TransformVectors(std::span<const FVector3f> in, std::span<FVector3f> out, const FMatrix4x4& m) noexcept
+		{
+			ASSERT(in.size() <= out.size());
+			TransformStreamAoS(reinterpret_cast<const float*>(in.data()), reinterpret_cast<float*>(out.data()), in.size(), MakeStreamMatrix(m, false));
+		}
+
+		void TransformNormals(std::span<const FVector3f> in, std::span<FVector3f> out, const FMatrix4x4& m) noexcept
+		{
+			ASSERT(in.size() <= out.size());
+			TransformStreamAoS(reinterpret_cast<const float*>(in.data()), reinterpret_cast<float*>(out.data()), in.size(), MakeNormalStreamMatrix(m));
+		}
+
+		void TransformPoints(const FConstVector3fSoA& in, const FVector3fSoA& out, const FMatrix4x4& m) noexcept
+		{
+			TransformStreamSoA(in, out, MakeStreamMatrix(m, true));
+		}
+
+		void TransformVectors(const FConstVector3fSoA& in, const FVector3fSoA& out, const FMatrix4x4& m) noexcept
+		{
+			TransformStreamSoA(in, out, MakeStreamMatrix(m, false));
+		}
+
+		void TransformNormals(const FConstVector3fSoA& in, const FVector3fSoA& out, const FMatrix4x4& m) noexcept
+		{
+			TransformStreamSoA(in, out, MakeNormalStreamMatrix(m));
+		}
+	}
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "MathType.h"
+
+#include <span>
+
+namespace Dash
+{
+	// Structure-of-arrays view over a stream of 3D vectors, all three spans must have the same size.
+	struct FVector3fSoA
+	{
+		std::span<float> X;
+		std::span<float> Y;
+		std::span<float> Z;
+
+		std::size_t GetSize() const noexcept { return X.size(); }
+	};
+
+	struct FConstVector3fSoA
+	{
+		FConstVector3fSoA() noexcept = default;
+		FConstVector3fSoA(std::span<const float> x, std::span<const float> y, std::span<const float> z) noexcept : X(x), Y(y), Z(z) {}
+		FConstVector3fSoA(const FVector3fSoA& v) noexcept : X(v.X), Y(v.Y), Z(v.Z) {}
+
+		std::span<const float> X;
+		std::span<const float> Y;
+		std::span<const float> Z;
+
+		std::size_t GetSize() const noexcept { return X.size(); }
+	};
+
+
+
+
+
+
+	// Non-member Function
+
+	// --Declaration-- //
+
+	// Batched versions of FTransform::TransformPoint/TransformVector/TransformNormal over whole streams.
+	// The matrix is expected to be affine (last column 0, 0, 0, 1), so points skip the homogeneous divide.
+	// The kernels run 8 (AVX) or 4 (SSE) elements per iteration with a scalar tail, in and out may alias.
+	namespace FMath
+	{
+		void TransformPoints(std::span<const FVector3f> in, std::span<FVector3f> out, const FMatrix4x4& m) noexcept;
+		void TransformVectors(std::span<const FVector3f> in, std::span<FVector3f> out, const FMatrix4x4& m) noexcept;
+		void TransformNormals(std::span<const FVector3f> in, std::span<FVector3f> out, const FMatrix4x4& m) noexcept;
+
+		void TransformPoints(const FConstVector3fSoA& in, const FVector3fSoA& out, const FMatrix4x4& m) noexcept;
+		void TransformVectors(const FConstVector3fSoA& in, const FVector3fSoA& out, const FMatrix4x4& m) noexcept;
+		void TransformNormals(const FConstVector3fSoA& in, const FVector3fSoA& out, const FMatrix4x4& m) noexcept;
+	}
+}
@@ -0,0 +1,282 @@
+#pragma once
+
+#include "MathType.h"
+
+namespace Dash
+{
+	// Affine transform stored as the first three columns of the equivalent row vector 4x4 matrix,
+	// the implied fourth column is (0, 0, 0, 1). Row j holds (m[0][j], m[1][j], m[2][j], m[3][j]),
+	// which is also the layout of an HLSL float3x4, so it can be copied to constant buffers as is.
+	struct FAffineMatrix3x4
+	{
+	public:
+		FAffineMatrix3x4() noexcept = default;
+		FAffineMatrix3x4(FIdentity) noexcept;
+		explicit FAffineMatrix3x4(const TScalarMatrix<float, 4, 4>& m) noexcept;
+
+		TScalarMatrix<float, 4, 4> ToMatrix4x4() const noexcept;
+
+	public:
+		alignas(16) float M[3][4];
+	};
+
+	// Scale, rotation and position only, 40 bytes against the 192 bytes of FTransform and its two cached matrices.
+	// The matrix is computed on demand with FMath::ToAffineMatrix, hierarchies keep the results in FTransformHierarchy.
+	struct FTransformTRS
+	{
+	public:
+		FTransformTRS() noexcept = default;
+		FTransformTRS(FIdentity) noexcept;
+		FTransformTRS(const TScalarArray<float, 3>& scale, const TScalarQuaternion<float>& rotation, const TScalarArray<float, 3>& position) noexcept;
+		explicit FTransformTRS(const FTransform& t) noexcept;
+
+		FTransform ToTransform() const noexcept;
+
+	public:
+		TScalarQuaternion<float> Rotation;
+		TScalarArray<float, 3> Position;
+		TScalarArray<float, 3> Scale;
+	};
+
+	static_assert(sizeof(FTransformTRS) == 40);
+	static_assert(sizeof(FAffineMatrix3x4) == 48);
+
+
+
+
+
+
+	// Non-member Function
+
+	// --Declaration-- //
+
+	namespace FMath
+	{
+		// Same matrix as FTransform, scale then rotation then translation.
+		FAffineMatrix3x4 ToAffineMatrix(const FTransformTRS& t) noexcept;
+
+		// Applies a first and then b, the same order as a * b with row vector 4x4 matrices.
+		FAffineMatrix3x4 Mul(const FAffineMatrix3x4& a, const FAffineMatrix3x4& b) noexcept;
+
+		FAffineMatrix3x4 Inverse(const FAffineMatrix3x4& m) noexcept;
+
+		// Assumes no shear and positive scale, as FMath::DecomposeAffineMatrix4x4.
+		FTransformTRS Decompose(const FAffineMatrix3x4& m) noexcept;
+
+		TScalarArray<float, 3> TransformPoint(const FAffineMatrix3x4& m, const TScalarArray<float, 3>& p) noexcept;
+		TScalarArray<float, 3> TransformVector(const FAffineMatrix3x4& m, const TScalarArray<float, 3>& v) noexcept;
+	}
+
+
+
+
+
+
+
+
+
+
+	// Member Function
+
+	// --Implementation-- //
+
+	FORCEINLINE FAffineMatrix3x4::FAffineMatrix3x4(FIdentity) noexcept
+		: M{ { 1.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f, 0.0f } }
+	{
+	}
+
+	FORCEINLINE FAffineMatrix3x4::FAffineMatrix3x4(const TScalarMatrix<float, 4, 4>& m) noexcept
+	{
+		for (int32 j = 0; j < 3; ++j)
+		{
+			for (int32 i = 0; i < 4; ++i)
+			{
+				M[j][i] = m[i][j];
+			}
+		}
+	}
+
+	FORCEINLINE TScalarMatrix<float, 4, 4> FAffineMatrix3x4::ToMatrix4x4() const noexcept
+	{
+		return TScalarMatrix<float, 4, 4>{
+			TScalarArray<float, 4>{ M[0][0], M[1][0], M[2][0], 0.0f },
+			TScalarArray<float, 4>{ M[0][1], M[1][1], M[2][1], 0.0f },
+			TScalarArray<float, 4>{ M[0][2], M[1][2], M[2][2], 0.0f },
+			TScalarArray<float, 4>{ M[0][3], M[1][3], M[2][3], 1.0f } };
+	}
+
+	FORCEINLINE FTransformTRS::FTransformTRS(FIdentity) noexcept
+		: Rotation(FIdentity{})
+		, Position(FZero{})
+		, Scale(FIdentity{})
+	{
+	}
+
+	FORCEINLINE FTransformTRS::FTransformTRS(const TScalarArray<float, 3>& scale, const TScalarQuaternion<float>& rotation, const TScalarArray<float, 3>& position) noexcept
+		: Rotation(rotation)
+		, Position(position)
+		, Scale(scale)
+	{
+	}
+
+	FORCEINLINE FTransformTRS::FTransformTRS(const FTransform& t) noexcept
+		: Rotation(t.GetRotation())
+		, Position(t.GetPosition())
+		, Scale(t.GetScale())
+	{
+	}
+
+	FORCEINLINE FTransform FTransformTRS::ToTransform() const noexcept
+	{
+		return FTransform{ Scale, Rotation, Position };
+	}
+
+
+
+
+
+
+	// Non-member Function
+
+	// --Implementation-- //
+
+	static FORCEINLINE __m128 _Cross3(__m128 a, __m128 b)
+	{
+		__m128 a1 = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+		__m128 b1 = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+		__m128 c = _mm_sub_ps(_mm_mul_ps(a, b1), _mm_mul_ps(a1, b));
+		return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+	}
+
+	static FORCEINLINE __m128 _Dot3(__m128 a, __m128 b)
+	{
+		__m128 m = _mm_mul_ps(a, b);
+		__m128 y = _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 1, 1, 1));
+		__m128 z = _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 2, 2, 2));
+		m = _mm_add_ss(_mm_add_ss(m, y), z);
+		return _mm_shuffle_ps(m, m, _MM_SHUFFLE(0, 0, 0, 0));
+	}
+
+	namespace FMath
+	{
+		FORCEINLINE FAffineMatrix3x4 ToAffineMatrix(const FTransformTRS& t) noexcept
+		{
+			const float x = t.Rotation.X;
+			const float y = t.Rotation.Y;
+			const float z = t.Rotation.Z;
+			const float w = t.Rotation.W;
+
+			const float xx = x * x, yy = y * y, zz = z * z;
+			const float xy = x * y, xz = x * z, yz = y * z;
+			const float xw = x * w, yw = y * w, zw = z * w;
+
+			// Columns of the rotation matrix built by RotateMatrix4x4, the w lane picks up the position.
+			__m128 scale = _mm_setr_ps(t.Scale.X, t.Scale.Y, t.Scale.Z, 1.0f);
+			__m128 c0 = _mm_setr_ps(1.0f - 2.0f * (yy + zz), 2.0f * (xy - zw), 2.0f * (xz + yw), t.Position.X);
+			__m128 c1 = _mm_setr_ps(2.0f * (xy + zw), 1.0f - 2.0f * (xx + zz), 2.0f * (yz - xw), t.Position.Y);
+			__m128 c2 = _mm_setr_ps(2.0f * (xz - yw), 2.0f * (yz + xw), 1.0f - 2.0f * (xx + yy), t.Position.Z);
+
+			FAffineMatrix3x4 result;
+			_mm_store_ps(result.M[0], _mm_mul_ps(c0, scale));
+			_mm_store_ps(result.M[1], _mm_mul_ps(c1, scale));
+			_mm_store_ps(result.M[2], _mm_mul_ps(c2, scale));
+			return result;
+		}
+
+		FORCEINLINE FAffineMatrix3x4 Mul(const FAffineMatrix3x4& a, const FAffineMatrix3x4& b) noexcept
+		{
+			const __m128 a0 = _mm_load_ps(a.M[0]);
+			const __m128 a1 = _mm_load_ps(a.M[1]);
+			const __m128 a2 = _mm_load_ps(a.M[2]);
+			const __m128 a3 = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+
+			FAffineMatrix3x4 result;
+			for (int32 j = 0; j < 3; ++j)
+			{
+				const __m128 bj = _mm_load_ps(b.M[j]);
+				__m128 c = _mm_mul_ps(a0, _mm_shuffle_ps(bj, bj, _MM_SHUFFLE(0, 0, 0, 0)));
+				c = _mm_add_ps(c, _mm_mul_ps(a1, _mm_shuffle_ps(bj, bj, _MM_SHUFFLE(1, 1, 1, 1))));
+				c = _mm_add_ps(c, _mm_mul_ps(a2, _mm_shuffle_ps(bj, bj, _MM_SHUFFLE(2, 2, 2, 2))));
+				c = _mm_add_ps(c, _mm_mul_ps(a3, _mm_shuffle_ps(bj, bj, _MM_SHUFFLE(3, 3, 3, 3))));
+				_mm_store_ps(result.M[j], c);
+			}
+
+			return result;
+		}
+
+		FORCEINLINE FAffineMatrix3x4 Inverse(const FAffineMatrix3x4& m) noexcept
+		{
+			// Back to the rows of the 4x4 matrix: r0..r2 the linear part, t the translation.
+			__m128 r0 = _mm_load_ps(m.M[0]);
+			__m128 r1 = _mm_load_ps(m.M[1]);
+			__m128 r2 = _mm_load_ps(m.M[2]);
+			__m128 t = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(r0, r1, r2, t);
+
+			// Columns of the inverse linear part are the cross products of the rows over the determinant.
+			__m128 c0 = _Cross3(r1, r2);
+			__m128 c1 = _Cross3(r2, r0);
+			__m128 c2 = _Cross3(r0, r1);
+
+			const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), _Dot3(r0, c0));
+			c0 = _mm_mul_ps(c0, invDet);
+			c1 = _mm_mul_ps(c1, invDet);
+			c2 = _mm_mul_ps(c2, invDet);
+
+			// The w lanes of the cross products are zero, so adding the negated dot broadcast fills in the translation.
+			const __m128 wMask = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+			const __m128 zero = _mm_setzero_ps();
+
+			FAffineMatrix3x4 result;
+			_mm_store_ps(result.M[0], _mm_add_ps(c0, _mm_and_ps(wMask, _mm_sub_ps(zero, _Dot3(t, c0)))));
+			_mm_store_ps(result.M[1], _mm_add_ps(c1, _mm_and_ps(wMask, _mm_sub_ps(zero, _Dot3(t, c1)))));
+			_mm_store_ps(result.M[2], _mm_add_ps(c2, _mm_and_ps(wMask, _mm_sub_ps(zero, _Dot3(t, c2)))));
+			return result;
+		}
+
+		FORCEINLINE FTransformTRS Decompose(const FAffineMatrix3x4& m) noexcept
+		{
+			const __m128 m0 = _mm_load_ps(m.M[0]);
+			const __m128 m1 = _mm_load_ps(m.M[1]);
+			const __m128 m2 = _mm_load_ps(m.M[2]);
+
+			// Lane i holds the squared length of row i of the 4x4 matrix.
+			__m128 lengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, m0), _mm_mul_ps(m1, m1)), _mm_mul_ps(m2, m2));
+			__m128 scale = _mm_sqrt_ps(lengthSq);
+			__m128 invScale = _mm_div_ps(_mm_set1_ps(1.0f), scale);
+
+			alignas(16) float basis[3][4];
+			alignas(16) float s[4];
+			_mm_store_ps(basis[0], _mm_mul_ps(m0, invScale));
+			_mm_store_ps(basis[1], _mm_mul_ps(m1, invScale));
+			_mm_store_ps(basis[2], _mm_mul_ps(m2, invScale));
+			_mm_store_ps(s, scale);
+
+			TScalarMatrix<float, 3, 3> rotation{
+				TScalarArray<float, 3>{ basis[0][0], basis[1][0], basis[2][0] },
+				TScalarArray<float, 3>{ basis[0][1], basis[1][1], basis[2][1] },
+				TScalarArray<float, 3>{ basis[0][2], basis[1][2], basis[2][2] } };
+
+			return FTransformTRS{
+				TScalarArray<float, 3>{ s[0], s[1], s[2] },
+				FromMatrix(rotation),
+				TScalarArray<float, 3>{ m.M[0][3], m.M[1][3], m.M[2][3] } };
+		}
+
+		FORCEINLINE TScalarArray<float, 3> TransformPoint(const FAffineMatrix3x4& m, const TScalarArray<float, 3>& p) noexcept
+		{
+			return TScalarArray<float, 3>{
+				m.M[0][0] * p.X + m.M[0][1] * p.Y + m.M[0][2] * p.Z + m.M[0][3],
+				m.M[1][0] * p.X + m.M[1][1] * p.Y + m.M[1][2] * p.Z + m.M[1][3],
+				m.M[2][0] * p.X + m.M[2][1] * p.Y + m.M[2][2] * p.Z + m.M[2][3] };
+		}
+
+		FORCEINLINE TScalarArray<float, 3> TransformVector(const FAffineMatrix3x4& m, const TScalarArray<float, 3>& v) noexcept
+		{
+			return TScalarArray<float, 3>{
+				m.M[0][0] * v.X + m.M[0][1] * v.Y + m.M[0][2] * v.Z,
+				m.M[1][0] * v.X + m.M[1][1] * v.Y + m.M[1][2] * v.Z,
+				m.M[2][0] * v.X + m.M[2][1] * v.Y + m.M[2][2] * v.Z };
+		}
+	}
+}
@@ -1,6 +1,14 @@
 #pragma once
 
-#include <smmintrin.h>
+#include <immintrin.h>
+
+// FMA is a separate extension, not part of AVX2. GCC and Clang define __FMA__ for -mfma or an -march that has it,
+// MSVC has no such macro, so projects built with /arch:AVX2 opt in by defining DASH_USE_FMA.
+#if defined(__FMA__) || defined(DASH_USE_FMA)
+#define DASH_SIMD_FMA 1
+#else
+#define DASH_SIMD_FMA 0
+#endif
 
 namespace Dash
 {
@@ -24,6 +32,27 @@ namespace Dash
 			return _mm_div_ps(a, _mm_set1_ps(s));
 #endif // FAST_APPROX
 		}
+
+		// a * b + c, fused when the target has FMA.
+		static __m128 _MulAdd(__m128 a, __m128 b, __m128 c)
+		{
+#if DASH_SIMD_FMA
+			return _mm_fmadd_ps(a, b, c);
+#else
+			return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+		}
+
+#if defined(__AVX__)
+		static __m256 _MulAdd(__m256 a, __m256 b, __m256 c)
+		{
+#if DASH_SIMD_FMA
+			return _mm256_fmadd_ps(a, b, c);
+#else
+			return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+		}
+#endif // __AVX__
 	}
 
 
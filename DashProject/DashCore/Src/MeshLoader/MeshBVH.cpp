@@ -0,0 +1,615 @@
+#include "PCH.h"
+#include "MeshBVH.h"
+#include "Utility/JobSystem.h"
+
+namespace Dash
+{
+	static constexpr uint32 MaxTraversalStackSize = 64;
+	static constexpr uint32 MaxBins = 32;
+	static constexpr Scalar TraversalCost = 1.0f;
+
+	static FORCEINLINE Scalar SurfaceArea(const FBoundingBox& b) noexcept
+	{
+		FVector3f d = b.Upper - b.Lower;
+		return Scalar{ 2 } * (d.X * d.Y + d.Y * d.Z + d.Z * d.X);
+	}
+
+	static FORCEINLINE void GrowBounds(FBoundingBox& b, const FBoundingBox& other) noexcept
+	{
+		b.Lower = FMath::Min(b.Lower, other.Lower);
+		b.Upper = FMath::Max(b.Upper, other.Upper);
+	}
+
+	static FORCEINLINE void GrowBounds(FBoundingBox& b, const FVector3f& p) noexcept
+	{
+		b.Lower = FMath::Min(b.Lower, p);
+		b.Upper = FMath::Max(b.Upper, p);
+	}
+
+	static FORCEINLINE FBoundingBox GetNodeBounds(const FMeshBVHNode& node) noexcept
+	{
+		return FBoundingBox{ FVector3f{ node.Lower[0], node.Lower[1], node.Lower[2] }, FVector3f{ node.Upper[0], node.Upper[1], node.Upper[2] } };
+	}
+
+	// Slab test against a binary node using the cached inverse direction of the ray.
+	static FORCEINLINE bool IntersectNode(const FMeshBVHNode& node, const FRay& r, Scalar& tNear) noexcept
+	{
+		Scalar tMin = r.TMin;
+		Scalar tMax = r.TMax;
+
+		for (std::size_t i = 0; i < 3; i++)
+		{
+			Scalar t0 = ((r.Sign[i] ? node.Upper[i] : node.Lower[i]) - r.Origin[i]) * r.InvDirection[i];
+			Scalar t1 = ((r.Sign[i] ? node.Lower[i] : node.Upper[i]) - r.Origin[i]) * r.InvDirection[i];
+
+			tMin = t0 > tMin ? t0 : tMin;
+			tMax = t1 < tMax ? t1 : tMax;
+		}
+
+		tNear = tMin;
+		return tMin <= tMax;
+	}
+
+	class FMeshBVHBuilder
+	{
+	public:
+		FMeshBVHBuilder(const FMeshBVHBuildSettings& settings, const std::vector<FBoundingBox>& bounds, const std::vector<FVector3f>& centroids,
+			std::vector<uint32>& primitives, std::vector<FMeshBVHNode>& nodes)
+			: mSettings(settings)
+			, mBounds(bounds)
+			, mCentroids(centroids)
+			, mPrimitives(primitives)
+			, mNodes(nodes)
+			, mNodeCount(1)
+		{
+			mNumBins = FMath::Clamp(mSettings.NumBins, 2u, MaxBins);
+		}
+
+		uint32 Build()
+		{
+			BuildNode(0, 0, static_cast<uint32>(mPrimitives.size()), 0);
+			return mNodeCount.load();
+		}
+
+	private:
+		struct FBin
+		{
+			FBoundingBox Bounds;
+			uint32 Count = 0;
+		};
+
+		void MakeLeaf(FMeshBVHNode& node, uint32 begin, uint32 end)
+		{
+			node.FirstIndex = begin;
+			node.TriangleCount = end - begin;
+		}
+
+		void BuildNode(uint32 nodeIndex, uint32 begin, uint32 end, uint32 depth)
+		{
+			FBoundingBox bounds;
+			FBoundingBox centroidBounds;
+
+			for (uint32 i = begin; i < end; i++)
+			{
+				GrowBounds(bounds, mBounds[mPrimitives[i]]);
+				GrowBounds(centroidBounds, mCentroids[mPrimitives[i]]);
+			}
+
+			FMeshBVHNode& node = mNodes[nodeIndex];
+			for (std::size_t i = 0; i < 3; i++)
+			{
+				node.Lower[i] = bounds.Lower[i];
+				node.Upper[i] = bounds.Upper[i];
+			}
+
+			const uint32 count = end - begin;
+			if (count == 1)
+			{
+				MakeLeaf(node, begin, end);
+				return;
+			}
+
+			// Binned SAH over all three axes of the centroid bounds.
+			int bestAxis = -1;
+			uint32 bestSplit = 0;
+			Scalar bestCost = TScalarTraits<Scalar>::Max();
+
+			for (int axis = 0; axis < 3; axis++)
+			{
+				Scalar extent = centroidBounds.Upper[axis] - centroidBounds.Lower[axis];
+				if (extent <= TScalarTraits<Scalar>::Epsilon())
+				{
+					continue;
+				}
+
+				FBin bins[MaxBins];
+				Scalar scale = static_cast<Scalar>(mNumBins) / extent;
+
+				for (uint32 i = begin; i < end; i++)
+				{
+					uint32 primitive = mPrimitives[i];
+					uint32 bin = GetBinIndex(mCentroids[primitive][axis], centroidBounds.Lower[axis], scale);
+					bins[bin].Count++;
+					GrowBounds(bins[bin].Bounds, mBounds[primitive]);
+				}
+
+				Scalar rightArea[MaxBins];
+				uint32 rightCount[MaxBins];
+				FBoundingBox rightBounds;
+				uint32 rightSum = 0;
+
+				for (uint32 i = mNumBins - 1; i > 0; i--)
+				{
+					rightSum += bins[i].Count;
+					if (bins[i].Count > 0)
+					{
+						GrowBounds(rightBounds, bins[i].Bounds);
+					}
+					rightCount[i] = rightSum;
+					rightArea[i] = rightSum > 0 ? SurfaceArea(rightBounds) : Scalar{};
+				}
+
+				FBoundingBox leftBounds;
+				uint32 leftSum = 0;
+
+				for (uint32 split = 1; split < mNumBins; split++)
+				{
+					leftSum += bins[split - 1].Count;
+					if (bins[split - 1].Count > 0)
+					{
+						GrowBounds(leftBounds, bins[split - 1].Bounds);
+					}
+
+					if (leftSum == 0 || rightCount[split] == 0)
+					{
+						continue;
+					}
+
+					Scalar cost = leftSum * SurfaceArea(leftBounds) + rightCount[split] * rightArea[split];
+					if (cost < bestCost)
+					{
+						bestCost = cost;
+						bestAxis = axis;
+						bestSplit = split;
+					}
+				}
+			}
+
+			const Scalar area = SurfaceArea(bounds);
+			const Scalar leafCost = static_cast<Scalar>(count);
+			const Scalar splitCost = bestAxis >= 0 && area > Scalar{} ? TraversalCost + bestCost / area : TScalarTraits<Scalar>::Max();
+
+			if (count <= mSettings.MaxLeafTriangles && splitCost >= leafCost)
+			{
+				MakeLeaf(node, begin, end);
+				return;
+			}
+
+			uint32 mid = begin + count / 2;
+
+			if (bestAxis >= 0)
+			{
+				Scalar scale = static_cast<Scalar>(mNumBins) / (centroidBounds.Upper[bestAxis] - centroidBounds.Lower[bestAxis]);
+				Scalar lower = centroidBounds.Lower[bestAxis];
+
+				auto it = std::partition(mPrimitives.begin() + begin, mPrimitives.begin() + end, [&](uint32 primitive)
+					{
+						return GetBinIndex(mCentroids[primitive][bestAxis], lower, scale) < bestSplit;
+					});
+
+				mid = static_cast<uint32>(it - mPrimitives.begin());
+
+				if (mid == begin || mid == end)
+				{
+					mid = begin + count / 2;
+				}
+			}
+
+			uint32 children = mNodeCount.fetch_add(2);
+			node.FirstIndex = children;
+			node.TriangleCount = 0;
+
+			if (mSettings.Multithreaded && count >= mSettings.ParallelBuildThreshold)
+			{
+				FJobCounter leftCounter;
+				FJobSystem::Get().Run(FJobDesc{ [this, children, begin, mid, depth]() { BuildNode(children, begin, mid, depth + 1); }, "MeshBVHBuildNode" }, &leftCounter);
+				BuildNode(children + 1, mid, end, depth + 1);
+				FJobSystem::Get().Wait(leftCounter);
+			}
+			else
+			{
+				BuildNode(children, begin, mid, depth + 1);
+				BuildNode(children + 1, mid, end, depth + 1);
+			}
+		}
+
+		uint32 GetBinIndex(Scalar centroid, Scalar lower, Scalar scale) const noexcept
+		{
+			uint32 bin = static_cast<uint32>((centroid - lower) * scale);
+			return bin < mNumBins ? bin : mNumBins - 1;
+		}
+
+	private:
+		const FMeshBVHBuildSettings& mSettings;
+		const std::vector<FBoundingBox>& mBounds;
+		const std::vector<FVector3f>& mCentroids;
+		std::vector<uint32>& mPrimitives;
+		std::vector<FMeshBVHNode>& mNodes;
+
+		std::atomic<uint32> mNodeCount;
+		uint32 mNumBins;
+	};
+
+	void FMeshBVH::Build(const FImportedStaticMeshData& meshData, const FMeshBVHBuildSettings& settings)
+	{
+		Clear();
+
+		std::vector<FMeshSectionData> sections = meshData.SectionData;
+		if (sections.empty())
+		{
+			FMeshSectionData section;
+			section.IndexCount = static_cast<uint32>(meshData.Indices.size());
+			sections.push_back(section);
+		}
+
+		std::vector<FTriangle> triangles;
+		std::vector<uint32> triangleIds;
+		triangles.reserve(meshData.Indices.size() / 3);
+		triangleIds.reserve(meshData.Indices.size() / 3);
+
+		for (const FMeshSectionData& section : sections)
+		{
+			for (uint32 i = 0; i + 2 < section.IndexCount; i += 3)
+			{
+				uint32 index = section.IndexStart + i;
+				uint32 i0 = section.VertexStart + meshData.Indices[index];
+				uint32 i1 = section.VertexStart + meshData.Indices[index + 1];
+				uint32 i2 = section.VertexStart + meshData.Indices[index + 2];
+
+				ASSERT(i0 < meshData.PositionData.size() && i1 < meshData.PositionData.size() && i2 < meshData.PositionData.size());
+
+				triangles.push_back(FTriangle{ meshData.PositionData[i0], meshData.PositionData[i1], meshData.PositionData[i2] });
+				triangleIds.push_back(index / 3);
+			}
+		}
+
+		if (triangles.empty())
+		{
+			return;
+		}
+
+		std::vector<FBoundingBox> bounds(triangles.size());
+		std::vector<FVector3f> centroids(triangles.size());
+		std::vector<uint32> primitives(triangles.size());
+
+		for (std::size_t i = 0; i < triangles.size(); i++)
+		{
+			FBoundingBox b{ triangles[i].V0 };
+			GrowBounds(b, triangles[i].V1);
+			GrowBounds(b, triangles[i].V2);
+
+			bounds[i] = b;
+			centroids[i] = (b.Lower + b.Upper) * Scalar{ 0.5f };
+			primitives[i] = static_cast<uint32>(i);
+		}
+
+		mNodes.resize(triangles.size() * 2 - 1);
+
+		FMeshBVHBuilder builder{ settings, bounds, centroids, primitives, mNodes };
+		mNodes.resize(builder.Build());
+		mNodes.shrink_to_fit();
+
+		mTriangles.resize(triangles.size());
+		mTriangleIds.resize(triangles.size());
+
+		for (std::size_t i = 0; i < primitives.size(); i++)
+		{
+			mTriangles[i] = triangles[primitives[i]];
+			mTriangleIds[i] = triangleIds[primitives[i]];
+		}
+
+		if (settings.BuildWideBVH)
+		{
+			CollapseToWide();
+		}
+	}
+
+	void FMeshBVH::Clear()
+	{
+		mNodes.clear();
+		mWideNodes.clear();
+		mTriangles.clear();
+		mTriangleIds.clear();
+	}
+
+	FBoundingBox FMeshBVH::GetBounds() const noexcept
+	{
+		return mNodes.empty() ? FBoundingBox{} : GetNodeBounds(mNodes[0]);
+	}
+
+	bool FMeshBVH::RayCast(const FRay& ray, FMeshRayHit& hit) const noexcept
+	{
+		hit = FMeshRayHit{};
+		return mWideNodes.empty() ? TraverseBinary<false>(ray, hit) : TraverseWide<false>(ray, hit);
+	}
+
+	bool FMeshBVH::RayCastAny(const FRay& ray) const noexcept
+	{
+		FMeshRayHit hit;
+		return mWideNodes.empty() ? TraverseBinary<true>(ray, hit) : TraverseWide<true>(ray, hit);
+	}
+
+	template<bool AnyHit>
+	bool FMeshBVH::IntersectLeaf(uint32 first, uint32 count, FRay& ray, FMeshRayHit& hit) const noexcept
+	{
+		bool hitAny = false;
+
+		for (uint32 i = first; i < first + count; i++)
+		{
+			const FTriangle& triangle = mTriangles[i];
+
+			Scalar u, v, t;
+			if (FMath::RayTriangleIntersection(ray, triangle.V0, triangle.V1, triangle.V2, u, v, t) && t >= ray.TMin && t <= ray.TMax)
+			{
+				hitAny = true;
+				hit.TriangleIndex = mTriangleIds[i];
+				hit.T = t;
+				hit.U = u;
+				hit.V = v;
+
+				if constexpr (AnyHit)
+				{
+					return true;
+				}
+
+				ray.TMax = t;
+			}
+		}
+
+		return hitAny;
+	}
+
+	template<bool AnyHit>
+	bool FMeshBVH::TraverseBinary(const FRay& ray, FMeshRayHit& hit) const noexcept
+	{
+		if (mNodes.empty())
+		{
+			return false;
+		}
+
+		FRay r = ray;
+		bool hitAny = false;
+
+		struct FStackEntry
+		{
+			uint32 Node;
+			Scalar TNear;
+		};
+
+		FStackEntry stack[MaxTraversalStackSize];
+		uint32 stackSize = 0;
+
+		Scalar tRoot;
+		if (!IntersectNode(mNodes[0], r, tRoot))
+		{
+			return false;
+		}
+
+		stack[stackSize++] = FStackEntry{ 0, tRoot };
+
+		while (stackSize > 0)
+		{
+			FStackEntry entry = stack[--stackSize];
+			if (entry.TNear > r.TMax)
+			{
+				continue;
+			}
+
+			const FMeshBVHNode& node = mNodes[entry.Node];
+
+			if (node.IsLeaf())
+			{
+				if (IntersectLeaf<AnyHit>(node.FirstIndex, node.TriangleCount, r, hit))
+				{
+					hitAny = true;
+
+					if constexpr (AnyHit)
+					{
+						return true;
+					}
+				}
+
+				continue;
+			}
+
+			Scalar t0, t1;
+			bool hit0 = IntersectNode(mNodes[node.FirstIndex], r, t0);
+			bool hit1 = IntersectNode(mNodes[node.FirstIndex + 1], r, t1);
+
+			ASSERT(stackSize + 2 <= MaxTraversalStackSize);
+
+			// Push the farther child first so the nearer one is visited next.
+			if (hit0 && hit1)
+			{
+				if (t0 <= t1)
+				{
+					stack[stackSize++] = FStackEntry{ node.FirstIndex + 1, t1 };
+					stack[stackSize++] = FStackEntry{ node.FirstIndex, t0 };
+				}
+				else
+				{
+					stack[stackSize++] = FStackEntry{ node.FirstIndex, t0 };
+					stack[stackSize++] = FStackEntry{ node.FirstIndex + 1, t1 };
+				}
+			}
+			else if (hit0)
+			{
+				stack[stackSize++] = FStackEntry{ node.FirstIndex, t0 };
+			}
+			else if (hit1)
+			{
+				stack[stackSize++] = FStackEntry{ node.FirstIndex + 1, t1 };
+			}
+		}
+
+		return hitAny;
+	}
+
+	template<bool AnyHit>
+	bool FMeshBVH::TraverseWide(const FRay& ray, FMeshRayHit& hit) const noexcept
+	{
+		FRay r = ray;
+		bool hitAny = false;
+
+		struct FStackEntry
+		{
+			uint32 Node;
+			Scalar TNear;
+		};
+
+		FStackEntry stack[MaxTraversalStackSize];
+		uint32 stackSize = 0;
+
+		stack[stackSize++] = FStackEntry{ 0, r.TMin };
+
+		while (stackSize > 0)
+		{
+			FStackEntry entry = stack[--stackSize];
+			if (entry.TNear > r.TMax)
+			{
+				continue;
+			}
+
+			const FMeshBVH4Node& node = mWideNodes[entry.Node];
+
+			TPacketBoxHit<4> boxHit;
+			uint32 mask = FMath::RayBoundingBoxIntersection(r, node.Bounds, boxHit);
+
+			FStackEntry children[4];
+			uint32 numChildren = 0;
+
+			while (mask != 0)
+			{
+				uint32 lane = static_cast<uint32>(std::countr_zero(mask));
+				mask &= mask - 1;
+
+				if (node.Child[lane] == FMeshBVH4Node::InvalidChild)
+				{
+					continue;
+				}
+
+				if (node.TriangleCount[lane] > 0)
+				{
+					if (IntersectLeaf<AnyHit>(node.Child[lane], node.TriangleCount[lane], r, hit))
+					{
+						hitAny = true;
+
+						if constexpr (AnyHit)
+						{
+							return true;
+						}
+					}
+				}
+				else
+				{
+					children[numChildren++] = FStackEntry{ node.Child[lane], boxHit.TNear[lane] };
+				}
+			}
+
+			// Far to near, the nearest child ends up on top of the stack.
+			std::sort(children, children + numChildren, [](const FStackEntry& a, const FStackEntry& b) { return a.TNear > b.TNear; });
+
+			ASSERT(stackSize + numChildren <= MaxTraversalStackSize);
+
+			for (uint32 i = 0; i < numChildren; i++)
+			{
+				stack[stackSize++] = children[i];
+			}
+		}
+
+		return hitAny;
+	}
+
+	void FMeshBVH::CollapseToWide()
+	{
+		mWideNodes.clear();
+		mWideNodes.reserve(mNodes.size() / 2 + 1);
+
+		auto collapse = [this](auto&& self, uint32 binaryIndex) -> uint32
+			{
+				uint32 wideIndex = static_cast<uint32>(mWideNodes.size());
+				mWideNodes.emplace_back();
+
+				uint32 lanes[4];
+				uint32 numLanes = 0;
+
+				const FMeshBVHNode& root = mNodes[binaryIndex];
+				if (root.IsLeaf())
+				{
+					lanes[numLanes++] = binaryIndex;
+				}
+				else
+				{
+					lanes[numLanes++] = root.FirstIndex;
+					lanes[numLanes++] = root.FirstIndex + 1;
+				}
+
+				// Open the interior child with the largest surface area until all four lanes are used.
+				while (numLanes < 4)
+				{
+					int best = -1;
+					Scalar bestArea = Scalar{ -1 };
+
+					for (uint32 i = 0; i < numLanes; i++)
+					{
+						const FMeshBVHNode& candidate = mNodes[lanes[i]];
+						Scalar area = SurfaceArea(GetNodeBounds(candidate));
+
+						if (!candidate.IsLeaf() && area > bestArea)
+						{
+							best = static_cast<int>(i);
+							bestArea = area;
+						}
+					}
+
+					if (best < 0)
+					{
+						break;
+					}
+
+					uint32 opened = mNodes[lanes[best]].FirstIndex;
+					lanes[best] = opened;
+					lanes[numLanes++] = opened + 1;
+				}
+
+				for (uint32 lane = 0; lane < 4; lane++)
+				{
+					uint32 child = FMeshBVH4Node::InvalidChild;
+					uint32 triangleCount = 0;
+
+					if (lane < numLanes)
+					{
+						const FMeshBVHNode& binary = mNodes[lanes[lane]];
+						mWideNodes[wideIndex].Bounds.SetBox(lane, GetNodeBounds(binary));
+
+						if (binary.IsLeaf())
+						{
+							child = binary.FirstIndex;
+							triangleCount = binary.TriangleCount;
+						}
+						else
+						{
+							child = self(self, lanes[lane]);
+						}
+					}
+
+					mWideNodes[wideIndex].Child[lane] = child;
+					mWideNodes[wideIndex].TriangleCount[lane] = triangleCount;
+				}
+
+				return wideIndex;
+			};
+
+		collapse(collapse, 0);
+	}
+}
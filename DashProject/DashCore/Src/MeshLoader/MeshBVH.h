@@ -0,0 +1,96 @@
+#pragma once
+
+#include "MeshLoaderHelper.h"
+#include "Math/IntersectionPacket.h"
+
+namespace Dash
+{
+	struct FMeshBVHBuildSettings
+	{
+		uint32 NumBins = 16;
+		uint32 MaxLeafTriangles = 4;
+
+		// Subtrees larger than this are built as jobs on the FJobSystem workers.
+		uint32 ParallelBuildThreshold = 4096;
+		bool Multithreaded = true;
+
+		// Collapse the binary tree into 4-wide nodes traversed with the SIMD box test.
+		bool BuildWideBVH = true;
+	};
+
+	// 32 bytes, interior nodes store their two children adjacently at FirstIndex.
+	struct FMeshBVHNode
+	{
+		float Lower[3];
+		uint32 FirstIndex;
+		float Upper[3];
+		uint32 TriangleCount;
+
+		bool IsLeaf() const noexcept { return TriangleCount != 0; }
+	};
+
+	static_assert(sizeof(FMeshBVHNode) == 32, "FMeshBVHNode is expected to be 32 bytes.");
+
+	struct FMeshBVH4Node
+	{
+		static constexpr uint32 InvalidChild = ~0u;
+
+		FBoundingBoxPacket4 Bounds;
+		uint32 Child[4];
+		uint32 TriangleCount[4];
+	};
+
+	struct FMeshRayHit
+	{
+		// Index of the triangle in FImportedStaticMeshData::Indices, i.e. the first index is at TriangleIndex * 3.
+		uint32 TriangleIndex = ~0u;
+		Scalar T = TScalarTraits<Scalar>::Infinity();
+		Scalar U = 0;
+		Scalar V = 0;
+	};
+
+	// Bounding volume hierarchy over the triangles of an imported mesh, built with binned SAH.
+	// Positions are copied in leaf order, so the source mesh data is not referenced after Build.
+	class FMeshBVH
+	{
+	public:
+		FMeshBVH() = default;
+
+		void Build(const FImportedStaticMeshData& meshData, const FMeshBVHBuildSettings& settings = FMeshBVHBuildSettings{});
+		void Clear();
+
+		// Closest hit within [TMin, TMax] of the ray.
+		bool RayCast(const FRay& ray, FMeshRayHit& hit) const noexcept;
+
+		// Returns as soon as any triangle is hit within [TMin, TMax], for occlusion queries.
+		bool RayCastAny(const FRay& ray) const noexcept;
+
+		bool IsEmpty() const noexcept { return mNodes.empty(); }
+		FBoundingBox GetBounds() const noexcept;
+
+		std::size_t GetNumNodes() const noexcept { return mNodes.size(); }
+		std::size_t GetNumWideNodes() const noexcept { return mWideNodes.size(); }
+		std::size_t GetNumTriangles() const noexcept { return mTriangleIds.size(); }
+
+	private:
+		struct FTriangle
+		{
+			FVector3f V0;
+			FVector3f V1;
+			FVector3f V2;
+		};
+
+		template<bool AnyHit> bool TraverseBinary(const FRay& ray, FMeshRayHit& hit) const noexcept;
+		template<bool AnyHit> bool TraverseWide(const FRay& ray, FMeshRayHit& hit) const noexcept;
+		template<bool AnyHit> bool IntersectLeaf(uint32 first, uint32 count, FRay& ray, FMeshRayHit& hit) const noexcept;
+
+		void CollapseToWide();
+
+	private:
+		std::vector<FMeshBVHNode> mNodes;
+		std::vector<FMeshBVH4Node> mWideNodes;
+
+		std::vector<FTriangle> mTriangles;
+		std::vector<uint32> mTriangleIds;
+	};
+}
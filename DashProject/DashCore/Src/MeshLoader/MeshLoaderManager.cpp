@@ -23,7 +23,8 @@ namespace Dash
 
     const FImportedMeshData& FMeshLoaderManager::LoadMesh(const std::string& meshPath)
     {
-		if (!mImportMeshs.contains(meshPath))
+		auto meshIter = mImportMeshs.find(meshPath);
+		if (meshIter == mImportMeshs.end())
 		{
 			bool loadSucceed = false;
 
@@ -36,29 +37,30 @@ namespace Dash
 
 				if (loadSucceed)
 				{
-					mImportMeshs.emplace(meshPath, importedMeshData);
+					meshIter = mImportMeshs.emplace(meshPath, std::make_unique<FImportedMeshData>(std::move(importedMeshData))).first;
 				}
 			}
 
 			if (!loadSucceed)
 			{
                 DASH_LOG(LogTemp, Error, "Failed to load mesh : {}.", meshPath);
-				return mImportMeshs["Cube"];
+				return *mImportMeshs.at("Cube");
 			}
 		}
 
-        mImportMeshs[meshPath].AddRef();
-		return mImportMeshs[meshPath];
+        meshIter->second->AddRef();
+		return *meshIter->second;
     }
 
     bool FMeshLoaderManager::UnloadMesh(const std::string& meshPath)
     {
-		if (mImportMeshs.contains(meshPath))
+		auto meshIter = mImportMeshs.find(meshPath);
+		if (meshIter != mImportMeshs.end())
 		{
-			int32 RefCount = mImportMeshs[meshPath].Release();
+			int32 RefCount = meshIter->second->Release();
 			if (RefCount <= 0)
 			{
-				mImportMeshs.erase(meshPath);
+				mImportMeshs.erase(meshIter);
 			}
 			return true;
 		}
@@ -66,9 +68,27 @@ namespace Dash
 		return false;
     }
 
+    const FMeshBVH* FMeshLoaderManager::GetMeshBVH(const std::string& meshPath)
+    {
+        auto iter = mImportMeshs.find(meshPath);
+        if (iter == mImportMeshs.end())
+        {
+            return nullptr;
+        }
+
+        FImportedMeshData& meshData = *iter->second;
+        if (meshData.MeshBVH == nullptr)
+        {
+            meshData.MeshBVH = std::make_shared<FMeshBVH>();
+            meshData.MeshBVH->Build(meshData);
+        }
+
+        return meshData.MeshBVH.get();
+    }
+
     void FMeshLoaderManager::CreateDefaultMeshs()
     {
-        mImportMeshs.emplace("Cube", CreateCube(1.0f, 1.0f, 1.0f, FVector4f{1.0f, 1.0f, 1.0f, 1.0f }));
+        mImportMeshs.emplace("Cube", std::make_unique<FImportedMeshData>(CreateCube(1.0f, 1.0f, 1.0f, FVector4f{1.0f, 1.0f, 1.0f, 1.0f })));
     }
 
 	FImportedMeshData FMeshLoaderManager::CreateCube(Scalar width, Scalar height, Scalar depth, FVector4f color)
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "StaticMeshLoader.h"
+#include "MeshBVH.h"
+#include "Utility/FlatHashMap.h"
 
 namespace Dash
 {
@@ -25,6 +27,9 @@ namespace Dash
 	private:
 
 		int32 RefCount = 0;
+
+		// Built on first request through FMeshLoaderManager::GetMeshBVH.
+		std::shared_ptr<FMeshBVH> MeshBVH;
 	};
 
 	class FMeshLoaderManager
@@ -39,11 +44,15 @@ namespace Dash
 
 		bool UnloadMesh(const std::string& meshPath);
 
+		// Returns the acceleration structure of a loaded mesh, building and caching it on first use. Null if the mesh is not loaded.
+		const FMeshBVH* GetMeshBVH(const std::string& meshPath);
+
 	private:
 		void CreateDefaultMeshs();
 		FImportedMeshData CreateCube(Scalar width, Scalar height, Scalar depth, FVector4f color);
 
 	private:
-		std::map<std::string, FImportedMeshData> mImportMeshs;
+		// Boxed, LoadMesh hands out references that must survive rehashes.
+		TFlatHashMap<std::string, std::unique_ptr<FImportedMeshData>> mImportMeshs;
 	};
 }
\ No newline at end of file
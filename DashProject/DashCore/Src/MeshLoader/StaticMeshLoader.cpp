@@ -1,6 +1,8 @@
 #include "PCH.h"
 #include "StaticMeshLoader.h"
 #include "Utility/FileUtility.h"
+#include "Utility/ParallelAlgorithms.h"
+#include "Utility/CpuProfiler.h"
 
 #include "assimp/Importer.hpp"   // C++ importer interface
 #include "assimp/scene.h"        // Output data structure
@@ -11,6 +13,8 @@ namespace Dash
 {
     bool LoadStaticMeshFromFile(const std::string filePath, FImportedStaticMeshData& importedMeshData)
     {
+        DASH_CPU_SCOPE("LoadStaticMeshFromFile");
+
         Assimp::Importer import;
         const aiScene* scene = import.ReadFile(filePath, aiProcess_ConvertToLeftHanded | aiProcess_Triangulate | aiProcess_GenNormals | aiProcess_CalcTangentSpace | aiProcess_GenUVCoords);
 
@@ -26,93 +30,104 @@ namespace Dash
 
         // Load mesh
         {
+            DASH_CPU_SCOPE("LoadStaticMeshFromFile::CopyMeshes");
+
             std::vector<uint32>& indices = importedMeshData.Indices;
 
-            // Reserve space
+            // Lay out every mesh in the shared arrays first, so the meshes can be copied in parallel
+            uint32 totalVertexs{ 0 };
+            uint32 totalIndexes{ 0 };
+            uint32 maxTexCoord{ 0 };
+            bool anyNormals{ false };
+            bool anyTangents{ false };
+            for (uint32 mesh_idx = 0; mesh_idx < scene->mNumMeshes; ++mesh_idx)
             {
-                uint32 totalVertexs{ 0 };
-                uint32 maxTexCoord{ 0 };
-                for (uint32 i = 0; i < scene->mNumMeshes; ++i)
+                aiMesh* mesh = scene->mMeshes[mesh_idx];
+
+                // Track submesh
+                FMeshSectionData sectionData{};
+                sectionData.VertexStart = totalVertexs;
+                sectionData.VertexCount = mesh->mNumVertices;
+                sectionData.IndexStart = totalIndexes;
+                sectionData.IndexCount = 0;
+                // Count indices
+                for (uint32 faceIndex = 0; faceIndex < mesh->mNumFaces; ++faceIndex)
                 {
-                    totalVertexs += scene->mMeshes[i]->mNumVertices;
-                    maxTexCoord = FMath::Max(scene->mMeshes[i]->GetNumUVChannels(), maxTexCoord);
+                    sectionData.IndexCount += mesh->mFaces[faceIndex].mNumIndices;
                 }
-                               
-                ASSERT(totalVertexs != 0);
 
-                importedMeshData.NumVertexes = totalVertexs;
-                importedMeshData.NumTexCoord = maxTexCoord;
+                totalVertexs += sectionData.VertexCount;
+                totalIndexes += sectionData.IndexCount;
+                maxTexCoord = FMath::Max(mesh->GetNumUVChannels(), maxTexCoord);
+                anyNormals |= mesh->HasNormals();
+                anyTangents |= mesh->HasTangentsAndBitangents();
 
-                importedMeshData.PositionData.reserve(totalVertexs);     
-                importedMeshData.NormalData.reserve(totalVertexs);
-                importedMeshData.TangentData.reserve(totalVertexs);
-                importedMeshData.VertexColorData.reserve(totalVertexs);
-                importedMeshData.UVData.reserve(totalVertexs * maxTexCoord);
+                // Track material
+                submeshToMaterialIndex.push_back(mesh->mMaterialIndex);
+
+                // Track submesh
+                meshSections.push_back(sectionData);
             }
 
+            ASSERT(totalVertexs != 0);
+
+            importedMeshData.NumVertexes = totalVertexs;
+            importedMeshData.NumTexCoord = maxTexCoord;
+
+            // Attributes a mesh does not have stay zero
+            importedMeshData.PositionData.resize(totalVertexs);
+            importedMeshData.NormalData.resize(anyNormals ? totalVertexs : 0);
+            importedMeshData.TangentData.resize(anyTangents ? totalVertexs : 0);
+            importedMeshData.VertexColorData.resize(totalVertexs);
+            importedMeshData.UVData.resize(totalVertexs * maxTexCoord);
+            indices.resize(totalIndexes);
+
             // Go through all meshes
-            for (uint32 mesh_idx = 0; mesh_idx < scene->mNumMeshes; ++mesh_idx)
+            ParallelFor(scene->mNumMeshes, [&](size_t mesh_idx)
             {
-                aiMesh* mesh = scene->mMeshes[mesh_idx];
+                const aiMesh* mesh = scene->mMeshes[mesh_idx];
+                const FMeshSectionData& sectionData = meshSections[mesh_idx];
 
-                // Track submesh
-                FMeshSectionData sectionData{};
-                sectionData.VertexStart = (uint32)importedMeshData.PositionData.size();
-                sectionData.VertexCount = mesh->mNumVertices;
-                sectionData.IndexStart = (uint32)indices.size();
-                sectionData.IndexCount = 0;
-                // Count indices
+                uint32 indexOffset = sectionData.IndexStart;
                 for (uint32 faceIndex = 0; faceIndex < mesh->mNumFaces; ++faceIndex)
                 {
                     const aiFace& face = mesh->mFaces[faceIndex];
                     for (uint32 index_idx = 0; index_idx < face.mNumIndices; ++index_idx)
-                        indices.push_back(face.mIndices[index_idx]);
-                    sectionData.IndexCount += face.mNumIndices;
+                        indices[indexOffset++] = face.mIndices[index_idx];
                 }
 
                 // Grab per vertex data
                 for (uint32 vertexIndex = 0; vertexIndex < mesh->mNumVertices; ++vertexIndex)
                 {
-                    importedMeshData.PositionData.push_back(FVector3f{ mesh->mVertices[vertexIndex].x, mesh->mVertices[vertexIndex].y, mesh->mVertices[vertexIndex].z });
+                    const uint32 dstIndex = sectionData.VertexStart + vertexIndex;
+
+                    importedMeshData.PositionData[dstIndex] = FVector3f{ mesh->mVertices[vertexIndex].x, mesh->mVertices[vertexIndex].y, mesh->mVertices[vertexIndex].z };
 
                     for (uint32 uvIndex = 0; uvIndex < importedMeshData.NumTexCoord; uvIndex++)
                     {
                         if (mesh->HasTextureCoords(uvIndex))
                         {
-                            importedMeshData.UVData.push_back(FVector2f{ mesh->mTextureCoords[uvIndex][vertexIndex].x, mesh->mTextureCoords[uvIndex][vertexIndex].y });
-                        }
-                        else
-                        {
-                            importedMeshData.UVData.push_back(FVector2f{});
+                            importedMeshData.UVData[dstIndex * importedMeshData.NumTexCoord + uvIndex] = FVector2f{ mesh->mTextureCoords[uvIndex][vertexIndex].x, mesh->mTextureCoords[uvIndex][vertexIndex].y };
                         }
                     }
 
                     if (mesh->HasNormals())
                     {
-                        importedMeshData.NormalData.push_back(FVector3f{ mesh->mNormals[vertexIndex].x, mesh->mNormals[vertexIndex].y, mesh->mNormals[vertexIndex].z });
+                        importedMeshData.NormalData[dstIndex] = FVector3f{ mesh->mNormals[vertexIndex].x, mesh->mNormals[vertexIndex].y, mesh->mNormals[vertexIndex].z };
                     }
 
                     if (mesh->HasTangentsAndBitangents())
                     {
-                        importedMeshData.TangentData.push_back(FVector3f{ mesh->mTangents[vertexIndex].x, mesh->mTangents[vertexIndex].y, mesh->mTangents[vertexIndex].z });
+                        importedMeshData.TangentData[dstIndex] = FVector3f{ mesh->mTangents[vertexIndex].x, mesh->mTangents[vertexIndex].y, mesh->mTangents[vertexIndex].z };
                     }
 
                     if (mesh->HasVertexColors(0))
                     {
-                        importedMeshData.VertexColorData.push_back(FVector4f{mesh->mColors[0]->r, mesh->mColors[0]->g, mesh->mColors[0]->b, mesh->mColors[0]->a});
-                    }
-                    else
-                    {
-                        importedMeshData.VertexColorData.push_back(FVector4f{});
+                        const aiColor4D& vertexColor = mesh->mColors[0][vertexIndex];
+                        importedMeshData.VertexColorData[dstIndex] = FVector4f{ vertexColor.r, vertexColor.g, vertexColor.b, vertexColor.a };
                     }
                 }
-
-                // Track material
-                submeshToMaterialIndex.push_back(mesh->mMaterialIndex);
-
-                // Track submesh
-                meshSections.push_back(sectionData);
-            }
+            }, 1, "LoadStaticMesh");
 
             importedMeshData.HasNormal = importedMeshData.NormalData.size() > 0;
             importedMeshData.HasTangent = importedMeshData.TangentData.size() > 0;
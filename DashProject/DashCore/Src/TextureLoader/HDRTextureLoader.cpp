@@ -3,6 +3,7 @@
 #include "DirectXTex/DirectXTex.h"
 #include "Utility/StringUtility.h"
 #include "TextureLoaderHelper.h"
+#include "Utility/CpuProfiler.h"
 
 using namespace DirectX;
 
@@ -10,6 +11,8 @@ namespace Dash
 {
 	bool LoadHDRTextureFromFile(const std::string& fileName, FTextureBufferDescription& textureDescription, std::vector<FSubResourceData>& subResource, std::vector<uint8>& decodedData)
 	{
+		DASH_CPU_SCOPE("LoadHDRTextureFromFile");
+
 		std::wstring wFileName = FStringUtility::UTF8ToWideString(fileName);
 
 		TexMetadata metadata;
@@ -3,6 +3,7 @@
 #include "DirectXTex/DirectXTex.h"
 #include "Utility/StringUtility.h"
 #include "TextureLoaderHelper.h"
+#include "Utility/CpuProfiler.h"
 
 using namespace DirectX;
 
@@ -23,6 +24,8 @@ namespace Dash
 
 	bool LoadTGATextureFromFile(const std::string& fileName, ETGA_LOAD_FLAGS loadFlags, FTextureBufferDescription& textureDescription, std::vector<FSubResourceData>& subResource, std::vector<uint8>& decodedData)
 	{
+		DASH_CPU_SCOPE("LoadTGATextureFromFile");
+
 		std::wstring wFileName = FStringUtility::UTF8ToWideString(fileName);
 
 		TexMetadata metadata;
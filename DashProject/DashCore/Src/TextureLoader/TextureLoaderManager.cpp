@@ -2,6 +2,7 @@
 #include "TextureLoaderManager.h"
 #include "Utility/FileUtility.h"
 #include "Utility/StringUtility.h"
+#include "Utility/ParallelAlgorithms.h"
 
 namespace Dash
 {
@@ -23,7 +24,8 @@ namespace Dash
 
 	const FImportedTextureData& FTextureLoaderManager::LoadTexture(const std::string& texturePath, bool forceSrgb)
 	{
-		if (!mImportTextures.contains(texturePath))
+		auto textureIter = mImportTextures.find(texturePath);
+		if (textureIter == mImportTextures.end())
 		{
 			bool loadSucceed = false;
 
@@ -53,29 +55,30 @@ namespace Dash
 
 				if (loadSucceed)
 				{
-					mImportTextures.emplace(texturePath, importedTextureData);
+					textureIter = mImportTextures.emplace(texturePath, std::make_unique<FImportedTextureData>(std::move(importedTextureData))).first;
 				}
 			}
 			
 			if (!loadSucceed)
 			{
 				DASH_LOG(LogTemp, Error, "Failed to load texture : {}", texturePath);
-				return mImportTextures["ErrorTexture"];
+				return *mImportTextures.at("ErrorTexture");
 			}
 		}
 
-		mImportTextures[texturePath].AddRef();
-		return mImportTextures[texturePath];
+		textureIter->second->AddRef();
+		return *textureIter->second;
 	}
 
 	bool FTextureLoaderManager::UnloadTexture(const std::string& texturePath)
 	{
-		if (mImportTextures.contains(texturePath))
+		auto textureIter = mImportTextures.find(texturePath);
+		if (textureIter != mImportTextures.end())
 		{
-			int32 RefCount = mImportTextures[texturePath].Release();
+			int32 RefCount = textureIter->second->Release();
 			if (RefCount <= 0)
 			{
-				mImportTextures.erase(texturePath);		
+				mImportTextures.erase(textureIter);
 			}
 			return true;
 		}
@@ -96,15 +99,12 @@ namespace Dash
 		importedTextureData.TextureDescription = FTextureBufferDescription::Create2D(EResourceFormat::RGBA8_Unsigned_Norm, width, height);
 		importedTextureData.DecodedData.resize(importedTextureData.TextureDescription.ResourceSizeInBytes());
 
-		FColor* DataPtr = (FColor*)importedTextureData.DecodedData.data();
-
-		for (uint32 y = 0; y < importedTextureData.TextureDescription.Magnitude.Height; y++)
+		// Small textures, like the 32x32 defaults, stay below one chunk and are filled on this thread.
+		std::span<FColor> pixels((FColor*)importedTextureData.DecodedData.data(), importedTextureData.DecodedData.size() / sizeof(FColor));
+		ParallelForRange(pixels.size(), [&](size_t begin, size_t end)
 		{
-			for (uint32 x = 0; x < importedTextureData.TextureDescription.Magnitude.Width; x++)
-			{
-				*DataPtr = color;
-			}
-		}
+			std::fill(pixels.begin() + begin, pixels.begin() + end, color);
+		}, 64 * 1024, "ConstructPureColorTexture");
 
 		void* dataPtr = importedTextureData.DecodedData.data();
 		size_t rowPitch = 0;
@@ -116,6 +116,6 @@ namespace Dash
 
 		importedTextureData.AddRef();
 
-		mImportTextures.emplace(importedTextureData.SourceTexturePath, importedTextureData);
+		mImportTextures.emplace(std::string(textureName), std::make_unique<FImportedTextureData>(std::move(importedTextureData)));
 	}
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "TGATextureLoader.h"
 #include "WICTextureLoader.h"
 #include "TextureLoaderHelper.h"
+#include "Utility/FlatHashMap.h"
 
 namespace Dash
 {	
@@ -26,6 +27,7 @@ namespace Dash
 		void ConstructPureColorTexture(const std::string_view& textureName, const FColor& color, int32 width = 32, int32 height = 32);
 
 	private:
-		std::map<std::string, FImportedTextureData> mImportTextures;
+		// Boxed, textures keep references to their data across rehashes.
+		TFlatHashMap<std::string, std::unique_ptr<FImportedTextureData>> mImportTextures;
 	};
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "DirectXTex/DirectXTex.h"
 #include "Utility/StringUtility.h"
 #include "TextureLoaderHelper.h"
+#include "Utility/CpuProfiler.h"
 
 using namespace DirectX;
 
@@ -34,6 +35,8 @@ namespace Dash
 
 	bool LoadWICTextureFromFile(const std::string& fileName, EWIC_LOAD_FLAGS loadFlags, FTextureBufferDescription& textureDescription, std::vector<FSubResourceData>& subResource, std::vector<uint8>& decodedData)
 	{
+		DASH_CPU_SCOPE("LoadWICTextureFromFile");
+
 		std::wstring wFileName = FStringUtility::UTF8ToWideString(fileName);
 
 		TexMetadata metadata;
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Dash
+{
+	// Alignment that keeps data written by different threads on separate cache lines, so they do not invalidate
+	// each other. 64 bytes on every x64 CPU the engine targets.
+	constexpr size_t GCacheLineSize = 64;
+}
@@ -0,0 +1,201 @@
+#include "PCH.h"
+#include "CpuFeatures.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+namespace Dash
+{
+	struct FCpuIdRegisters
+	{
+		uint32 EAX = 0;
+		uint32 EBX = 0;
+		uint32 ECX = 0;
+		uint32 EDX = 0;
+	};
+
+	static FCpuIdRegisters CpuId(uint32 leaf, uint32 subLeaf = 0)
+	{
+		FCpuIdRegisters result;
+
+#if defined(_MSC_VER)
+		int registers[4];
+		__cpuidex(registers, static_cast<int>(leaf), static_cast<int>(subLeaf));
+		result.EAX = static_cast<uint32>(registers[0]);
+		result.EBX = static_cast<uint32>(registers[1]);
+		result.ECX = static_cast<uint32>(registers[2]);
+		result.EDX = static_cast<uint32>(registers[3]);
+#else
+		__cpuid_count(leaf, subLeaf, result.EAX, result.EBX, result.ECX, result.EDX);
+#endif
+
+		return result;
+	}
+
+	// XCR0, the register state the OS saves on context switches.
+	static uint64 ReadXCR0()
+	{
+#if defined(_MSC_VER)
+		return _xgetbv(0);
+#else
+		uint32 eax, edx;
+		__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+		return (static_cast<uint64>(edx) << 32) | eax;
+#endif
+	}
+
+	static bool HasBit(uint32 value, uint32 bit)
+	{
+		return (value >> bit) & 1;
+	}
+
+	const FCpuFeatures& FCpuFeatures::Get()
+	{
+		static const FCpuFeatures Features;
+		return Features;
+	}
+
+	FCpuFeatures::FCpuFeatures()
+	{
+		FCpuIdRegisters leaf0 = CpuId(0);
+		const uint32 maxLeaf = leaf0.EAX;
+
+		char vendor[13] = {};
+		std::memcpy(vendor, &leaf0.EBX, 4);
+		std::memcpy(vendor + 4, &leaf0.EDX, 4);
+		std::memcpy(vendor + 8, &leaf0.ECX, 4);
+		mVendor = vendor;
+
+		if (CpuId(0x80000000).EAX >= 0x80000004)
+		{
+			char brand[49] = {};
+			for (uint32 i = 0; i < 3; ++i)
+			{
+				FCpuIdRegisters leaf = CpuId(0x80000002 + i);
+				std::memcpy(brand + i * 16, &leaf, 16);
+			}
+
+			mBrand = brand;
+			mBrand.erase(0, mBrand.find_first_not_of(' '));
+		}
+
+		FCpuIdRegisters leaf1 = CpuId(1);
+		SSE3 = HasBit(leaf1.ECX, 0);
+		SSSE3 = HasBit(leaf1.ECX, 9);
+		FMA = HasBit(leaf1.ECX, 12);
+		SSE41 = HasBit(leaf1.ECX, 19);
+		SSE42 = HasBit(leaf1.ECX, 20);
+		POPCNT = HasBit(leaf1.ECX, 23);
+		F16C = HasBit(leaf1.ECX, 29);
+
+		// AVX state must be enabled by the OS as well, otherwise the first YMM instruction faults.
+		const bool osxsave = HasBit(leaf1.ECX, 27);
+		const uint64 xcr0 = osxsave ? ReadXCR0() : 0;
+		const bool osYmm = (xcr0 & 0x6) == 0x6;
+		const bool osZmm = (xcr0 & 0xE6) == 0xE6;
+
+		AVX = HasBit(leaf1.ECX, 28) && osYmm;
+		FMA = FMA && AVX;
+		F16C = F16C && AVX;
+
+		if (maxLeaf >= 7)
+		{
+			FCpuIdRegisters leaf7 = CpuId(7, 0);
+			BMI1 = HasBit(leaf7.EBX, 3);
+			AVX2 = HasBit(leaf7.EBX, 5) && AVX;
+			BMI2 = HasBit(leaf7.EBX, 8);
+			AVX512F = HasBit(leaf7.EBX, 16) && osZmm;
+			AVX512DQ = HasBit(leaf7.EBX, 17) && AVX512F;
+			AVX512BW = HasBit(leaf7.EBX, 30) && AVX512F;
+			AVX512VL = HasBit(leaf7.EBX, 31) && AVX512F;
+		}
+
+		if (SSE41 && SSE42 && POPCNT)
+		{
+			mIsa = ECpuIsa::SSE42;
+
+			if (AVX2 && FMA && F16C && BMI1 && BMI2)
+			{
+				mIsa = ECpuIsa::AVX2;
+
+				if (AVX512F && AVX512DQ && AVX512BW && AVX512VL)
+				{
+					mIsa = ECpuIsa::AVX512;
+				}
+			}
+		}
+	}
+
+	bool FCpuFeatures::SupportsBuildBaseline() const
+	{
+		bool supported = true;
+
+#if defined(__SSE4_1__) || defined(USE_SSE)
+		// Vector4_SSE.h uses SSE4.1 rounding and blends whenever USE_SSE is defined.
+		supported = supported && SSE41;
+#endif
+#if defined(__SSE4_2__)
+		supported = supported && SSE42;
+#endif
+#if defined(__AVX__)
+		supported = supported && AVX;
+#endif
+#if defined(__AVX2__)
+		supported = supported && AVX2;
+#endif
+#if defined(__FMA__) || defined(DASH_USE_FMA)
+		supported = supported && FMA;
+#endif
+#if defined(__F16C__)
+		supported = supported && F16C;
+#endif
+#if defined(__AVX512F__)
+		supported = supported && AVX512F;
+#endif
+
+		return supported;
+	}
+
+	std::string FCpuFeatures::ToString() const
+	{
+		std::string result = "SSE2";
+
+		const std::pair<bool, const char*> features[] =
+		{
+			{ SSE3, "SSE3" }, { SSSE3, "SSSE3" }, { SSE41, "SSE4.1" }, { SSE42, "SSE4.2" }, { POPCNT, "POPCNT" },
+			{ AVX, "AVX" }, { AVX2, "AVX2" }, { FMA, "FMA" }, { F16C, "F16C" }, { BMI1, "BMI1" }, { BMI2, "BMI2" },
+			{ AVX512F, "AVX512F" }, { AVX512DQ, "AVX512DQ" }, { AVX512BW, "AVX512BW" }, { AVX512VL, "AVX512VL" },
+		};
+
+		for (const auto& [supported, name] : features)
+		{
+			if (supported)
+			{
+				result += ", ";
+				result += name;
+			}
+		}
+
+		return result;
+	}
+
+	const char* FCpuFeatures::GetIsaName(ECpuIsa isa)
+	{
+		switch (isa)
+		{
+		case ECpuIsa::SSE2:
+			return "SSE2";
+		case ECpuIsa::SSE42:
+			return "SSE4.2";
+		case ECpuIsa::AVX2:
+			return "AVX2";
+		case ECpuIsa::AVX512:
+			return "AVX-512";
+		default:
+			return "Unknown";
+		}
+	}
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <initializer_list>
+
+// Code regions compiled for a specific instruction set, regardless of the /arch or -m flags of the translation unit.
+// Functions inside a region must only be called after FCpuFeatures reports the matching ECpuIsa level,
+// usually through SelectCpuFunction. MSVC accepts every intrinsic without /arch, so the regions are empty there.
+#if defined(__clang__)
+#define DASH_TARGET_BEGIN(isa) _Pragma("clang attribute push (__attribute__((target(\"" isa "\"))), apply_to = function)")
+#define DASH_TARGET_END _Pragma("clang attribute pop")
+#elif defined(__GNUC__)
+#define DASH_TARGET_PRAGMA(x) _Pragma(#x)
+#define DASH_TARGET_BEGIN(isa) _Pragma("GCC push_options") DASH_TARGET_PRAGMA(GCC target(isa))
+#define DASH_TARGET_END _Pragma("GCC pop_options")
+#else
+#define DASH_TARGET_BEGIN(isa)
+#define DASH_TARGET_END
+#endif
+
+#define DASH_TARGET_SSE42_BEGIN DASH_TARGET_BEGIN("sse4.2,popcnt")
+#define DASH_TARGET_AVX2_BEGIN DASH_TARGET_BEGIN("avx2,fma,f16c,bmi,bmi2")
+#define DASH_TARGET_AVX512_BEGIN DASH_TARGET_BEGIN("avx512f,avx512dq,avx512bw,avx512vl,avx2,fma,f16c,bmi,bmi2")
+
+namespace Dash
+{
+	// Instruction set levels the kernels are specialized for, each level implies the ones below it.
+	//   SSE2     x64 baseline
+	//   SSE42    SSE4.1 + SSE4.2 + POPCNT
+	//   AVX2     AVX + AVX2 + FMA + F16C + BMI1/2, with OS support for the YMM state
+	//   AVX512   AVX-512 F/DQ/BW/VL, with OS support for the ZMM and opmask state
+	enum class ECpuIsa : uint8
+	{
+		SSE2,
+		SSE42,
+		AVX2,
+		AVX512,
+	};
+
+	class FCpuFeatures
+	{
+	public:
+		// Probed once on first use, the result never changes afterwards.
+		static const FCpuFeatures& Get();
+
+		ECpuIsa GetIsa() const { return mIsa; }
+		bool Supports(ECpuIsa isa) const { return mIsa >= isa; }
+
+		// False when the binary was built for instructions (/arch, -m flags, USE_SSE) this CPU lacks.
+		bool SupportsBuildBaseline() const;
+
+		const std::string& GetVendor() const { return mVendor; }
+		const std::string& GetBrand() const { return mBrand; }
+
+		// Comma separated list of the detected features, for the startup log.
+		std::string ToString() const;
+
+		static const char* GetIsaName(ECpuIsa isa);
+
+	public:
+		bool SSE3 = false;
+		bool SSSE3 = false;
+		bool SSE41 = false;
+		bool SSE42 = false;
+		bool POPCNT = false;
+		bool AVX = false;
+		bool AVX2 = false;
+		bool FMA = false;
+		bool F16C = false;
+		bool BMI1 = false;
+		bool BMI2 = false;
+		bool AVX512F = false;
+		bool AVX512DQ = false;
+		bool AVX512BW = false;
+		bool AVX512VL = false;
+
+	private:
+		FCpuFeatures();
+
+		ECpuIsa mIsa = ECpuIsa::SSE2;
+		std::string mVendor;
+		std::string mBrand;
+	};
+
+	template<typename FunctionType>
+	struct TCpuDispatchEntry
+	{
+		ECpuIsa Isa;
+		FunctionType* Function;
+	};
+
+	// Picks the first candidate the CPU supports, candidates are listed from the widest instruction set down
+	// and the last one should be the SSE2 baseline. Meant to initialize a function local static, e.g.
+	//   static const auto kernel = SelectCpuFunction<KernelType>({ { ECpuIsa::AVX2, &KernelAVX2 }, { ECpuIsa::SSE2, &KernelSSE2 } });
+	template<typename FunctionType>
+	FunctionType* SelectCpuFunction(std::initializer_list<TCpuDispatchEntry<FunctionType>> candidates)
+	{
+		const FCpuFeatures& features = FCpuFeatures::Get();
+
+		for (const TCpuDispatchEntry<FunctionType>& candidate : candidates)
+		{
+			if (features.Supports(candidate.Isa))
+			{
+				return candidate.Function;
+			}
+		}
+
+		ASSERT(false);
+		return nullptr;
+	}
+}
@@ -0,0 +1,368 @@
+#include "PCH.h"
+#include "CpuProfiler.h"
+#include "FileUtility.h"
+
+namespace Dash
+{
+	// Events per thread ring, a power of two.
+	static constexpr uint64 GCpuProfilerEventCapacity = 16 * 1024;
+
+	// Hands the thread's buffer back when the thread exits.
+	struct FCpuProfilerThreadHandle
+	{
+		FCpuProfiler::FThreadBuffer* Buffer = nullptr;
+
+		~FCpuProfilerThreadHandle()
+		{
+			if (Buffer != nullptr)
+			{
+				FCpuProfiler::Get().ReleaseThreadBuffer(Buffer);
+			}
+		}
+	};
+
+	static thread_local FCpuProfilerThreadHandle GCpuProfilerThread;
+
+	static void AppendJsonString(std::string& out, std::string_view text)
+	{
+		out += '"';
+		for (char character : text)
+		{
+			switch (character)
+			{
+			case '"': out += "\\\""; break;
+			case '\\': out += "\\\\"; break;
+			case '\n': out += "\\n"; break;
+			case '\r': out += "\\r"; break;
+			case '\t': out += "\\t"; break;
+			default:
+				if (static_cast<unsigned char>(character) < 0x20)
+				{
+					std::format_to(std::back_inserter(out), "\\u{:04x}", static_cast<uint32>(character));
+				}
+				else
+				{
+					out += character;
+				}
+				break;
+			}
+		}
+		out += '"';
+	}
+
+	FCpuProfiler& FCpuProfiler::Get()
+	{
+		static FCpuProfiler instance;
+		return instance;
+	}
+
+	FCpuProfiler::FCpuProfiler()
+		: mStartTime(std::chrono::steady_clock::now())
+	{
+	}
+
+	void FCpuProfiler::BeginFrame()
+	{
+		const uint64 timestamp = GetTimestamp();
+
+		std::lock_guard<std::mutex> lock(mThreadsLock);
+
+		uint64 droppedEvents = 0;
+		for (const std::unique_ptr<FThreadBuffer>& buffer : mThreadBuffers)
+		{
+			DrainThreadBuffer(*buffer);
+			droppedEvents += buffer->DroppedEvents.exchange(0, std::memory_order_relaxed);
+		}
+
+		mLastFrame.DroppedEvents = droppedEvents;
+		FinishFrame(timestamp);
+	}
+
+	void FCpuProfiler::BeginScope(const char* name)
+	{
+		FThreadBuffer& buffer = GetThreadBuffer();
+		++buffer.Depth;
+
+		if (buffer.SkipDepth != 0)
+		{
+			if (buffer.bSkipDropped)
+			{
+				buffer.DroppedEvents.fetch_add(1, std::memory_order_relaxed);
+			}
+			return;
+		}
+
+		if (!IsEnabled())
+		{
+			buffer.SkipDepth = buffer.Depth;
+			buffer.bSkipDropped = false;
+			return;
+		}
+
+		// The begin and the ends of every open scope including this one.
+		if (!PushEvent(buffer, FEvent{ name, GetTimestamp(), false }, buffer.Depth + 1))
+		{
+			buffer.SkipDepth = buffer.Depth;
+			buffer.bSkipDropped = true;
+			buffer.DroppedEvents.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	void FCpuProfiler::EndScope()
+	{
+		const uint64 timestamp = GetTimestamp();
+
+		FThreadBuffer& buffer = GetThreadBuffer();
+		ASSERT_MSG(buffer.Depth > 0, "EndScope without a matching BeginScope.");
+
+		if (buffer.SkipDepth != 0)
+		{
+			if (buffer.bSkipDropped)
+			{
+				buffer.DroppedEvents.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			if (buffer.SkipDepth == buffer.Depth)
+			{
+				buffer.SkipDepth = 0;
+			}
+		}
+		else
+		{
+			// BeginScope left room for it.
+			if (!PushEvent(buffer, FEvent{ nullptr, timestamp, true }, 1))
+			{
+				ASSERT_FAIL("CPU profiler ring has no room for a scope end.");
+			}
+		}
+
+		--buffer.Depth;
+	}
+
+	void FCpuProfiler::SetThreadName(const std::string& name)
+	{
+		FThreadBuffer& buffer = GetThreadBuffer();
+		buffer.bNamed = true;
+
+		std::lock_guard<std::mutex> lock(mThreadsLock);
+		buffer.ThreadName = name;
+	}
+
+	FCpuProfileFrame FCpuProfiler::GetLastFrame() const
+	{
+		std::lock_guard<std::mutex> lock(mThreadsLock);
+		return mLastFrame;
+	}
+
+	void FCpuProfiler::BeginCapture()
+	{
+		std::lock_guard<std::mutex> lock(mThreadsLock);
+		mCapturedScopes.clear();
+		mCapturing = true;
+	}
+
+	bool FCpuProfiler::EndCapture(const std::string& filePath)
+	{
+		std::string json;
+
+		{
+			std::lock_guard<std::mutex> lock(mThreadsLock);
+
+			// Scopes that ended since the last frame belong to the capture as well.
+			for (const std::unique_ptr<FThreadBuffer>& buffer : mThreadBuffers)
+			{
+				DrainThreadBuffer(*buffer);
+			}
+
+			mCapturing = false;
+
+			json.reserve(128 * mCapturedScopes.size() + 1024);
+			json += "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+
+			for (const std::unique_ptr<FThreadBuffer>& buffer : mThreadBuffers)
+			{
+				json += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,";
+				std::format_to(std::back_inserter(json), "\"tid\":{},\"args\":{{\"name\":", buffer->ThreadId);
+				AppendJsonString(json, buffer->ThreadName.empty() ? std::format("Thread {}", buffer->ThreadId) : buffer->ThreadName);
+				json += "}},\n";
+			}
+
+			// Complete events, timestamps in microseconds.
+			for (const FCapturedScope& scope : mCapturedScopes)
+			{
+				json += "{\"name\":";
+				AppendJsonString(json, scope.Name);
+				std::format_to(std::back_inserter(json), ",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}},\n",
+					scope.ThreadId, scope.BeginTimestamp / 1000.0, scope.DurationNs / 1000.0);
+			}
+
+			mCapturedScopes.clear();
+			mCapturedScopes.shrink_to_fit();
+		}
+
+		// Drop the separator after the last event.
+		if (json.ends_with(",\n"))
+		{
+			json.resize(json.size() - 2);
+			json += '\n';
+		}
+		json += "]}\n";
+
+		if (!FFileUtility::WriteTextFileSync(filePath, json))
+		{
+			DASH_LOG(LogTemp, Error, "Failed to write CPU profile capture to {}.", filePath);
+			return false;
+		}
+
+		return true;
+	}
+
+	FJobProfilingHooks FCpuProfiler::GetJobProfilingHooks()
+	{
+		FJobProfilingHooks hooks;
+		hooks.OnJobBegin = &FCpuProfiler::OnJobBegin;
+		hooks.OnJobEnd = &FCpuProfiler::OnJobEnd;
+		return hooks;
+	}
+
+	FCpuProfiler::FThreadBuffer& FCpuProfiler::GetThreadBuffer()
+	{
+		if (GCpuProfilerThread.Buffer != nullptr)
+		{
+			return *GCpuProfilerThread.Buffer;
+		}
+
+		std::lock_guard<std::mutex> lock(mThreadsLock);
+
+		FThreadBuffer* buffer = nullptr;
+		for (const std::unique_ptr<FThreadBuffer>& threadBuffer : mThreadBuffers)
+		{
+			// Events of the previous owner must be drained first, they belong to its thread id.
+			if (threadBuffer->bFree && threadBuffer->Head.load(std::memory_order_relaxed) == threadBuffer->Tail.load(std::memory_order_relaxed))
+			{
+				buffer = threadBuffer.get();
+				break;
+			}
+		}
+
+		if (buffer == nullptr)
+		{
+			mThreadBuffers.push_back(std::make_unique<FThreadBuffer>());
+			buffer = mThreadBuffers.back().get();
+			buffer->Events.reset(new FEvent[GCpuProfilerEventCapacity]);
+		}
+
+		buffer->bFree = false;
+		buffer->bNamed = false;
+		buffer->ThreadName.clear();
+		buffer->ThreadId = mNextThreadId++;
+
+		GCpuProfilerThread.Buffer = buffer;
+		return *buffer;
+	}
+
+	void FCpuProfiler::ReleaseThreadBuffer(FThreadBuffer* buffer)
+	{
+		std::lock_guard<std::mutex> lock(mThreadsLock);
+		buffer->bFree = true;
+	}
+
+	uint64 FCpuProfiler::GetTimestamp() const
+	{
+		return static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mStartTime).count());
+	}
+
+	bool FCpuProfiler::PushEvent(FThreadBuffer& buffer, const FEvent& event, uint64 required)
+	{
+		const uint64 head = buffer.Head.load(std::memory_order_relaxed);
+		const uint64 tail = buffer.Tail.load(std::memory_order_acquire);
+
+		if (head - tail + required > GCpuProfilerEventCapacity)
+		{
+			return false;
+		}
+
+		buffer.Events[head & (GCpuProfilerEventCapacity - 1)] = event;
+		buffer.Head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	void FCpuProfiler::DrainThreadBuffer(FThreadBuffer& buffer)
+	{
+		const uint64 head = buffer.Head.load(std::memory_order_acquire);
+		uint64 tail = buffer.Tail.load(std::memory_order_relaxed);
+
+		for (; tail != head; ++tail)
+		{
+			const FEvent& event = buffer.Events[tail & (GCpuProfilerEventCapacity - 1)];
+
+			if (!event.bEnd)
+			{
+				buffer.OpenScopes.push_back(FOpenScope{ event.Name, event.Timestamp, 0 });
+				continue;
+			}
+
+			ASSERT(!buffer.OpenScopes.empty());
+			const FOpenScope scope = buffer.OpenScopes.back();
+			buffer.OpenScopes.pop_back();
+
+			const uint64 durationNs = event.Timestamp - scope.BeginTimestamp;
+			if (!buffer.OpenScopes.empty())
+			{
+				buffer.OpenScopes.back().ChildrenNs += durationNs;
+			}
+
+			// Scopes of the same name share one entry, wherever the literal lives.
+			auto [iter, inserted] = mFrameScopeIndices.try_emplace(std::string_view(scope.Name), static_cast<uint32>(mFrameScopes.size()));
+			if (inserted)
+			{
+				mFrameScopes.push_back(FCpuProfileScopeStats{ std::string(scope.Name) });
+			}
+
+			FCpuProfileScopeStats& stats = mFrameScopes[iter->second];
+			stats.InclusiveNs += durationNs;
+			stats.ExclusiveNs += durationNs - std::min(scope.ChildrenNs, durationNs);
+			++stats.CallCount;
+
+			if (mCapturing)
+			{
+				mCapturedScopes.push_back(FCapturedScope{ scope.Name, scope.BeginTimestamp, durationNs, buffer.ThreadId });
+			}
+		}
+
+		buffer.Tail.store(tail, std::memory_order_release);
+	}
+
+	void FCpuProfiler::FinishFrame(uint64 frameEndTimestamp)
+	{
+		std::sort(mFrameScopes.begin(), mFrameScopes.end(), [](const FCpuProfileScopeStats& a, const FCpuProfileScopeStats& b)
+		{
+			return a.InclusiveNs > b.InclusiveNs;
+		});
+
+		mLastFrame.FrameIndex = mFrameIndex++;
+		mLastFrame.DurationNs = frameEndTimestamp - mFrameBeginTimestamp;
+		mLastFrame.Scopes.swap(mFrameScopes);
+
+		mFrameBeginTimestamp = frameEndTimestamp;
+		mFrameScopes.clear();
+		mFrameScopeIndices.clear();
+	}
+
+	void FCpuProfiler::OnJobBegin(const char* name, EJobPriority priority, uint32 workerIndex)
+	{
+		FCpuProfiler& profiler = Get();
+
+		if (!profiler.GetThreadBuffer().bNamed && workerIndex < FJobSystem::Get().GetNumWorkers())
+		{
+			profiler.SetThreadName(std::format("Job Worker {}", workerIndex));
+		}
+
+		profiler.BeginScope(name);
+	}
+
+	void FCpuProfiler::OnJobEnd(const char* name, EJobPriority priority, uint32 workerIndex)
+	{
+		Get().EndScope();
+	}
+}
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "FlatHashMap.h"
+#include "JobSystem.h"
+
+namespace Dash
+{
+	struct FCpuProfileScopeStats
+	{
+		std::string Name;
+
+		// Time from begin to end, including nested scopes, summed over all calls and threads.
+		uint64 InclusiveNs = 0;
+
+		// InclusiveNs minus the time spent in nested scopes.
+		uint64 ExclusiveNs = 0;
+
+		uint32 CallCount = 0;
+	};
+
+	struct FCpuProfileFrame
+	{
+		uint64 FrameIndex = 0;
+
+		// Time between the BeginFrame calls that enclose the frame.
+		uint64 DurationNs = 0;
+
+		// Every scope that ended during the frame, by descending inclusive time.
+		std::vector<FCpuProfileScopeStats> Scopes;
+
+		// Events lost during the frame because a thread buffer was full.
+		uint64 DroppedEvents = 0;
+	};
+
+	// Hierarchical CPU profiler fed by DASH_CPU_SCOPE.
+	//
+	// A scope writes a begin and an end event with a nanosecond timestamp into a ring owned by its thread, which takes
+	// no lock. BeginFrame drains every ring on the main thread, pairs the events into scopes and sums them per name
+	// for the frame that just ended. While a capture is running the paired scopes are kept as well, and EndCapture
+	// writes them as Chrome trace event JSON, which chrome://tracing and Perfetto open.
+	//
+	// Scope names are stored as pointers and read when the frame is drained or the capture written, so they must
+	// outlive both: use string literals.
+	class FCpuProfiler
+	{
+	public:
+		static FCpuProfiler& Get();
+
+		/**
+		 * Collect the scopes of the frame that just ended and start a new one. Called once per frame by the main loop.
+		 */
+		void BeginFrame();
+
+		/**
+		 * Every BeginScope on a thread is matched by one EndScope on the same thread, in reverse order.
+		 */
+		void BeginScope(const char* name);
+		void EndScope();
+
+		/**
+		 * Takes effect for scopes that begin afterwards, scopes that are already open end as they began.
+		 */
+		void SetEnabled(bool enabled) { mEnabled.store(enabled, std::memory_order_relaxed); }
+		bool IsEnabled() const { return mEnabled.load(std::memory_order_relaxed); }
+
+		/**
+		 * Name the calling thread in captures, a copy of name is kept.
+		 */
+		void SetThreadName(const std::string& name);
+
+		FCpuProfileFrame GetLastFrame() const;
+
+		/**
+		 * Keep every scope that ends from now on, until EndCapture.
+		 */
+		void BeginCapture();
+
+		/**
+		 * Write the captured scopes to filePath as Chrome trace event JSON and stop capturing.
+		 * @returns false if the file could not be written, the capture is discarded either way.
+		 */
+		bool EndCapture(const std::string& filePath);
+
+		bool IsCapturing() const { return mCapturing; }
+
+		/**
+		 * Hooks that record every job as a scope named after the job, install them before FJobSystem::Init.
+		 */
+		static FJobProfilingHooks GetJobProfilingHooks();
+
+	private:
+		FCpuProfiler();
+
+		struct FEvent
+		{
+			const char* Name;
+
+			// Nanoseconds since the profiler was created.
+			uint64 Timestamp;
+
+			bool bEnd;
+		};
+
+		struct FOpenScope
+		{
+			const char* Name;
+			uint64 BeginTimestamp;
+			uint64 ChildrenNs;
+		};
+
+		struct FCapturedScope
+		{
+			const char* Name;
+			uint64 BeginTimestamp;
+			uint64 DurationNs;
+			uint32 ThreadId;
+		};
+
+		struct FThreadBuffer
+		{
+			// Single producer single consumer ring: the owning thread writes at Head, BeginFrame reads at Tail.
+			std::unique_ptr<FEvent[]> Events;
+			alignas(GCacheLineSize) std::atomic<uint64> Head{ 0 };
+			alignas(GCacheLineSize) std::atomic<uint64> Tail{ 0 };
+
+			// Owning thread only. Scopes begun and not yet ended, and the depth of the outermost scope that is not
+			// recorded, 0 while all are: a scope is skipped when the profiler is off or the ring is full, and so is
+			// everything nested inside it, which keeps the recorded events balanced.
+			uint32 Depth = 0;
+			uint32 SkipDepth = 0;
+			bool bSkipDropped = false;
+			bool bNamed = false;
+
+			std::atomic<uint64> DroppedEvents{ 0 };
+
+			// Everything below is only touched under mThreadsLock.
+			std::vector<FOpenScope> OpenScopes;
+			std::string ThreadName;
+			uint32 ThreadId = 0;
+
+			// The owning thread exited, the next new thread takes the buffer over once it is drained.
+			bool bFree = false;
+		};
+
+		FThreadBuffer& GetThreadBuffer();
+		void ReleaseThreadBuffer(FThreadBuffer* buffer);
+
+		uint64 GetTimestamp() const;
+
+		// Room for required events, so a recorded begin always leaves room for the ends of all open scopes.
+		static bool PushEvent(FThreadBuffer& buffer, const FEvent& event, uint64 required);
+
+		void DrainThreadBuffer(FThreadBuffer& buffer);
+		void FinishFrame(uint64 frameEndTimestamp);
+
+		static void OnJobBegin(const char* name, EJobPriority priority, uint32 workerIndex);
+		static void OnJobEnd(const char* name, EJobPriority priority, uint32 workerIndex);
+
+		friend struct FCpuProfilerThreadHandle;
+
+	private:
+		std::atomic<bool> mEnabled{ true };
+
+		std::chrono::steady_clock::time_point mStartTime;
+
+		mutable std::mutex mThreadsLock;
+		std::vector<std::unique_ptr<FThreadBuffer>> mThreadBuffers;
+		uint32 mNextThreadId = 1;
+
+		// Main thread only, the frame being collected.
+		uint64 mFrameIndex = 0;
+		uint64 mFrameBeginTimestamp = 0;
+		std::vector<FCpuProfileScopeStats> mFrameScopes;
+		TFlatHashMap<std::string_view, uint32> mFrameScopeIndices;
+
+		bool mCapturing = false;
+		std::vector<FCapturedScope> mCapturedScopes;
+
+		// The last finished frame, guarded by mThreadsLock.
+		FCpuProfileFrame mLastFrame;
+	};
+
+	// Times the enclosing block, see DASH_CPU_SCOPE.
+	class FCpuProfilerScope
+	{
+	public:
+		explicit FCpuProfilerScope(const char* name)
+		{
+			FCpuProfiler::Get().BeginScope(name);
+		}
+
+		~FCpuProfilerScope()
+		{
+			FCpuProfiler::Get().EndScope();
+		}
+
+		FCpuProfilerScope(const FCpuProfilerScope&) = delete;
+		FCpuProfilerScope& operator=(const FCpuProfilerScope&) = delete;
+	};
+
+	#define CPU_PROFILER_CONCATENATE_INNER(a, b) a##b
+	#define CPU_PROFILER_CONCATENATE(a, b) CPU_PROFILER_CONCATENATE_INNER(a, b)
+
+	#define DASH_CPU_SCOPE(Name) ::Dash::FCpuProfilerScope CPU_PROFILER_CONCATENATE(CpuProfilerScope, __LINE__)(Name)
+}
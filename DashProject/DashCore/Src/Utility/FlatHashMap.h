@@ -0,0 +1,663 @@
+#pragma once
+
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "Hash.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DASH_FLAT_HASH_SSE2 1
+#else
+#define DASH_FLAT_HASH_SSE2 0
+#endif
+
+namespace Dash
+{
+	// Default hash of the flat hash containers. Strings hash their characters with Hash64, so std::string,
+	// std::string_view and const char* keys of the same text hash alike and can be looked up with each other.
+	template<typename KeyType, typename = void>
+	struct TFlatHash
+	{
+		uint64 operator()(const KeyType& key) const
+		{
+			return HashMix(static_cast<uint64>(std::hash<KeyType>{}(key)), 0x9E3779B97F4A7C15ull);
+		}
+	};
+
+	template<typename KeyType>
+	struct TFlatHash<KeyType, std::enable_if_t<std::is_integral_v<KeyType> || std::is_enum_v<KeyType> || std::is_pointer_v<KeyType>>>
+	{
+		uint64 operator()(KeyType key) const
+		{
+			uint64 value;
+			if constexpr (std::is_pointer_v<KeyType>)
+			{
+				value = static_cast<uint64>(reinterpret_cast<uintptr_t>(key));
+			}
+			else
+			{
+				value = static_cast<uint64>(key);
+			}
+			return HashMix(value, 0x9E3779B97F4A7C15ull);
+		}
+	};
+
+	struct FFlatStringHash
+	{
+		using is_transparent = void;
+
+		uint64 operator()(std::string_view key) const { return Hash64(key.data(), key.size()); }
+		uint64 operator()(const std::string& key) const { return Hash64(key.data(), key.size()); }
+		uint64 operator()(const char* key) const { return operator()(std::string_view(key)); }
+	};
+
+	template<>
+	struct TFlatHash<std::string> : FFlatStringHash {};
+
+	template<>
+	struct TFlatHash<std::string_view> : FFlatStringHash {};
+
+	// Control bytes of one probe group, after the Swiss table design: a full slot stores the low 7 bits of its
+	// hash, so a single compare of 16 control bytes finds the few slots whose keys are worth comparing.
+	struct FFlatHashGroup
+	{
+		static constexpr size_t Width = 16;
+
+		static constexpr int8 Empty = -128;
+		static constexpr int8 Deleted = -2;
+
+		explicit FFlatHashGroup(const int8* control)
+		{
+#if DASH_FLAT_HASH_SSE2
+			mControl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control));
+#else
+			std::memcpy(mControl, control, Width);
+#endif
+		}
+
+		/**
+		 * @returns a bit per slot whose control byte is hash7.
+		 */
+		uint32 Match(int8 hash7) const
+		{
+#if DASH_FLAT_HASH_SSE2
+			return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(hash7), mControl)));
+#else
+			uint32 mask = 0;
+			for (uint32 i = 0; i < Width; ++i)
+			{
+				mask |= static_cast<uint32>(mControl[i] == hash7) << i;
+			}
+			return mask;
+#endif
+		}
+
+		uint32 MatchEmpty() const { return Match(Empty); }
+
+		uint32 MatchEmptyOrDeleted() const
+		{
+#if DASH_FLAT_HASH_SSE2
+			return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), mControl)));
+#else
+			uint32 mask = 0;
+			for (uint32 i = 0; i < Width; ++i)
+			{
+				mask |= static_cast<uint32>(mControl[i] < -1) << i;
+			}
+			return mask;
+#endif
+		}
+
+	private:
+#if DASH_FLAT_HASH_SSE2
+		__m128i mControl;
+#else
+		int8 mControl[Width];
+#endif
+	};
+
+	inline uint32 FlatHashLowestBit(uint32 mask)
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, mask);
+		return static_cast<uint32>(index);
+#else
+		return static_cast<uint32>(__builtin_ctz(mask));
+#endif
+	}
+
+	// Open addressing table shared by TFlatHashMap and TFlatHashSet.
+	//
+	// Slots live in one array next to an array of control bytes, probing walks groups of 16 control bytes
+	// in a triangular sequence. The table grows at 7/8 load. Erase leaves a tombstone, tombstones are
+	// dropped when the table rehashes. Inserting or rehashing invalidates iterators and references.
+	template<typename KeyType, typename SlotType, typename HashType, typename EqualType>
+	class TFlatHashTable
+	{
+	public:
+		using key_type = KeyType;
+		using value_type = SlotType;
+		using size_type = size_t;
+
+		template<bool bConst>
+		class TIterator
+		{
+			friend class TFlatHashTable;
+			using TableType = std::conditional_t<bConst, const TFlatHashTable, TFlatHashTable>;
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = SlotType;
+			using difference_type = std::ptrdiff_t;
+			using pointer = std::conditional_t<bConst, const SlotType*, SlotType*>;
+			using reference = std::conditional_t<bConst, const SlotType&, SlotType&>;
+
+			TIterator() = default;
+			template<bool bOtherConst> requires (bConst && !bOtherConst)
+			TIterator(const TIterator<bOtherConst>& other) : mTable(other.mTable), mIndex(other.mIndex) {}
+
+			reference operator*() const { return mTable->mSlots[mIndex]; }
+			pointer operator->() const { return &mTable->mSlots[mIndex]; }
+
+			TIterator& operator++()
+			{
+				mIndex = mTable->NextFullSlot(mIndex + 1);
+				return *this;
+			}
+
+			TIterator operator++(int)
+			{
+				TIterator result = *this;
+				++*this;
+				return result;
+			}
+
+			bool operator==(const TIterator& other) const { return mIndex == other.mIndex; }
+
+			TIterator(TableType* table, size_t index) : mTable(table), mIndex(index) {}
+
+		private:
+			friend class TIterator<!bConst>;
+
+			TableType* mTable = nullptr;
+			size_t mIndex = 0;
+		};
+
+		using iterator = TIterator<false>;
+		using const_iterator = TIterator<true>;
+
+		TFlatHashTable() = default;
+		TFlatHashTable(const TFlatHashTable& other);
+		TFlatHashTable(TFlatHashTable&& other) noexcept;
+		TFlatHashTable& operator=(const TFlatHashTable& other);
+		TFlatHashTable& operator=(TFlatHashTable&& other) noexcept;
+		~TFlatHashTable();
+
+		iterator begin() { return iterator(this, NextFullSlot(0)); }
+		iterator end() { return iterator(this, mCapacity); }
+		const_iterator begin() const { return const_iterator(this, NextFullSlot(0)); }
+		const_iterator end() const { return const_iterator(this, mCapacity); }
+
+		size_t size() const { return mSize; }
+		bool empty() const { return mSize == 0; }
+		size_t capacity() const { return mCapacity; }
+
+		void clear();
+
+		/**
+		 * Make room for count elements without rehashing.
+		 */
+		void reserve(size_t count);
+
+		template<typename LookupKeyType>
+		iterator find(const LookupKeyType& key);
+
+		template<typename LookupKeyType>
+		const_iterator find(const LookupKeyType& key) const;
+
+		template<typename LookupKeyType>
+		bool contains(const LookupKeyType& key) const { return FindIndex(key) != mCapacity; }
+
+		template<typename LookupKeyType>
+		size_t count(const LookupKeyType& key) const { return contains(key) ? 1 : 0; }
+
+		template<typename LookupKeyType>
+		size_t erase(const LookupKeyType& key);
+
+		iterator erase(const_iterator position);
+		iterator erase(iterator position) { return erase(const_iterator(position)); }
+
+	protected:
+		static const KeyType& GetKey(const SlotType& slot)
+		{
+			if constexpr (std::is_same_v<SlotType, KeyType>)
+			{
+				return slot;
+			}
+			else
+			{
+				return slot.first;
+			}
+		}
+
+		template<typename LookupKeyType>
+		size_t FindIndex(const LookupKeyType& key) const { return mSize == 0 ? mCapacity : FindIndex(key, mHash(key)); }
+
+		template<typename LookupKeyType>
+		size_t FindIndex(const LookupKeyType& key, uint64 hash) const;
+
+		/**
+		 * @returns the slot of key and false, or a free slot for it and true. The caller constructs the slot.
+		 */
+		template<typename LookupKeyType>
+		std::pair<size_t, bool> FindOrPrepareInsert(const LookupKeyType& key);
+
+		void SetControl(size_t index, int8 control);
+		size_t NextFullSlot(size_t index) const;
+		size_t FindFreeSlot(uint64 hash) const;
+		void Rehash(size_t newCapacity);
+		void EraseAt(size_t index);
+
+	protected:
+		std::unique_ptr<int8[]> mControl;
+		SlotType* mSlots = nullptr;
+		size_t mCapacity = 0;
+		size_t mSize = 0;
+
+		// Inserts into empty slots left before the table has to grow.
+		size_t mGrowthLeft = 0;
+
+		HashType mHash;
+		EqualType mEqual;
+	};
+
+	template<typename KeyType, typename ValueType, typename HashType = TFlatHash<KeyType>, typename EqualType = std::equal_to<>>
+	class TFlatHashMap : public TFlatHashTable<KeyType, std::pair<const KeyType, ValueType>, HashType, EqualType>
+	{
+		using Super = TFlatHashTable<KeyType, std::pair<const KeyType, ValueType>, HashType, EqualType>;
+
+	public:
+		using mapped_type = ValueType;
+		using typename Super::iterator;
+		using typename Super::const_iterator;
+
+		/**
+		 * Insert a value constructed from args if key is not in the map yet.
+		 */
+		template<typename LookupKeyType, typename... ArgTypes>
+		std::pair<iterator, bool> try_emplace(LookupKeyType&& key, ArgTypes&&... args);
+
+		template<typename LookupKeyType, typename... ArgTypes>
+		std::pair<iterator, bool> emplace(LookupKeyType&& key, ArgTypes&&... args) { return try_emplace(std::forward<LookupKeyType>(key), std::forward<ArgTypes>(args)...); }
+
+		std::pair<iterator, bool> insert(const std::pair<const KeyType, ValueType>& value) { return try_emplace(value.first, value.second); }
+
+		template<typename LookupKeyType, typename MappedType>
+		std::pair<iterator, bool> insert_or_assign(LookupKeyType&& key, MappedType&& value);
+
+		template<typename LookupKeyType>
+		ValueType& operator[](LookupKeyType&& key) { return try_emplace(std::forward<LookupKeyType>(key)).first->second; }
+
+		template<typename LookupKeyType>
+		ValueType& at(const LookupKeyType& key);
+
+		template<typename LookupKeyType>
+		const ValueType& at(const LookupKeyType& key) const;
+	};
+
+	template<typename KeyType, typename HashType = TFlatHash<KeyType>, typename EqualType = std::equal_to<>>
+	class TFlatHashSet : public TFlatHashTable<KeyType, KeyType, HashType, EqualType>
+	{
+		using Super = TFlatHashTable<KeyType, KeyType, HashType, EqualType>;
+
+	public:
+		using typename Super::iterator;
+		using typename Super::const_iterator;
+
+		template<typename LookupKeyType>
+		std::pair<iterator, bool> insert(LookupKeyType&& key);
+
+		template<typename LookupKeyType>
+		std::pair<iterator, bool> emplace(LookupKeyType&& key) { return insert(std::forward<LookupKeyType>(key)); }
+	};
+
+	// Member Function
+
+	// --Implementation-- //
+
+	template<typename KeyType, typename SlotType, typename HashType, typename EqualType>
+	TFlatHashTable<KeyType, SlotType, HashType, EqualType>::TFlatHashTable(const TFlatHashTable& other)
+		: mHash(other.mHash)
+		, mEqual(other.mEqual)
+	{
+		reserve(other.mSize);
+		for (const SlotType& slot : other)
+		{
+			const std::pair<size_t, bool> result = FindOrPrepareInsert(GetKey(slot));
+			new (&mSlots[result.first]) SlotType(slot);
+		}
+	}
+
+	template<typename KeyType, typename SlotType, typename HashType, typename EqualType>
+	TFlatHashTable<KeyType, SlotType, HashType, EqualType>::TFlatHashTable(TFlatHashTable&& other) noexcept
+		: mControl(std::move(other.mControl))
+		, mSlots(std::exchange(other.mSlots, nullptr))
+		, mCapacity(std::exchange(other.mCapacity, 0))
+		, mSize(std::exchange(other.mSize, 0))
+		, mGrowthLeft(std::exchange(other.mGrowthLeft, 0))
+		, mHash(std::move(other.mHash))
+		, mEqual(std::move(other.mEqual))
+	{
+	}
+
+	template<typename KeyType, typename SlotType, typename HashType, typename EqualType>
+	TFlatHashTable<KeyType, SlotType, HashType, EqualType>& TFlatHashTable<KeyType, SlotType, HashType, EqualType>::operator=(const TFlatHashTable& other)
+	{
+		if (this != &other)
+		{
+			TFlatHashTable copy(other);
+			*this = std::move(copy);
+		}
+		return *this;
+	}
+
+	template<typename KeyType, typename SlotType, typename HashType, typename EqualType>
+	TFlatHashTable<KeyType, SlotType, HashType, EqualType>& TFlatHashTable<KeyType, SlotType, HashType, EqualType>::operator=(TFlatHashTable&& other) noexcept
+	{
+		if (this != &other)
+		{
+			clear();
+			std::allocator<SlotType>().deallocate(mSlots, mCapacity);
+
+			mControl = std::move(other.mControl);
+			mSlots = std::exchange(other.mSlots, nullptr);
+			mCapacity = std::exchange(other.mCapacity, 0);
+			mSize = std::exchange(other.mSize, 0);
+			mGrowthLeft = std::exchange(other.mGrowthLeft, 0);
+			mHash = std::move(other.mHash);
+			mEqual = std::move(other.mEqual);
+		}
+		return *this;
+	}
+
+	template<typename KeyType, typename SlotType, typename HashType, typename EqualType>
+	TFlatHashTable<KeyType, SlotType, HashType, EqualType>::~TFlatHashTable()
+	{
+		clear();
+		std::allocator<SlotType>().deallocate(mSlots, mCapacity);
+	}
+
+	template<typename KeyType, typename SlotType, typename HashType, typename EqualType>
+	void TFlatHashTable<KeyType, SlotType, HashType, EqualType>::clear()
+	{
+		if (mCapacity == 0)
+		{
+			return;
+		}
+
+		for (size_t index = NextFullSlot(0); index < mCapacity; index = NextFullSlot(index + 1))
+		{
+			mSlots[index].~SlotType();
+		}
+
+		std::memset(mControl.get(), FFlatHashGroup::Empty, mCapacity + FFlatHashGroup::Width);
+		mSize = 0;
+		mGrowthLeft = mCapacity - mCapacity / 8;
+	}
+
+	template<typename KeyType, typename SlotType, typename HashType, typename EqualType>
+	void TFlatHashTable<KeyType, SlotType, HashType, EqualType>::reserve(size_t count)
+	{
+		size_t newCapacity = FFlatHashGroup::Width;
+		while (newCapacity - newCapacity / 8 < count)
+		{
+			newCapacity *= 2;
+		}
+
+		if (newCapacity > mCapacity)
+		{
+			Rehash(newCapacity);
+		}
+	}
+
+	template<typename KeyType, typename SlotType, typename HashType, typename EqualType>
+	template<typename LookupKeyType>
+	typename TFlatHashTable<KeyType, SlotType, HashType, EqualType>::iterator TFlatHashTable<KeyType, SlotType, HashType, EqualType>::find(const LookupKeyType& key)
+	{
+		return iterator(this, FindIndex(key));
+	}
+
+	template<typename KeyType, typename SlotType, typename HashType, typename EqualType>
+	template<typename LookupKeyType>
+	typename TFlatHashTable<KeyType, SlotType, HashType, EqualType>::const_iterator TFlatHashTable<KeyType, SlotType, HashType, EqualType>::find(const LookupKeyType& key) const
+	{
+		return const_iterator(this, FindIndex(key));
+	}
+
+	template<typename KeyType, typename SlotType, typename HashType, typename EqualType>
+	template<typename LookupKeyType>
+	size_t TFlatHashTable<KeyType, SlotType, HashType, EqualType>::erase(const LookupKeyType& key)
+	{
+		const size_t index = FindIndex(key);
+		if (index == mCapacity)
+		{
+			return 0;
+		}
+
+		EraseAt(index);
+		return 1;
+	}
+
+	template<typename KeyType, typename SlotType, typename HashType, typename EqualType>
+	typename TFlatHashTable<KeyType, SlotType, HashType, EqualType>::iterator TFlatHashTable<KeyType, SlotType, HashType, EqualType>::erase(const_iterator position)
+	{
+		EraseAt(position.mIndex);
+		return iterator(this, NextFullSlot(position.mIndex + 1));
+	}
+
+	template<typename KeyType, typename SlotType, typename HashType, typename EqualType>
+	template<typename LookupKeyType>
+	size_t TFlatHashTable<KeyType, SlotType, HashType, EqualType>::FindIndex(const LookupKeyType& key, uint64 hash) const
+	{
+		const int8 hash7 = static_cast<int8>(hash & 0x7F);
+		const size_t mask = mCapacity - 1;
+
+		size_t offset = static_cast<size_t>(hash >> 7) & mask;
+		for (size_t step = FFlatHashGroup::Width; ; step += FFlatHashGroup::Width)
+		{
+			const FFlatHashGroup group(mControl.get() + offset);
+			for (uint32 match = group.Match(hash7); match != 0; match &= match - 1)
+			{
+				const size_t index = (offset + FlatHashLowestBit(match)) & mask;
+				if (mEqual(GetKey(mSlots[index]), key))
+				{
+					return index;
+				}
+			}
+
+			if (group.MatchEmpty() != 0)
+			{
+				return mCapacity;
+			}
+
+			offset = (offset + step) & mask;
+		}
+	}
+
+	template<typename KeyType, typename SlotType, typename HashType, typename EqualType>
+	template<typename LookupKeyType>
+	std::pair<size_t, bool> TFlatHashTable<KeyType, SlotType, HashType, EqualType>::FindOrPrepareInsert(const LookupKeyType& key)
+	{
+		const uint64 hash = mHash(key);
+		if (mSize != 0)
+		{
+			const size_t existingIndex = FindIndex(key, hash);
+			if (existingIndex != mCapacity)
+			{
+				return { existingIndex, false };
+			}
+		}
+
+		size_t index = mCapacity == 0 ? 0 : FindFreeSlot(hash);
+
+		// Reusing a tombstone does not use up growth, filling an empty slot does.
+		if (mCapacity == 0 || (mGrowthLeft == 0 && mControl[index] == FFlatHashGroup::Empty))
+		{
+			// Mostly tombstones, rehashing in place is enough.
+			Rehash(mCapacity == 0 ? FFlatHashGroup::Width : (mSize * 2 < mCapacity - mCapacity / 8 ? mCapacity : mCapacity * 2));
+			index = FindFreeSlot(hash);
+		}
+
+		if (mControl[index] == FFlatHashGroup::Empty)
+		{
+			--mGrowthLeft;
+		}
+
+		SetControl(index, static_cast<int8>(hash & 0x7F));
+		++mSize;
+		return { index, true };
+	}
+
+	template<typename KeyType, typename SlotType, typename HashType, typename EqualType>
+	void TFlatHashTable<KeyType, SlotType, HashType, EqualType>::SetControl(size_t index, int8 control)
+	{
+		mControl[index] = control;
+
+		// The first group is mirrored after the end, so a group load near the end wraps around.
+		if (index < FFlatHashGroup::Width)
+		{
+			mControl[mCapacity + index] = control;
+		}
+	}
+
+	template<typename KeyType, typename SlotType, typename HashType, typename EqualType>
+	size_t TFlatHashTable<KeyType, SlotType, HashType, EqualType>::NextFullSlot(size_t index) const
+	{
+		while (index < mCapacity && mControl[index] < 0)
+		{
+			++index;
+		}
+		return index;
+	}
+
+	template<typename KeyType, typename SlotType, typename HashType, typename EqualType>
+	size_t TFlatHashTable<KeyType, SlotType, HashType, EqualType>::FindFreeSlot(uint64 hash) const
+	{
+		const size_t mask = mCapacity - 1;
+
+		size_t offset = static_cast<size_t>(hash >> 7) & mask;
+		for (size_t step = FFlatHashGroup::Width; ; step += FFlatHashGroup::Width)
+		{
+			const uint32 match = FFlatHashGroup(mControl.get() + offset).MatchEmptyOrDeleted();
+			if (match != 0)
+			{
+				return (offset + FlatHashLowestBit(match)) & mask;
+			}
+
+			offset = (offset + step) & mask;
+		}
+	}
+
+	template<typename KeyType, typename SlotType, typename HashType, typename EqualType>
+	void TFlatHashTable<KeyType, SlotType, HashType, EqualType>::Rehash(size_t newCapacity)
+	{
+		ASSERT(newCapacity >= FFlatHashGroup::Width && (newCapacity & (newCapacity - 1)) == 0);
+
+		std::unique_ptr<int8[]> oldControl = std::move(mControl);
+		SlotType* oldSlots = mSlots;
+		const size_t oldCapacity = mCapacity;
+
+		mControl.reset(new int8[newCapacity + FFlatHashGroup::Width]);
+		std::memset(mControl.get(), FFlatHashGroup::Empty, newCapacity + FFlatHashGroup::Width);
+		mSlots = std::allocator<SlotType>().allocate(newCapacity);
+		mCapacity = newCapacity;
+		mGrowthLeft = newCapacity - newCapacity / 8 - mSize;
+
+		for (size_t index = 0; index < oldCapacity; ++index)
+		{
+			if (oldControl[index] >= 0)
+			{
+				const uint64 hash = mHash(GetKey(oldSlots[index]));
+				const size_t newIndex = FindFreeSlot(hash);
+				SetControl(newIndex, static_cast<int8>(hash & 0x7F));
+
+				new (&mSlots[newIndex]) SlotType(std::move(oldSlots[index]));
+				oldSlots[index].~SlotType();
+			}
+		}
+
+		std::allocator<SlotType>().deallocate(oldSlots, oldCapacity);
+	}
+
+	template<typename KeyType, typename SlotType, typename HashType, typename EqualType>
+	void TFlatHashTable<KeyType, SlotType, HashType, EqualType>::EraseAt(size_t index)
+	{
+		mSlots[index].~SlotType();
+		SetControl(index, FFlatHashGroup::Deleted);
+		--mSize;
+	}
+
+	template<typename KeyType, typename ValueType, typename HashType, typename EqualType>
+	template<typename LookupKeyType, typename... ArgTypes>
+	std::pair<typename TFlatHashMap<KeyType, ValueType, HashType, EqualType>::iterator, bool> TFlatHashMap<KeyType, ValueType, HashType, EqualType>::try_emplace(LookupKeyType&& key, ArgTypes&&... args)
+	{
+		const std::pair<size_t, bool> result = this->FindOrPrepareInsert(key);
+		if (result.second)
+		{
+			new (&this->mSlots[result.first]) std::pair<const KeyType, ValueType>(std::piecewise_construct,
+				std::forward_as_tuple(std::forward<LookupKeyType>(key)), std::forward_as_tuple(std::forward<ArgTypes>(args)...));
+		}
+		return { iterator(this, result.first), result.second };
+	}
+
+	template<typename KeyType, typename ValueType, typename HashType, typename EqualType>
+	template<typename LookupKeyType, typename MappedType>
+	std::pair<typename TFlatHashMap<KeyType, ValueType, HashType, EqualType>::iterator, bool> TFlatHashMap<KeyType, ValueType, HashType, EqualType>::insert_or_assign(LookupKeyType&& key, MappedType&& value)
+	{
+		std::pair<iterator, bool> result = try_emplace(std::forward<LookupKeyType>(key), std::forward<MappedType>(value));
+		if (!result.second)
+		{
+			result.first->second = std::forward<MappedType>(value);
+		}
+		return result;
+	}
+
+	template<typename KeyType, typename ValueType, typename HashType, typename EqualType>
+	template<typename LookupKeyType>
+	ValueType& TFlatHashMap<KeyType, ValueType, HashType, EqualType>::at(const LookupKeyType& key)
+	{
+		const size_t index = this->FindIndex(key);
+		ASSERT_MSG(index != this->mCapacity, "Key is not in the map");
+		return this->mSlots[index].second;
+	}
+
+	template<typename KeyType, typename ValueType, typename HashType, typename EqualType>
+	template<typename LookupKeyType>
+	const ValueType& TFlatHashMap<KeyType, ValueType, HashType, EqualType>::at(const LookupKeyType& key) const
+	{
+		const size_t index = this->FindIndex(key);
+		ASSERT_MSG(index != this->mCapacity, "Key is not in the map");
+		return this->mSlots[index].second;
+	}
+
+	template<typename KeyType, typename HashType, typename EqualType>
+	template<typename LookupKeyType>
+	std::pair<typename TFlatHashSet<KeyType, HashType, EqualType>::iterator, bool> TFlatHashSet<KeyType, HashType, EqualType>::insert(LookupKeyType&& key)
+	{
+		const std::pair<size_t, bool> result = this->FindOrPrepareInsert(key);
+		if (result.second)
+		{
+			new (&this->mSlots[result.first]) KeyType(std::forward<LookupKeyType>(key));
+		}
+		return { iterator(this, result.first), result.second };
+	}
+}
@@ -0,0 +1,187 @@
+#include "PCH.h"
+#include "FrameArena.h"
+#include "JobSystem.h"
+
+namespace Dash
+{
+	// Size of a new block, larger allocations get a block of their own size.
+	static constexpr size_t GFrameArenaBlockSize = 256 * 1024;
+
+	// Hands the thread's arena back when the thread exits.
+	struct FFrameArenaThreadHandle
+	{
+		FFrameArena::FThreadArena* Arena = nullptr;
+
+		~FFrameArenaThreadHandle()
+		{
+			if (Arena != nullptr)
+			{
+				FFrameArena::Get().ReleaseThreadArena(Arena);
+			}
+		}
+	};
+
+	static thread_local FFrameArenaThreadHandle GFrameArenaThread;
+
+	static uintptr_t AlignAddress(uintptr_t address, size_t alignment)
+	{
+		return (address + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+	}
+
+	FFrameArena& FFrameArena::Get()
+	{
+		static FFrameArena instance;
+		return instance;
+	}
+
+	void FFrameArena::BeginFrame()
+	{
+		const uint64 frameIndex = mFrameIndex.load(std::memory_order_relaxed);
+
+		std::lock_guard<std::mutex> lock(mArenasLock);
+
+		size_t frameBytes = 0;
+		for (const std::unique_ptr<FThreadArena>& arena : mArenas)
+		{
+			if (arena->FrameIndex.load(std::memory_order_relaxed) == frameIndex)
+			{
+				const size_t usedBytes = arena->UsedBytes.load(std::memory_order_relaxed);
+				frameBytes += usedBytes;
+				mPeakThreadBytes = std::max(mPeakThreadBytes, usedBytes);
+			}
+		}
+
+		mLastFrameBytes = frameBytes;
+		mPeakFrameBytes = std::max(mPeakFrameBytes, frameBytes);
+
+		mFrameIndex.store(frameIndex + 1, std::memory_order_relaxed);
+	}
+
+	void* FFrameArena::Allocate(size_t size, size_t alignment)
+	{
+		ASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+		FThreadArena& arena = GetThreadArena();
+
+		// Allocations of a job are in use until it returns, a different outermost job on the thread means it did.
+		// Once the thread allocated outside of any job, only the next allocation outside of a job may rewind.
+		const uint64 jobId = FJobSystem::GetOutermostJobId();
+		const bool ownerDone = jobId == 0 || (arena.OwnerJobId != 0 && arena.OwnerJobId != jobId);
+
+		const uint64 frameIndex = mFrameIndex.load(std::memory_order_relaxed);
+		if (ownerDone && arena.FrameIndex.load(std::memory_order_relaxed) != frameIndex)
+		{
+			Rewind(arena, frameIndex);
+		}
+
+		if (arena.OwnerJobId != 0)
+		{
+			arena.OwnerJobId = jobId;
+		}
+
+		if (!arena.Blocks.empty())
+		{
+			const FBlock& block = arena.Blocks[arena.BlockIndex];
+			const uintptr_t base = reinterpret_cast<uintptr_t>(block.Memory.get());
+			const size_t offset = AlignAddress(base + arena.BlockOffset, alignment) - base;
+
+			if (offset + size <= block.Size)
+			{
+				arena.BlockOffset = offset + size;
+				arena.UsedBytes.store(arena.UsedBytes.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+				return block.Memory.get() + offset;
+			}
+		}
+
+		return AllocateFromNewBlock(arena, size, alignment);
+	}
+
+	FFrameArenaStats FFrameArena::GetStats() const
+	{
+		std::lock_guard<std::mutex> lock(mArenasLock);
+
+		FFrameArenaStats stats;
+		stats.LastFrameBytes = mLastFrameBytes;
+		stats.PeakFrameBytes = mPeakFrameBytes;
+		stats.PeakThreadBytes = mPeakThreadBytes;
+		stats.NumThreadArenas = static_cast<uint32>(mArenas.size());
+
+		for (const std::unique_ptr<FThreadArena>& arena : mArenas)
+		{
+			stats.ReservedBytes += arena->ReservedBytes.load(std::memory_order_relaxed);
+		}
+
+		return stats;
+	}
+
+	FFrameArena::FThreadArena& FFrameArena::GetThreadArena()
+	{
+		if (GFrameArenaThread.Arena != nullptr)
+		{
+			return *GFrameArenaThread.Arena;
+		}
+
+		std::lock_guard<std::mutex> lock(mArenasLock);
+
+		for (const std::unique_ptr<FThreadArena>& arena : mArenas)
+		{
+			if (arena->bFree)
+			{
+				arena->bFree = false;
+				arena->OwnerJobId = NoOwnerJobId;
+				GFrameArenaThread.Arena = arena.get();
+				return *arena;
+			}
+		}
+
+		mArenas.push_back(std::make_unique<FThreadArena>());
+		GFrameArenaThread.Arena = mArenas.back().get();
+		return *mArenas.back();
+	}
+
+	void FFrameArena::ReleaseThreadArena(FThreadArena* arena)
+	{
+		std::lock_guard<std::mutex> lock(mArenasLock);
+		arena->bFree = true;
+	}
+
+	void FFrameArena::Rewind(FThreadArena& arena, uint64 frameIndex)
+	{
+		// The last frame did not fit in one block, replace the blocks with one that holds all of them.
+		if (arena.Blocks.size() > 1)
+		{
+			size_t totalSize = 0;
+			for (const FBlock& block : arena.Blocks)
+			{
+				totalSize += block.Size;
+			}
+
+			arena.Blocks.clear();
+			arena.Blocks.push_back(FBlock{ std::unique_ptr<uint8[]>(new uint8[totalSize]), totalSize });
+			arena.ReservedBytes.store(totalSize, std::memory_order_relaxed);
+		}
+
+		arena.BlockIndex = 0;
+		arena.BlockOffset = 0;
+		arena.UsedBytes.store(0, std::memory_order_relaxed);
+		arena.FrameIndex.store(frameIndex, std::memory_order_relaxed);
+		arena.OwnerJobId = NoOwnerJobId;
+	}
+
+	void* FFrameArena::AllocateFromNewBlock(FThreadArena& arena, size_t size, size_t alignment)
+	{
+		const size_t blockSize = std::max(GFrameArenaBlockSize, size + alignment);
+
+		arena.Blocks.push_back(FBlock{ std::unique_ptr<uint8[]>(new uint8[blockSize]), blockSize });
+		arena.BlockIndex = arena.Blocks.size() - 1;
+		arena.ReservedBytes.store(arena.ReservedBytes.load(std::memory_order_relaxed) + blockSize, std::memory_order_relaxed);
+
+		const FBlock& block = arena.Blocks.back();
+		const uintptr_t base = reinterpret_cast<uintptr_t>(block.Memory.get());
+		const size_t offset = AlignAddress(base, alignment) - base;
+
+		arena.BlockOffset = offset + size;
+		arena.UsedBytes.store(arena.UsedBytes.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+		return block.Memory.get() + offset;
+	}
+}
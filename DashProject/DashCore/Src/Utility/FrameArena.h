@@ -0,0 +1,139 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Dash
+{
+	struct FFrameArenaStats
+	{
+		// Bytes handed out during the last finished frame, summed over all threads.
+		size_t LastFrameBytes = 0;
+
+		// Largest LastFrameBytes seen so far.
+		size_t PeakFrameBytes = 0;
+
+		// Largest amount a single thread used in one frame.
+		size_t PeakThreadBytes = 0;
+
+		// Memory held by all thread arenas.
+		size_t ReservedBytes = 0;
+
+		uint32 NumThreadArenas = 0;
+	};
+
+	// Linear allocator for memory that only lives for the current frame.
+	//
+	// Every thread bumps a pointer in its own arena, so allocating takes no lock, and there is nothing to free:
+	// BeginFrame starts a new frame and each thread rewinds its arena on its first allocation in that frame, as long
+	// as nothing allocated since the last rewind can still be in use. Memory a job allocated is in use until that job
+	// returns, also when it waits and FJobSystem::Wait runs jobs of later frames on the same thread, which then keep
+	// bumping the same arena. Memory allocated outside of any job is in use until the thread allocates outside of a
+	// job again in a later frame. A job may therefore keep its allocations across a frame boundary.
+	//
+	// An arena that overflowed its block during a frame is merged into one block large enough for the whole
+	// frame when it rewinds, so a steady workload allocates from a single block.
+	class FFrameArena
+	{
+	public:
+		static FFrameArena& Get();
+
+		/**
+		 * Start a new frame and collect the statistics of the previous one. Called once per frame by the main loop.
+		 */
+		void BeginFrame();
+
+		/**
+		 * @param alignment must be a power of two.
+		 * @returns memory that is valid until the frame ends, and for as long as the job that allocated it runs.
+		 */
+		void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+		/**
+		 * Uninitialized storage for count objects of type T.
+		 */
+		template<typename T>
+		T* AllocateArray(size_t count) { return static_cast<T*>(Allocate(count * sizeof(T), alignof(T))); }
+
+		uint64 GetFrameIndex() const { return mFrameIndex.load(std::memory_order_relaxed); }
+
+		FFrameArenaStats GetStats() const;
+
+	private:
+		FFrameArena() = default;
+
+		// OwnerJobId of an arena without allocations in use.
+		static constexpr uint64 NoOwnerJobId = UINT64_MAX;
+
+		struct FBlock
+		{
+			std::unique_ptr<uint8[]> Memory;
+			size_t Size = 0;
+		};
+
+		struct FThreadArena
+		{
+			std::vector<FBlock> Blocks;
+			size_t BlockIndex = 0;
+			size_t BlockOffset = 0;
+
+			// Written by the owning thread, read by BeginFrame and GetStats.
+			// FrameIndex is the frame of the last rewind, an arena that is behind rewinds on its next allocation
+			// that is allowed to.
+			std::atomic<uint64> FrameIndex{ 0 };
+			std::atomic<size_t> UsedBytes{ 0 };
+			std::atomic<size_t> ReservedBytes{ 0 };
+
+			// FJobSystem::GetOutermostJobId of the allocations since the last rewind, 0 once one was made outside
+			// of any job. Only the owning thread touches it.
+			uint64 OwnerJobId = NoOwnerJobId;
+
+			// The owning thread exited, the next new thread takes the arena over.
+			bool bFree = false;
+		};
+
+		FThreadArena& GetThreadArena();
+		void ReleaseThreadArena(FThreadArena* arena);
+
+		void Rewind(FThreadArena& arena, uint64 frameIndex);
+		void* AllocateFromNewBlock(FThreadArena& arena, size_t size, size_t alignment);
+
+		friend struct FFrameArenaThreadHandle;
+
+	private:
+		std::atomic<uint64> mFrameIndex{ 1 };
+
+		mutable std::mutex mArenasLock;
+		std::vector<std::unique_ptr<FThreadArena>> mArenas;
+
+		size_t mLastFrameBytes = 0;
+		size_t mPeakFrameBytes = 0;
+		size_t mPeakThreadBytes = 0;
+	};
+
+	// STL allocator on top of FFrameArena, deallocate does nothing.
+	// Growing a container leaves the old storage behind until the frame ends, so reserve up front.
+	template<typename T>
+	class TFrameAllocator
+	{
+	public:
+		using value_type = T;
+
+		TFrameAllocator() noexcept = default;
+
+		template<typename U>
+		TFrameAllocator(const TFrameAllocator<U>&) noexcept {}
+
+		T* allocate(size_t count) { return FFrameArena::Get().AllocateArray<T>(count); }
+		void deallocate(T*, size_t) noexcept {}
+
+		template<typename U>
+		bool operator==(const TFrameAllocator<U>&) const noexcept { return true; }
+	};
+
+	template<typename T>
+	using TFrameVector = std::vector<T, TFrameAllocator<T>>;
+}
@@ -0,0 +1,228 @@
+#include "PCH.h"
+#include "FrameTimeStats.h"
+
+namespace Dash
+{
+	// Frames in the window, about 17 seconds at 60 Hz.
+	static constexpr uint32 GFrameTimeWindowSize = 1024;
+
+	// Upper bound of the first histogram bucket and the number of buckets per doubling.
+	static constexpr double GFrameTimeHistogramBaseMs = 0.25;
+	static constexpr double GFrameTimeHistogramBucketsPerOctave = 4.0;
+
+	void FFrameTimeHistogram::Add(double milliseconds)
+	{
+		uint32 bucket = 0;
+		if (milliseconds > GFrameTimeHistogramBaseMs)
+		{
+			const double index = std::ceil(GFrameTimeHistogramBucketsPerOctave * std::log2(milliseconds / GFrameTimeHistogramBaseMs));
+			bucket = static_cast<uint32>(std::min(index, static_cast<double>(NumBuckets - 1)));
+		}
+
+		++mBuckets[bucket];
+		++mNumSamples;
+	}
+
+	void FFrameTimeHistogram::Reset()
+	{
+		mBuckets.fill(0);
+		mNumSamples = 0;
+	}
+
+	double FFrameTimeHistogram::GetBucketUpperBoundMs(uint32 bucket)
+	{
+		return GFrameTimeHistogramBaseMs * std::exp2(bucket / GFrameTimeHistogramBucketsPerOctave);
+	}
+
+	double FFrameTimeHistogram::GetPercentileMs(double percentile) const
+	{
+		if (mNumSamples == 0)
+		{
+			return 0.0;
+		}
+
+		// Nearest rank, at least the first sample.
+		const uint64 rank = std::max<uint64>(1, static_cast<uint64>(std::ceil(percentile / 100.0 * mNumSamples)));
+
+		uint64 count = 0;
+		for (uint32 bucket = 0; bucket < NumBuckets; ++bucket)
+		{
+			count += mBuckets[bucket];
+			if (count >= rank)
+			{
+				return GetBucketUpperBoundMs(bucket);
+			}
+		}
+
+		return GetBucketUpperBoundMs(NumBuckets - 1);
+	}
+
+	FFrameTimeStats& FFrameTimeStats::Get()
+	{
+		static FFrameTimeStats instance;
+		return instance;
+	}
+
+	void FFrameTimeStats::AddFrame(uint64 frameIndex, double frameMs, double updateMs, double renderMs)
+	{
+		bool hitch = false;
+		double hitchThresholdMs = 0.0;
+
+		bool logSummary = false;
+		uint32 numFrames = 0;
+		uint64 numHitches = 0;
+		FFrameTimeSummary summaries[static_cast<size_t>(EFrameTimeCategory::Num)];
+
+		{
+			std::lock_guard<std::mutex> lock(mLock);
+
+			const FFrameTimes times{ { static_cast<float>(frameMs), static_cast<float>(updateMs), static_cast<float>(renderMs) } };
+
+			if (mWindow.size() < GFrameTimeWindowSize)
+			{
+				mWindow.push_back(times);
+			}
+			else
+			{
+				mWindow[mWindowHead] = times;
+			}
+			mWindowHead = (mWindowHead + 1) % GFrameTimeWindowSize;
+
+			for (size_t category = 0; category < static_cast<size_t>(EFrameTimeCategory::Num); ++category)
+			{
+				mHistograms[category].Add(times.Ms[category]);
+			}
+
+			if (mHitchThresholdMs > 0.0 && frameMs > mHitchThresholdMs)
+			{
+				hitch = true;
+				hitchThresholdMs = mHitchThresholdMs;
+				++mNumHitches;
+			}
+
+			mSecondsSinceLog += frameMs / 1000.0;
+			if (mLogIntervalSeconds > 0.0 && mSecondsSinceLog >= mLogIntervalSeconds)
+			{
+				logSummary = true;
+				numFrames = static_cast<uint32>(mWindow.size());
+				numHitches = mNumHitches - mNumHitchesAtLastLog;
+
+				for (size_t category = 0; category < static_cast<size_t>(EFrameTimeCategory::Num); ++category)
+				{
+					summaries[category] = Summarize(static_cast<EFrameTimeCategory>(category));
+				}
+
+				mSecondsSinceLog = 0.0;
+				mNumHitchesAtLastLog = mNumHitches;
+			}
+		}
+
+		// Logged outside the lock, a sink may ask for the stats.
+		if (hitch)
+		{
+			DASH_LOG(LogTemp, Warning, "Hitch in frame {} : {:.2f} ms (update {:.2f} ms, render {:.2f} ms), threshold {:.2f} ms",
+				frameIndex, frameMs, updateMs, renderMs, hitchThresholdMs);
+		}
+
+		if (logSummary)
+		{
+			const FFrameTimeSummary& frame = summaries[static_cast<size_t>(EFrameTimeCategory::Frame)];
+			const FFrameTimeSummary& update = summaries[static_cast<size_t>(EFrameTimeCategory::Update)];
+			const FFrameTimeSummary& render = summaries[static_cast<size_t>(EFrameTimeCategory::Render)];
+
+			DASH_LOG(LogTemp, Info, "Frame time over the last {} frames : avg {:.2f} ms, p50 {:.2f} ms, p90 {:.2f} ms, p99 {:.2f} ms, p99.9 {:.2f} ms, max {:.2f} ms, {} hitches",
+				numFrames, frame.AverageMs, frame.P50Ms, frame.P90Ms, frame.P99Ms, frame.P999Ms, frame.MaxMs, numHitches);
+			DASH_LOG(LogTemp, Info, "Update p50 {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms. Render p50 {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms",
+				update.P50Ms, update.P99Ms, update.MaxMs, render.P50Ms, render.P99Ms, render.MaxMs);
+		}
+	}
+
+	FFrameTimeSummary FFrameTimeStats::GetSummary(EFrameTimeCategory category) const
+	{
+		std::lock_guard<std::mutex> lock(mLock);
+		return Summarize(category);
+	}
+
+	FFrameTimeHistogram FFrameTimeStats::GetHistogram(EFrameTimeCategory category) const
+	{
+		std::lock_guard<std::mutex> lock(mLock);
+		return mHistograms[static_cast<size_t>(category)];
+	}
+
+	void FFrameTimeStats::ResetHistograms()
+	{
+		std::lock_guard<std::mutex> lock(mLock);
+		for (FFrameTimeHistogram& histogram : mHistograms)
+		{
+			histogram.Reset();
+		}
+	}
+
+	void FFrameTimeStats::SetHitchThreshold(double thresholdMs)
+	{
+		std::lock_guard<std::mutex> lock(mLock);
+		mHitchThresholdMs = thresholdMs;
+	}
+
+	double FFrameTimeStats::GetHitchThreshold() const
+	{
+		std::lock_guard<std::mutex> lock(mLock);
+		return mHitchThresholdMs;
+	}
+
+	uint64 FFrameTimeStats::GetNumHitches() const
+	{
+		std::lock_guard<std::mutex> lock(mLock);
+		return mNumHitches;
+	}
+
+	void FFrameTimeStats::SetLogInterval(double seconds)
+	{
+		std::lock_guard<std::mutex> lock(mLock);
+		mLogIntervalSeconds = seconds;
+		mSecondsSinceLog = 0.0;
+	}
+
+	uint32 FFrameTimeStats::GetWindowSize() const
+	{
+		return GFrameTimeWindowSize;
+	}
+
+	FFrameTimeSummary FFrameTimeStats::Summarize(EFrameTimeCategory category) const
+	{
+		FFrameTimeSummary summary;
+		summary.NumSamples = static_cast<uint32>(mWindow.size());
+
+		if (mWindow.empty())
+		{
+			return summary;
+		}
+
+		float samples[GFrameTimeWindowSize];
+		double sum = 0.0;
+		for (uint32 i = 0; i < summary.NumSamples; ++i)
+		{
+			samples[i] = mWindow[i].Ms[static_cast<size_t>(category)];
+			sum += samples[i];
+		}
+
+		std::sort(samples, samples + summary.NumSamples);
+
+		// Nearest rank.
+		auto percentile = [&samples, count = summary.NumSamples](double p)
+		{
+			const uint32 rank = std::max<uint32>(1, static_cast<uint32>(std::ceil(p / 100.0 * count)));
+			return static_cast<double>(samples[rank - 1]);
+		};
+
+		summary.AverageMs = sum / summary.NumSamples;
+		summary.MinMs = samples[0];
+		summary.MaxMs = samples[summary.NumSamples - 1];
+		summary.P50Ms = percentile(50.0);
+		summary.P90Ms = percentile(90.0);
+		summary.P99Ms = percentile(99.0);
+		summary.P999Ms = percentile(99.9);
+
+		return summary;
+	}
+}
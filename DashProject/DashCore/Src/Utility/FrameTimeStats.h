@@ -0,0 +1,135 @@
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <vector>
+
+namespace Dash
+{
+	enum class EFrameTimeCategory : uint8
+	{
+		// One pass through the main loop, from the start of the frame to the end of Present.
+		Frame,
+
+		// IGameApp::OnUpdate.
+		Update,
+
+		// IGameApp::OnRender.
+		Render,
+
+		Num
+	};
+
+	struct FFrameTimeSummary
+	{
+		uint32 NumSamples = 0;
+
+		// Milliseconds.
+		double AverageMs = 0.0;
+		double MinMs = 0.0;
+		double MaxMs = 0.0;
+		double P50Ms = 0.0;
+		double P90Ms = 0.0;
+		double P99Ms = 0.0;
+		double P999Ms = 0.0;
+	};
+
+	// Frame time histogram with logarithmic buckets: four per doubling from GetBucketUpperBoundMs(0) on, the last
+	// bucket takes everything longer. Percentiles read from it are accurate to one bucket, within 19%, over any
+	// number of frames.
+	class FFrameTimeHistogram
+	{
+	public:
+		static constexpr uint32 NumBuckets = 64;
+
+		void Add(double milliseconds);
+		void Reset();
+
+		uint64 GetNumSamples() const { return mNumSamples; }
+		uint64 GetBucketCount(uint32 bucket) const { return mBuckets[bucket]; }
+
+		/**
+		 * Bucket i holds times in (GetBucketUpperBoundMs(i - 1), GetBucketUpperBoundMs(i)].
+		 */
+		static double GetBucketUpperBoundMs(uint32 bucket);
+
+		/**
+		 * @param percentile in [0, 100].
+		 * @returns the upper bound of the bucket holding that percentile, 0 if the histogram is empty.
+		 */
+		double GetPercentileMs(double percentile) const;
+
+	private:
+		std::array<uint64, NumBuckets> mBuckets{};
+		uint64 mNumSamples = 0;
+	};
+
+	// CPU frame time statistics for tracking tail latency, not only averages.
+	//
+	// The main loop adds the frame, update and render times of every frame, all measured within that frame, and leaves
+	// out the frames right after the window was minimized or paused. The last GetWindowSize frames are kept for exact
+	// percentiles over the recent past, and a histogram per category covers the whole run. A frame longer than the
+	// hitch threshold is logged as a warning when it is added, and every log interval a summary of the window is logged.
+	class FFrameTimeStats
+	{
+	public:
+		static FFrameTimeStats& Get();
+
+		/**
+		 * Called once per frame by the main loop, times in milliseconds.
+		 */
+		void AddFrame(uint64 frameIndex, double frameMs, double updateMs, double renderMs);
+
+		/**
+		 * Over the frames in the window.
+		 */
+		FFrameTimeSummary GetSummary(EFrameTimeCategory category) const;
+
+		/**
+		 * Since the start or the last ResetHistograms.
+		 */
+		FFrameTimeHistogram GetHistogram(EFrameTimeCategory category) const;
+		void ResetHistograms();
+
+		/**
+		 * Frames longer than thresholdMs count as hitches, 0 turns hitch detection off.
+		 */
+		void SetHitchThreshold(double thresholdMs);
+		double GetHitchThreshold() const;
+
+		uint64 GetNumHitches() const;
+
+		/**
+		 * Seconds of frame time between two logged summaries, 0 turns the summary off.
+		 */
+		void SetLogInterval(double seconds);
+
+		uint32 GetWindowSize() const;
+
+	private:
+		FFrameTimeStats() = default;
+
+		struct FFrameTimes
+		{
+			float Ms[static_cast<size_t>(EFrameTimeCategory::Num)];
+		};
+
+		FFrameTimeSummary Summarize(EFrameTimeCategory category) const;
+
+	private:
+		mutable std::mutex mLock;
+
+		// Ring of the last frames, mWindowHead is where the next one goes.
+		std::vector<FFrameTimes> mWindow;
+		uint32 mWindowHead = 0;
+
+		FFrameTimeHistogram mHistograms[static_cast<size_t>(EFrameTimeCategory::Num)];
+
+		double mHitchThresholdMs = 50.0;
+		uint64 mNumHitches = 0;
+		uint64 mNumHitchesAtLastLog = 0;
+
+		double mLogIntervalSeconds = 30.0;
+		double mSecondsSinceLog = 0.0;
+	};
+}
@@ -1,8 +1,179 @@
 #include "PCH.h"
 #include "Hash.h"
 
+#include <bit>
+
 namespace Dash
 {
+    // wyhash ʹõĳ, ֮人ϴ
+    static constexpr uint64 HashSecret[4] = {
+        0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL
+    };
+
+    static constexpr size_t HashStripeSize = 48;
+
+    static FORCEINLINE uint64 Read64(const uint8* Ptr) {
+        uint64 Value;
+        std::memcpy(&Value, Ptr, sizeof(Value));
+        return Value;
+    }
+
+    static FORCEINLINE uint64 Read32(const uint8* Ptr) {
+        uint32 Value;
+        std::memcpy(&Value, Ptr, sizeof(Value));
+        return Value;
+    }
+
+    // A, B 滻Ϊ 128 λ˻ĵ 64 λ͸ 64 λ
+    static FORCEINLINE void Multiply128(uint64& A, uint64& B) {
+#if defined(_MSC_VER)
+        A = _umul128(A, B, &B);
+#else
+        const unsigned __int128 Product = static_cast<unsigned __int128>(A) * B;
+        A = static_cast<uint64>(Product);
+        B = static_cast<uint64>(Product >> 64);
+#endif
+    }
+
+    static FORCEINLINE uint64 InitSeed(uint64 Seed) {
+        return Seed ^ HashMix(Seed ^ HashSecret[0], HashSecret[1]);
+    }
+
+    // ·, ˷Բִ
+    static FORCEINLINE void ConsumeStripe(uint64& Seed, uint64& See1, uint64& See2, const uint8* Ptr) {
+        Seed = HashMix(Read64(Ptr) ^ HashSecret[1], Read64(Ptr + 8) ^ Seed);
+        See1 = HashMix(Read64(Ptr + 16) ^ HashSecret[2], Read64(Ptr + 24) ^ See1);
+        See2 = HashMix(Read64(Ptr + 32) ^ HashSecret[3], Read64(Ptr + 40) ^ See2);
+    }
+
+    // 󲻳 48 ֽڵ (ֻܳΪ 0 ʱΪ), Key0 / Key1  128 λ
+    static FORCEINLINE uint64 FinalizeTail(uint64 Seed, const uint8* Ptr, size_t Size, uint64 Length, uint64 Key0, uint64 Key1) {
+        while (Size > 16) {
+            Seed = HashMix(Read64(Ptr) ^ Key1, Read64(Ptr + 8) ^ Seed);
+            Ptr += 16;
+            Size -= 16;
+        }
+
+        uint64 A = 0;
+        uint64 B = 0;
+        if (Size >= 4) {
+            // 4..16 ֽ: ص 4 ֽڶȡֽ
+            const size_t Offset = (Size >> 3) << 2;
+            A = (Read32(Ptr) << 32) | Read32(Ptr + Offset);
+            B = (Read32(Ptr + Size - 4) << 32) | Read32(Ptr + Size - 4 - Offset);
+        }
+        else if (Size > 0) {
+            A = (static_cast<uint64>(Ptr[0]) << 16) | (static_cast<uint64>(Ptr[Size >> 1]) << 8) | Ptr[Size - 1];
+        }
+
+        A ^= Key1;
+        B ^= Seed;
+        Multiply128(A, B);
+        return HashMix(A ^ Key0 ^ Length, B ^ Key1);
+    }
+
+    static FORCEINLINE uint64 FinalizeLow(uint64 Seed, uint64 See1, uint64 See2, const uint8* Tail, size_t TailSize, uint64 Length) {
+        if (Length > HashStripeSize) {
+            Seed ^= See1 ^ See2;
+        }
+        return FinalizeTail(Seed, Tail, TailSize, Length, HashSecret[0], HashSecret[1]);
+    }
+
+    //  64 λʹ·״̬һϺһ鳣,  64 λ໥
+    static FORCEINLINE uint64 FinalizeHigh(uint64 Seed, uint64 See1, uint64 See2, const uint8* Tail, size_t TailSize, uint64 Length) {
+        Seed ^= HashSecret[2];
+        if (Length > HashStripeSize) {
+            Seed ^= std::rotl(See1, 29) ^ std::rotl(See2, 47);
+        }
+        return FinalizeTail(Seed, Tail, TailSize, Length, HashSecret[3], HashSecret[2]);
+    }
+
+    uint64 Hash64(const void* Data, size_t Size, uint64 Seed) {
+        const uint8* Ptr = static_cast<const uint8*>(Data);
+        const uint64 Length = Size;
+
+        Seed = InitSeed(Seed);
+        uint64 See1 = Seed;
+        uint64 See2 = Seed;
+
+        while (Size > HashStripeSize) {
+            ConsumeStripe(Seed, See1, See2, Ptr);
+            Ptr += HashStripeSize;
+            Size -= HashStripeSize;
+        }
+
+        return FinalizeLow(Seed, See1, See2, Ptr, Size, Length);
+    }
+
+    FHash128 Hash128(const void* Data, size_t Size, uint64 Seed) {
+        const uint8* Ptr = static_cast<const uint8*>(Data);
+        const uint64 Length = Size;
+
+        Seed = InitSeed(Seed);
+        uint64 See1 = Seed;
+        uint64 See2 = Seed;
+
+        while (Size > HashStripeSize) {
+            ConsumeStripe(Seed, See1, See2, Ptr);
+            Ptr += HashStripeSize;
+            Size -= HashStripeSize;
+        }
+
+        FHash128 Result;
+        Result.Low = FinalizeLow(Seed, See1, See2, Ptr, Size, Length);
+        Result.High = FinalizeHigh(Seed, See1, See2, Ptr, Size, Length);
+        return Result;
+    }
+
+    FHasher::FHasher(uint64 InSeed)
+        : Seed(InitSeed(InSeed))
+        , See1(Seed)
+        , See2(Seed)
+    {
+    }
+
+    void FHasher::Update(const void* Data, size_t Size) {
+        const uint8* Ptr = static_cast<const uint8*>(Data);
+        Length += Size;
+
+        if (BufferSize + Size <= HashStripeSize) {
+            if (Size > 0) {
+                std::memcpy(Buffer + BufferSize, Ptr, Size);
+                BufferSize += Size;
+            }
+            return;
+        }
+
+        //  Hash64 һ: ֻк滹ʱŴһ,  1..48 ֽ Finalize
+        if (BufferSize > 0) {
+            const size_t Fill = HashStripeSize - BufferSize;
+            std::memcpy(Buffer + BufferSize, Ptr, Fill);
+            ConsumeStripe(Seed, See1, See2, Buffer);
+            Ptr += Fill;
+            Size -= Fill;
+        }
+
+        while (Size > HashStripeSize) {
+            ConsumeStripe(Seed, See1, See2, Ptr);
+            Ptr += HashStripeSize;
+            Size -= HashStripeSize;
+        }
+
+        std::memcpy(Buffer, Ptr, Size);
+        BufferSize = Size;
+    }
+
+    uint64 FHasher::Finalize() const {
+        return FinalizeLow(Seed, See1, See2, Buffer, BufferSize, Length);
+    }
+
+    FHash128 FHasher::Finalize128() const {
+        FHash128 Result;
+        Result.Low = FinalizeLow(Seed, See1, See2, Buffer, BufferSize, Length);
+        Result.High = FinalizeHigh(Seed, See1, See2, Buffer, BufferSize, Length);
+        return Result;
+    }
+
 /*
     // 
     int value = 42;
@@ -27,5 +198,12 @@ namespace Dash
 
     // ϶ֵ
     size_t combined = Hash::HashMultiple(value, str, obj);
+
+    // ϣ
+    FHasher hasher;
+    hasher.Update(value);
+    hasher.Update(array, 100);
+    hasher.Update(std::string_view(str));
+    uint64 hash5 = hasher.Finalize();
 */
 }
\ No newline at end of file
@@ -1,18 +1,13 @@
 #pragma once
 
+#include <string_view>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace Dash
 {
-    // SSE CRC32 Լ
-    #ifdef _MSC_VER
-    #include <intrin.h>
-    #define ENABLE_SSE_CRC32 1
-    #elif defined(__SSE4_2__)
-    #include <nmmintrin.h>
-    #define ENABLE_SSE_CRC32 1
-    #else
-    #define ENABLE_SSE_CRC32 0
-    #endif
-
     // FNV-1a ϣ
     constexpr size_t FNV_OFFSET_BASIS = sizeof(size_t) == 8 ? 14695981039346656037ULL : 2166136261U;
     constexpr size_t FNV_PRIME = sizeof(size_t) == 8 ? 1099511628211ULL : 16777619U;
@@ -32,90 +27,29 @@ namespace Dash
         return reinterpret_cast<T*>(addr);
     }
 
-    // ĹϣΧ - Ż汾
-    inline size_t HashRangeOptimized(const uint8* Begin, const uint8* End, size_t Hash) {
-#if ENABLE_SSE_CRC32
-        // СݵĿ·
-        const size_t Length = End - Begin;
-        if (Length <= 16) {
-            // СݣֱӴֽ
-            for (const uint8* p = Begin; p < End; ++p) {
-                Hash = _mm_crc32_u8(static_cast<uint32>(Hash), *p);
-            }
-            return Hash;
-        }
-
-        const uint8* Current = Begin;
-
-        // ׶1: δǰ׺ֱ8ֽڶ
-        while (Current < End && (reinterpret_cast<uintptr_t>(Current) & 7)) {
-            Hash = _mm_crc32_u8(static_cast<uint32>(Hash), *Current++);
-        }
-
-        // ׶2: 8ֽڿ
-        const uint64* Current64 = reinterpret_cast<const uint64*>(Current);
-        const uint64* End64 = reinterpret_cast<const uint64*>(AlignDown(End, 8));
-
-        // չѭ
-        while (Current64 + 4 <= End64) {
-            Hash = _mm_crc32_u64(Hash, Current64[0]);
-            Hash = _mm_crc32_u64(Hash, Current64[1]);
-            Hash = _mm_crc32_u64(Hash, Current64[2]);
-            Hash = _mm_crc32_u64(Hash, Current64[3]);
-            Current64 += 4;
-        }
-
-        // ʣ8ֽڿ
-        while (Current64 < End64) {
-            Hash = _mm_crc32_u64(Hash, *Current64++);
-        }
+    // 128 λϣֵ
+    struct FHash128 {
+        uint64 Low = 0;
+        uint64 High = 0;
 
-        // ׶3: ʣֽ
-        Current = reinterpret_cast<const uint8*>(Current64);
-        while (Current < End) {
-            Hash = _mm_crc32_u8(static_cast<uint32>(Hash), *Current++);
-        }
+        bool operator==(const FHash128& Other) const = default;
+    };
 
+    // 64/128 λǼܹϣ, wyhash ṹ: 64x64->128 λ˷ߵλ۵, ÿ 48 ֽ·.
+    //  64 λ,  CPU , Сƽ̨Ͻȶ, Գ־û. ֿܵ⹹ײ.
+    uint64 Hash64(const void* Data, size_t Size, uint64 Seed = 0);
+    FHash128 Hash128(const void* Data, size_t Size, uint64 Seed = 0);
+
+    //  64 λֵĳ˷۵,  HashCombine ඨ
+    inline uint64 HashMix(uint64 A, uint64 B) {
+#if defined(_MSC_VER)
+        uint64 High;
+        const uint64 Low = _umul128(A, B, &High);
+        return Low ^ High;
 #else
-        // FNV-1a ϣʵ֣SSE
-        const size_t Length = End - Begin;
-
-        // ڴݣʹֶĴ
-        if (Length >= sizeof(size_t)) {
-            const uint8* Current = Begin;
-
-            // δǰ׺
-            while (Current < End && (reinterpret_cast<uintptr_t>(Current) & (sizeof(size_t) - 1))) {
-                Hash ^= *Current++;
-                Hash *= FNV_PRIME;
-            }
-
-            // 
-            const size_t* CurrentWord = reinterpret_cast<const size_t*>(Current);
-            const size_t* EndWord = reinterpret_cast<const size_t*>(AlignDown(End, sizeof(size_t)));
-
-            while (CurrentWord < EndWord) {
-                Hash ^= *CurrentWord++;
-                Hash *= FNV_PRIME;
-            }
-
-            // ʣֽ
-            Current = reinterpret_cast<const uint8*>(CurrentWord);
-            while (Current < End) {
-                Hash ^= *Current++;
-                Hash *= FNV_PRIME;
-            }
-        }
-        else {
-            // СֱӴ
-            for (const uint8* p = Begin; p < End; ++p) {
-                Hash ^= *p;
-                Hash *= FNV_PRIME;
-            }
-        }
+        const unsigned __int128 Product = static_cast<unsigned __int128>(A) * B;
+        return static_cast<uint64>(Product) ^ static_cast<uint64>(Product >> 64);
 #endif
-
-        return Hash;
     }
 
     // 
@@ -129,14 +63,54 @@ namespace Dash
     template<typename T>
     inline constexpr bool is_trivially_hashable_v = is_trivially_hashable<T>::value;
 
+    // ϣ״̬:  Update ĽƴӺݵһ Hash64 / Hash128 ȫͬ.
+    // Finalize ޸״̬, ֮Լ Update.
+    class FHasher {
+    public:
+        explicit FHasher(uint64 Seed = 0);
+
+        void Update(const void* Data, size_t Size);
+
+        template<typename T>
+        void Update(const T& Value) {
+            static_assert(is_trivially_hashable_v<T>, "Type is not trivially hashable.");
+            Update(&Value, sizeof(T));
+        }
+
+        template<typename T>
+        void Update(const T* Values, size_t Count) {
+            static_assert(is_trivially_hashable_v<T>, "Type is not trivially hashable.");
+            Update(static_cast<const void*>(Values), sizeof(T) * Count);
+        }
+
+        // д볤,  "ab" + "c"  "a" + "bc" õͬ
+        void Update(std::string_view String) {
+            Update(static_cast<uint64>(String.size()));
+            Update(String.data(), String.size());
+        }
+
+        void Update(const std::string& String) {
+            Update(std::string_view(String));
+        }
+
+        uint64 Finalize() const;
+        FHash128 Finalize128() const;
+
+    private:
+        uint64 Seed;
+        uint64 See1;
+        uint64 See2;
+        uint64 Length = 0;
+        size_t BufferSize = 0;
+        uint8 Buffer[48];
+    };
+
     // ϣģ
     template<typename T>
     inline size_t HashState(const T* Data, size_t Count = 1, size_t Hash = FNV_OFFSET_BASIS) {
         if constexpr (is_trivially_hashable_v<T>) {
             // ƽֱͣӹϣڴ
-            const uint8* Begin = reinterpret_cast<const uint8*>(Data);
-            const uint8* End = reinterpret_cast<const uint8*>(Data + Count);
-            return HashRangeOptimized(Begin, End, Hash);
+            return Hash64(Data, sizeof(T) * Count, Hash);
         }
         else {
             // ڷƽͣҪԶϣ
@@ -152,11 +126,7 @@ namespace Dash
             // Cַ
             Count = std::strlen(Data);
         }
-        return HashRangeOptimized(
-            reinterpret_cast<const uint8*>(Data),
-            reinterpret_cast<const uint8*>(Data + Count),
-            Hash
-        );
+        return Hash64(Data, Count, Hash);
     }
 
     // ϣ
@@ -166,11 +136,7 @@ namespace Dash
             return HashState(&Object, 1, Hash);
         }
         else if constexpr (std::is_same_v<T, std::string>) {
-            return HashRangeOptimized(
-                reinterpret_cast<const uint8*>(Object.data()),
-                reinterpret_cast<const uint8*>(Object.data() + Object.size()),
-                Hash
-            );
+            return Hash64(Object.data(), Object.size(), Hash);
         }
         else {
             static_assert(sizeof(T) == 0, "Type is not hashable. Please provide a specialization.");
@@ -178,15 +144,9 @@ namespace Dash
         }
     }
 
-    // ϶ϣֵ
+    // ϶ϣֵ, ˳й
     inline size_t HashCombine(size_t Hash1, size_t Hash2) {
-        // ʹûƽħ
-        if constexpr (sizeof(size_t) == 8) {
-            return Hash1 ^ (Hash2 + 0x9e3779b97f4a7c15ULL + (Hash1 << 6) + (Hash1 >> 2));
-        }
-        else {
-            return Hash1 ^ (Hash2 + 0x9e3779b9U + (Hash1 << 6) + (Hash1 >> 2));
-        }
+        return static_cast<size_t>(HashMix(Hash1 ^ 0x2d358dccaa6c78a5ULL, Hash2 ^ 0x8bb84b93962eacc9ULL));
     }
 
     // ģ壺ϣֵ
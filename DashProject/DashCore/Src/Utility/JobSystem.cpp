@@ -0,0 +1,464 @@
+#include "PCH.h"
+#include "JobSystem.h"
+
+namespace Dash
+{
+	struct FJob
+	{
+		std::function<void()> Function;
+		const char* Name;
+		EJobPriority Priority;
+		FJobCounter* Counter;
+	};
+
+	// Counter value while the last job hands the dependents over, neither done nor accepting new dependents.
+	static constexpr int32 GJobCounterReleasing = -1;
+
+	// Yields before an idle worker goes to sleep.
+	static constexpr uint32 GJobIdleSpinCount = 64;
+
+	static constexpr size_t GJobDequeCapacity = 4096;
+
+	static thread_local uint32 GJobWorkerIndex = UINT32_MAX;
+	static thread_local uint32 GJobStealRandomState = 0;
+
+	// Jobs running on the thread, more than one while a job waits, and the id of the outermost one.
+	static thread_local uint32 GJobDepth = 0;
+	static thread_local uint64 GJobOutermostId = 0;
+	static thread_local uint64 GJobLastOutermostId = 0;
+
+	static uint32 NextStealRandom()
+	{
+		uint32 state = GJobStealRandomState;
+		if (state == 0)
+		{
+			state = static_cast<uint32>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1u;
+		}
+
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		GJobStealRandomState = state;
+		return state;
+	}
+
+	FJobSystem& FJobSystem::Get()
+	{
+		static FJobSystem instance;
+		return instance;
+	}
+
+	void FJobSystem::Init(uint32 numWorkers)
+	{
+		ASSERT(!IsRunning());
+
+		if (numWorkers == 0)
+		{
+			numWorkers = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+		}
+
+		mWorkers.clear();
+		for (uint32 workerIndex = 0; workerIndex < numWorkers; ++workerIndex)
+		{
+			std::unique_ptr<FWorker> worker = std::make_unique<FWorker>();
+			for (std::unique_ptr<FJobDeque>& deque : worker->Deques)
+			{
+				deque = std::make_unique<FJobDeque>(GJobDequeCapacity);
+			}
+			mWorkers.push_back(std::move(worker));
+		}
+
+		mRunning.store(true, std::memory_order_release);
+
+		// The workers steal from each other, so all of them exist before the first one starts.
+		for (uint32 workerIndex = 0; workerIndex < numWorkers; ++workerIndex)
+		{
+			mWorkers[workerIndex]->Thread = std::thread(&FJobSystem::WorkerMain, this, workerIndex);
+		}
+
+		DASH_LOG(LogTemp, Info, "Job system started with {} workers", numWorkers);
+	}
+
+	void FJobSystem::Shutdown()
+	{
+		if (!IsRunning())
+		{
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mWakeLock);
+			mRunning.store(false, std::memory_order_release);
+			++mWakeEpoch;
+		}
+		mWakeCondition.notify_all();
+
+		for (std::unique_ptr<FWorker>& worker : mWorkers)
+		{
+			worker->Thread.join();
+		}
+
+		const uint32 workerIndex = GetCurrentWorkerIndex();
+		while (FJob* job = FindJob(workerIndex))
+		{
+			Execute(job, workerIndex);
+			FreeJob(job);
+		}
+
+		mWorkers.clear();
+
+		FJob* freeJob = nullptr;
+		while (mFreeJobs.TryPop(freeJob))
+		{
+			delete freeJob;
+		}
+	}
+
+	uint32 FJobSystem::GetCurrentWorkerIndex() const
+	{
+		return GJobWorkerIndex < mWorkers.size() ? GJobWorkerIndex : GetNumWorkers();
+	}
+
+	uint64 FJobSystem::GetOutermostJobId()
+	{
+		return GJobOutermostId;
+	}
+
+	void FJobSystem::Run(FJobDesc desc, FJobCounter* counter, FJobCounter* dependency)
+	{
+		ASSERT(desc.Function);
+
+		if (counter != nullptr)
+		{
+			AddToCounter(*counter, 1);
+		}
+
+		if (!IsRunning())
+		{
+			ASSERT_MSG(dependency == nullptr || dependency->IsDone(), "Job dependency can not be met without worker threads");
+
+			FJob job{ std::move(desc.Function), desc.Name, desc.Priority, counter };
+			Execute(&job, GetCurrentWorkerIndex());
+			return;
+		}
+
+		FJob* job = CreateJob(std::move(desc), counter);
+		if (dependency != nullptr)
+		{
+			ScheduleAfter(job, dependency);
+		}
+		else
+		{
+			Schedule(job);
+		}
+	}
+
+	void FJobSystem::Run(std::span<FJobDesc> descs, FJobCounter* counter, FJobCounter* dependency)
+	{
+		if (descs.empty())
+		{
+			return;
+		}
+
+		if (counter != nullptr)
+		{
+			AddToCounter(*counter, static_cast<int32>(descs.size()));
+		}
+
+		for (FJobDesc& desc : descs)
+		{
+			ASSERT(desc.Function);
+
+			if (!IsRunning())
+			{
+				ASSERT_MSG(dependency == nullptr || dependency->IsDone(), "Job dependency can not be met without worker threads");
+
+				FJob job{ std::move(desc.Function), desc.Name, desc.Priority, counter };
+				Execute(&job, GetCurrentWorkerIndex());
+				continue;
+			}
+
+			FJob* job = CreateJob(std::move(desc), counter);
+			if (dependency != nullptr)
+			{
+				ScheduleAfter(job, dependency);
+			}
+			else
+			{
+				Schedule(job);
+			}
+		}
+	}
+
+	void FJobSystem::Wait(FJobCounter& counter)
+	{
+		const uint32 workerIndex = GetCurrentWorkerIndex();
+		while (!counter.IsDone())
+		{
+			if (FJob* job = FindJob(workerIndex))
+			{
+				Execute(job, workerIndex);
+				FreeJob(job);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	void FJobSystem::WorkerMain(uint32 workerIndex)
+	{
+		GJobWorkerIndex = workerIndex;
+
+		uint32 idleSpins = 0;
+		while (mRunning.load(std::memory_order_acquire))
+		{
+			if (FJob* job = FindJob(workerIndex))
+			{
+				Execute(job, workerIndex);
+				FreeJob(job);
+				idleSpins = 0;
+				continue;
+			}
+
+			if (++idleSpins < GJobIdleSpinCount)
+			{
+				std::this_thread::yield();
+				continue;
+			}
+			idleSpins = 0;
+
+			uint64 wakeEpoch;
+			{
+				std::lock_guard<std::mutex> lock(mWakeLock);
+				wakeEpoch = mWakeEpoch;
+			}
+
+			// Announce the sleep before the last look for work, pairs with the fence in WakeWorkers.
+			mSleepingWorkers.fetch_add(1);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			FJob* job = FindJob(workerIndex);
+			if (job == nullptr)
+			{
+				std::unique_lock<std::mutex> lock(mWakeLock);
+				mWakeCondition.wait(lock, [&]() { return mWakeEpoch != wakeEpoch || !mRunning.load(std::memory_order_acquire); });
+			}
+
+			mSleepingWorkers.fetch_sub(1);
+
+			if (job != nullptr)
+			{
+				Execute(job, workerIndex);
+				FreeJob(job);
+			}
+		}
+
+		GJobWorkerIndex = UINT32_MAX;
+	}
+
+	void FJobSystem::AddToCounter(FJobCounter& counter, int32 count)
+	{
+		// While the last job of the previous batch releases the counter it stores 0 over whatever it holds, so an
+		// increment has to wait until the release is done.
+		int32 value = counter.mValue.load(std::memory_order_acquire);
+		for (;;)
+		{
+			if (value == GJobCounterReleasing)
+			{
+				std::this_thread::yield();
+				value = counter.mValue.load(std::memory_order_acquire);
+				continue;
+			}
+
+			if (counter.mValue.compare_exchange_weak(value, value + count, std::memory_order_acq_rel, std::memory_order_acquire))
+			{
+				return;
+			}
+		}
+	}
+
+	FJob* FJobSystem::CreateJob(FJobDesc&& desc, FJobCounter* counter)
+	{
+		FJob* job = nullptr;
+		if (!mFreeJobs.TryPop(job))
+		{
+			return new FJob{ std::move(desc.Function), desc.Name, desc.Priority, counter };
+		}
+
+		job->Function = std::move(desc.Function);
+		job->Name = desc.Name;
+		job->Priority = desc.Priority;
+		job->Counter = counter;
+		return job;
+	}
+
+	void FJobSystem::FreeJob(FJob* job)
+	{
+		// Release the captures now, not when the job is reused.
+		job->Function = nullptr;
+
+		if (!mFreeJobs.TryPush(job))
+		{
+			delete job;
+		}
+	}
+
+	void FJobSystem::Schedule(FJob* job)
+	{
+		// Dependents released while the workers are stopped.
+		if (!IsRunning())
+		{
+			Execute(job, GetCurrentWorkerIndex());
+			delete job;
+			return;
+		}
+
+		const size_t priority = static_cast<size_t>(job->Priority);
+		const uint32 workerIndex = GetCurrentWorkerIndex();
+
+		if (workerIndex >= mWorkers.size() || !mWorkers[workerIndex]->Deques[priority]->Push(job))
+		{
+			mSharedQueues[priority].Push(job);
+		}
+
+		WakeWorkers();
+	}
+
+	void FJobSystem::ScheduleAfter(FJob* job, FJobCounter* dependency)
+	{
+		{
+			std::lock_guard<std::mutex> lock(dependency->mDependentsLock);
+			if (dependency->mValue.load(std::memory_order_acquire) > 0)
+			{
+				dependency->mDependents.push_back(job);
+				return;
+			}
+		}
+
+		Schedule(job);
+	}
+
+	FJob* FJobSystem::FindJob(uint32 workerIndex)
+	{
+		const uint32 numWorkers = GetNumWorkers();
+
+		for (size_t priority = 0; priority < static_cast<size_t>(EJobPriority::Num); ++priority)
+		{
+			if (workerIndex < numWorkers)
+			{
+				if (FJob* job = mWorkers[workerIndex]->Deques[priority]->Pop())
+				{
+					return job;
+				}
+			}
+
+			FJob* job = nullptr;
+			if (mSharedQueues[priority].TryPop(job))
+			{
+				return job;
+			}
+
+			if (numWorkers > 0)
+			{
+				const uint32 firstVictim = NextStealRandom() % numWorkers;
+				for (uint32 i = 0; i < numWorkers; ++i)
+				{
+					const uint32 victim = (firstVictim + i) % numWorkers;
+					if (victim == workerIndex)
+					{
+						continue;
+					}
+
+					if (FJob* stolenJob = mWorkers[victim]->Deques[priority]->Steal())
+					{
+						return stolenJob;
+					}
+				}
+			}
+		}
+
+		return nullptr;
+	}
+
+	void FJobSystem::Execute(FJob* job, uint32 workerIndex)
+	{
+		if (mProfilingHooks.OnJobBegin)
+		{
+			mProfilingHooks.OnJobBegin(job->Name, job->Priority, workerIndex);
+		}
+
+		if (GJobDepth++ == 0)
+		{
+			GJobOutermostId = ++GJobLastOutermostId;
+		}
+
+		job->Function();
+
+		if (--GJobDepth == 0)
+		{
+			GJobOutermostId = 0;
+		}
+
+		if (mProfilingHooks.OnJobEnd)
+		{
+			mProfilingHooks.OnJobEnd(job->Name, job->Priority, workerIndex);
+		}
+
+		FJobCounter* counter = job->Counter;
+		if (counter == nullptr)
+		{
+			return;
+		}
+
+		int32 value = counter->mValue.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			ASSERT(value > 0);
+
+			if (value > 1)
+			{
+				if (counter->mValue.compare_exchange_weak(value, value - 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+				{
+					return;
+				}
+				continue;
+			}
+
+			std::vector<FJob*> dependents;
+			{
+				std::lock_guard<std::mutex> lock(counter->mDependentsLock);
+				if (!counter->mValue.compare_exchange_strong(value, GJobCounterReleasing, std::memory_order_acq_rel, std::memory_order_relaxed))
+				{
+					continue;
+				}
+				dependents.swap(counter->mDependents);
+			}
+
+			// Last access to the counter, a waiter may destroy it as soon as it reads zero.
+			counter->mValue.store(0, std::memory_order_release);
+
+			for (FJob* dependent : dependents)
+			{
+				Schedule(dependent);
+			}
+			return;
+		}
+	}
+
+	void FJobSystem::WakeWorkers()
+	{
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (mSleepingWorkers.load(std::memory_order_relaxed) == 0)
+		{
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mWakeLock);
+			++mWakeEpoch;
+		}
+		mWakeCondition.notify_one();
+	}
+}
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "MPMCQueue.h"
+#include "WorkStealingDeque.h"
+
+namespace Dash
+{
+	// Work stealing job system.
+	//
+	// Every worker owns one Chase-Lev deque per priority. Jobs started on a worker go to its own deque,
+	// jobs started on any other thread go to a shared queue. An idle worker looks for work by priority,
+	// its own deque first, then the shared queue, then the deques of the other workers.
+	//
+	// Completion is tracked with FJobCounter: Run adds the number of jobs to the counter and every finished
+	// job subtracts one. A job can depend on a counter, it is held back until that counter reaches zero.
+	// Wait runs other jobs until the counter reaches zero, so it can be called from the main thread and
+	// from inside jobs without blocking a worker.
+	//
+	// Before Init and after Shutdown, Run executes the job on the calling thread, so code that uses the
+	// job system also works in tools that never start it.
+
+	enum class EJobPriority : uint8
+	{
+		High,
+		Normal,
+		Low,
+		Num,
+	};
+
+	struct FJob;
+
+	class FJobCounter
+	{
+		friend class FJobSystem;
+	public:
+		FJobCounter() = default;
+
+		FJobCounter(const FJobCounter&) = delete;
+		FJobCounter& operator=(const FJobCounter&) = delete;
+
+		~FJobCounter()
+		{
+			ASSERT(IsDone());
+		}
+
+		bool IsDone() const { return mValue.load(std::memory_order_acquire) == 0; }
+
+		int32 GetValue() const { return mValue.load(std::memory_order_acquire); }
+
+	private:
+		std::atomic<int32> mValue{ 0 };
+
+		// Jobs waiting for the counter to reach zero.
+		std::mutex mDependentsLock;
+		std::vector<FJob*> mDependents;
+	};
+
+	struct FJobDesc
+	{
+		std::function<void()> Function;
+
+		// Shown by the profiling hooks, which may keep it past the job: use a string literal.
+		const char* Name = "Job";
+
+		EJobPriority Priority = EJobPriority::Normal;
+	};
+
+	// Called on the thread that runs the job, right before and after its function.
+	// workerIndex is GetNumWorkers() for threads that are not workers and help in Wait.
+	struct FJobProfilingHooks
+	{
+		void (*OnJobBegin)(const char* name, EJobPriority priority, uint32 workerIndex) = nullptr;
+		void (*OnJobEnd)(const char* name, EJobPriority priority, uint32 workerIndex) = nullptr;
+	};
+
+	class FJobSystem
+	{
+	public:
+		static FJobSystem& Get();
+
+		/**
+		 * Start the worker threads.
+		 * @param numWorkers defaults to one less than the hardware threads, the main thread helps in Wait.
+		 */
+		void Init(uint32 numWorkers = 0);
+
+		/**
+		 * Stop the workers, jobs that are still queued run on the calling thread first.
+		 */
+		void Shutdown();
+
+		bool IsRunning() const { return mRunning.load(std::memory_order_acquire); }
+
+		uint32 GetNumWorkers() const { return static_cast<uint32>(mWorkers.size()); }
+
+		/**
+		 * @returns the index of the calling worker, or GetNumWorkers() on any other thread.
+		 */
+		uint32 GetCurrentWorkerIndex() const;
+
+		/**
+		 * @returns an id of the outermost job running on the calling thread, or 0 outside of any job. Jobs that Wait
+		 * runs inside another job share the id of that job, a new outermost job on the same thread gets a new id.
+		 */
+		static uint64 GetOutermostJobId();
+
+		/**
+		 * Start a job. counter, if set, is incremented now and decremented when the job finishes.
+		 * dependency, if set, holds the job back until it reaches zero. Both must outlive the job.
+		 */
+		void Run(FJobDesc desc, FJobCounter* counter = nullptr, FJobCounter* dependency = nullptr);
+
+		/**
+		 * Start a batch of jobs, counter is incremented once by the batch size.
+		 */
+		void Run(std::span<FJobDesc> descs, FJobCounter* counter = nullptr, FJobCounter* dependency = nullptr);
+
+		/**
+		 * Run a function as a job and return its result through a future.
+		 * Prefer a counter and Wait inside jobs, a future blocks without helping.
+		 */
+		template<typename FuncType>
+		auto Async(const char* name, FuncType&& func, EJobPriority priority = EJobPriority::Normal) -> std::future<std::invoke_result_t<std::decay_t<FuncType>>>;
+
+		/**
+		 * Run jobs on the calling thread until counter reaches zero.
+		 */
+		void Wait(FJobCounter& counter);
+
+		/**
+		 * Set before Init, the workers read the hooks without synchronization.
+		 */
+		void SetProfilingHooks(const FJobProfilingHooks& hooks) { mProfilingHooks = hooks; }
+
+	private:
+		using FJobDeque = TWorkStealingDeque<FJob>;
+
+		struct FWorker
+		{
+			std::thread Thread;
+			std::unique_ptr<FJobDeque> Deques[static_cast<size_t>(EJobPriority::Num)];
+		};
+
+		void WorkerMain(uint32 workerIndex);
+
+		static void AddToCounter(FJobCounter& counter, int32 count);
+
+		FJob* CreateJob(FJobDesc&& desc, FJobCounter* counter);
+		void FreeJob(FJob* job);
+		void Schedule(FJob* job);
+		void ScheduleAfter(FJob* job, FJobCounter* dependency);
+
+		FJob* FindJob(uint32 workerIndex);
+		void Execute(FJob* job, uint32 workerIndex);
+		void WakeWorkers();
+
+	private:
+		std::vector<std::unique_ptr<FWorker>> mWorkers;
+		TMPMCQueue<FJob*> mSharedQueues[static_cast<size_t>(EJobPriority::Num)];
+
+		// Finished jobs kept for reuse, so starting a job does not allocate once the pool is warm.
+		TMPMCBoundedQueue<FJob*> mFreeJobs{ 1024 };
+
+		std::atomic<bool> mRunning{ false };
+		std::atomic<int32> mSleepingWorkers{ 0 };
+		std::mutex mWakeLock;
+		std::condition_variable mWakeCondition;
+		uint64 mWakeEpoch = 0;
+
+		FJobProfilingHooks mProfilingHooks;
+	};
+
+	// Member Function
+
+	// --Implementation-- //
+
+	template<typename FuncType>
+	auto FJobSystem::Async(const char* name, FuncType&& func, EJobPriority priority) -> std::future<std::invoke_result_t<std::decay_t<FuncType>>>
+	{
+		using ResultType = std::invoke_result_t<std::decay_t<FuncType>>;
+
+		// std::function needs a copyable target, so the move-only task is shared.
+		std::shared_ptr<std::packaged_task<ResultType()>> task = std::make_shared<std::packaged_task<ResultType()>>(std::forward<FuncType>(func));
+		std::future<ResultType> future = task->get_future();
+
+		Run(FJobDesc{ [task]() { (*task)(); }, name, priority });
+		return future;
+	}
+}
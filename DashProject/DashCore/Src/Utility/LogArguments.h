@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace Dash
+{
+	class FName;
+
+	// Appends the text of a deferred log message: format applied to the arguments encoded by TLogArgument.
+	using FLogFormatFunc = void(*)(std::string& out, std::string_view format, const uint8* arguments);
+
+	// How one log argument is stored in a deferred record and read back on the log thread.
+	//
+	// Strings are copied as a length and the characters and come back as views into the record. Numbers, enums,
+	// void pointers and FName are copied as raw bytes. Everything else cannot be deferred, the message is then
+	// formatted at the call site: other trivially copyable types may point to data that is gone by the time the
+	// log thread gets to them, or have formatters that read state which has changed since.
+	template<typename T>
+	struct TLogArgument
+	{
+		static constexpr bool bString = std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+			|| std::is_same_v<T, const char*> || std::is_same_v<T, char*>
+			|| (std::is_array_v<T> && std::is_same_v<std::remove_cv_t<std::remove_extent_t<T>>, char>);
+
+		static constexpr bool bRaw = std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_same_v<T, std::nullptr_t>
+			|| (std::is_pointer_v<T> && std::is_void_v<std::remove_cv_t<std::remove_pointer_t<T>>>) || std::is_same_v<T, FName>;
+
+		static constexpr bool bDeferrable = bString || bRaw;
+
+		using FDecoded = std::conditional_t<bString, std::string_view, T>;
+
+		static size_t GetSize(const T& value)
+		{
+			if constexpr (bString)
+			{
+				return sizeof(uint32) + ToStringView(value).size();
+			}
+			else
+			{
+				return sizeof(T);
+			}
+		}
+
+		static uint8* Encode(uint8* out, const T& value)
+		{
+			if constexpr (bString)
+			{
+				const std::string_view string = ToStringView(value);
+				const uint32 length = static_cast<uint32>(string.size());
+				std::memcpy(out, &length, sizeof(length));
+				std::memcpy(out + sizeof(length), string.data(), string.size());
+				return out + sizeof(length) + string.size();
+			}
+			else
+			{
+				std::memcpy(out, &value, sizeof(T));
+				return out + sizeof(T);
+			}
+		}
+
+		static FDecoded Decode(const uint8*& in)
+		{
+			if constexpr (bString)
+			{
+				uint32 length;
+				std::memcpy(&length, in, sizeof(length));
+				const std::string_view string(reinterpret_cast<const char*>(in) + sizeof(length), length);
+				in += sizeof(length) + length;
+				return string;
+			}
+			else
+			{
+				T value;
+				std::memcpy(&value, in, sizeof(T));
+				in += sizeof(T);
+				return value;
+			}
+		}
+
+	private:
+		static std::string_view ToStringView(const T& value)
+		{
+			if constexpr (std::is_array_v<T>)
+			{
+				return std::string_view(value, ::strnlen(value, std::extent_v<T>));
+			}
+			else
+			{
+				return std::string_view(value);
+			}
+		}
+	};
+
+	template<typename... TArgs>
+	inline constexpr bool TLogArgumentsDeferrable = (TLogArgument<TArgs>::bDeferrable && ...);
+
+	template<typename... TArgs>
+	void FormatLogArguments(std::string& out, std::string_view format, const uint8* arguments)
+	{
+		// Braced initialization decodes left to right.
+		std::tuple<typename TLogArgument<TArgs>::FDecoded...> values{ TLogArgument<TArgs>::Decode(arguments)... };
+
+		std::apply([&out, format](auto&... decoded)
+		{
+			std::vformat_to(std::back_inserter(out), format, std::make_format_args(decoded...));
+		}, values);
+	}
+}
@@ -3,11 +3,24 @@
 #include <corecrt_io.h>
 #include <fcntl.h>
 #include "FileUtility.h"
+#include "SPSCByteRing.h"
+#include "Stats.h"
 
 namespace Dash
 {
 	static constexpr std::string_view Eol = "\n";
 
+	static FStatCounter GStatLogMessages("Log/Messages");
+
+	// Per thread buffer of the asynchronous mode, a message longer than half of it is truncated.
+	static constexpr size_t GLogThreadBufferSize = 256 * 1024;
+
+	// The log thread wakes up at least this often, and earlier when a buffer is half full or on Flush.
+	static constexpr std::chrono::milliseconds GLogThreadInterval{ 5 };
+
+	// ELogOverflowPolicy::Sample keeps one in this many messages.
+	static constexpr uint32 GLogSampleInterval = 8;
+
 	struct FLogEntry
 	{
 		ELogLevel Level;
@@ -17,6 +30,40 @@ namespace Dash
 		uint32 Line;
 	};
 
+	// Starts every record in a thread buffer. The message text follows, or for a deferred record the arguments
+	// encoded for FormatFunc, which formats them with the static format string on the log thread.
+	struct FLogRecordHeader
+	{
+		int64 Timestamp;	// system_clock ticks
+		const char* Category;
+		const char* File;
+		const char* Format;
+		FLogFormatFunc FormatFunc;
+		uint32 CategoryLength;
+		uint32 FileLength;
+		uint32 FormatLength;
+		uint32 Line;
+		uint32 ThreadId;
+		ELogLevel Level;
+	};
+
+	static FLogRecordHeader MakeRecordHeader(ELogLevel level, std::string_view category, std::string_view file, uint32 line)
+	{
+		FLogRecordHeader header;
+		header.Timestamp = std::chrono::system_clock::now().time_since_epoch().count();
+		header.Category = category.data();
+		header.File = file.data();
+		header.Format = nullptr;
+		header.FormatFunc = nullptr;
+		header.CategoryLength = static_cast<uint32>(category.size());
+		header.FileLength = static_cast<uint32>(file.size());
+		header.FormatLength = 0;
+		header.Line = line;
+		header.ThreadId = static_cast<uint32>(::GetCurrentThreadId());
+		header.Level = level;
+		return header;
+	}
+
 	LPSTR* CommandLineToArgvA(LPSTR lpCmdLine, INT* pNumArgs)
 	{
 		int retval;
@@ -100,27 +147,33 @@ namespace Dash
 		}
 	}
 
-	inline std::string MakePrefix(ELogLevel lvl, std::string_view category, std::string_view file, uint32 line, bool printFileAndLine = false) {
+	// Formats "[date time.ms] [category] [level] [TID=id] - ". The date part only changes once per second,
+	// so each thread keeps the last one it formatted.
+	static void AppendPrefix(std::string& out, ELogLevel lvl, std::string_view category, std::string_view file, uint32 line, uint32 threadId,
+		std::chrono::system_clock::time_point time, bool printFileAndLine = false)
+	{
 		using namespace std::chrono;
-		auto now = system_clock::now();
-		auto t = system_clock::to_time_t(now);
-		auto ms = duration_cast<milliseconds>(now.time_since_epoch()) % 1000;
-
-		std::tm tm;
-		localtime_s(&tm, &t);
-
-		std::ostringstream oss;
-		oss << "[" << std::put_time(&tm, "%Y-%m-%d %H:%M:%S");
-		oss << '.' << std::setw(3) << std::setfill('0') << ms.count() << "]";
-		oss << " [" << category << "]";
-		oss << " [" << ToString(lvl) << "]";
-		oss << " [TID=" << static_cast<unsigned long>(::GetCurrentThreadId()) << "]";
+
+		thread_local sys_seconds cachedSecond{};
+		thread_local char cachedDate[32] = {};
+
+		const sys_seconds second = floor<seconds>(time);
+		if (second != cachedSecond || cachedDate[0] == '\0')
+		{
+			std::time_t t = system_clock::to_time_t(second);
+			std::tm tm;
+			localtime_s(&tm, &t);
+			std::strftime(cachedDate, sizeof(cachedDate), "%Y-%m-%d %H:%M:%S", &tm);
+			cachedSecond = second;
+		}
+
+		const int64 ms = duration_cast<milliseconds>(time - second).count();
+		std::format_to(std::back_inserter(out), "[{}.{:03}] [{}] [{}] [TID={}]", cachedDate, ms, category, ToString(lvl), threadId);
 		if (printFileAndLine)
 		{
-			oss << " " << file << ":" << line;
+			std::format_to(std::back_inserter(out), " {}:{}", file, line);
 		}
-		oss << " - ";
-		return oss.str();
+		out.append(" - ");
 	}
 
 	class FVSLogSink : public ILogSink
@@ -256,7 +309,36 @@ namespace Dash
 		std::mutex mFileMutex;
 	};
 
-	void FLogManager::Init()
+	struct FLogManager::FLogThreadBuffer
+	{
+		FLogThreadBuffer() : Ring(GLogThreadBufferSize) {}
+
+		FSPSCByteRing Ring;
+
+		// Owning thread only.
+		uint32 SampleCounter = 0;
+
+		// The owning thread exited, guarded by mThreadBuffersLock.
+		bool bFree = false;
+	};
+
+	// Hands the thread's buffer back when the thread exits.
+	struct FLogThreadHandle
+	{
+		FLogManager::FLogThreadBuffer* Buffer = nullptr;
+
+		~FLogThreadHandle()
+		{
+			if (Buffer != nullptr)
+			{
+				FLogManager::Get()->ReleaseThreadBuffer(Buffer);
+			}
+		}
+	};
+
+	static thread_local FLogThreadHandle GLogThread;
+
+	void FLogManager::Init(bool bAsync, ELogOverflowPolicy overflowPolicy)
 	{
 		//int argc = 0;
 		//LPSTR* argv = CommandLineToArgvA(GetCommandLineA(), &argc);
@@ -267,10 +349,28 @@ namespace Dash
 		std::string logFileName = FFileUtility::CombinePath(FFileUtility::GetProjectDir(), "Saved\\log.txt");
 		FFileUtility::EnsureFileExist(logFileName);
 		mLogSinks.emplace_back(new FFileLogSink(logFileName));
+
+		if (bAsync)
+		{
+			mOverflowPolicy = overflowPolicy;
+			mStopLogThread = false;
+			mLogThread = std::thread(&FLogManager::LogThreadMain, this);
+			mAsync.store(true, std::memory_order_release);
+		}
 	}
 
 	void FLogManager::Shutdown()
 	{
+		if (mAsync.exchange(false))
+		{
+			{
+				std::lock_guard<std::mutex> lock(mLogThreadLock);
+				mStopLogThread = true;
+			}
+			mWakeCondition.notify_one();
+			mLogThread.join();
+		}
+
 		for (int32 i = 0; i < mLogSinks.size(); i++)
 		{
 			mLogSinks[i]->Flush();
@@ -280,20 +380,285 @@ namespace Dash
 		mLogSinks.clear();
 	}
 
-	void FLogManager::Write(ELogLevel level, std::string_view category, std::string_view file, uint32 line, std::string_view log)
+	void FLogManager::Flush()
 	{
-		std::string	formattedMessage = MakePrefix(level, category, file, line);
-		formattedMessage.append(log);
-		formattedMessage.append(Eol);
+		if (!mAsync.load(std::memory_order_acquire))
+		{
+			for (ILogSink* sink : mLogSinks)
+			{
+				sink->Flush();
+			}
+			return;
+		}
 
-		for (ILogSink* sink : mLogSinks)
+		std::unique_lock<std::mutex> lock(mLogThreadLock);
+		const uint64 request = ++mFlushRequested;
+		mWakeCondition.notify_one();
+		mFlushedCondition.wait(lock, [this, request]() { return mFlushCompleted >= request; });
+	}
+
+	void FLogManager::Write(ELogLevel level, std::string_view category, std::string_view file, uint32 line, std::string_view log)
+	{
+		if (mAsync.load(std::memory_order_acquire))
 		{
-			sink->Log(level, category, formattedMessage);
+			WriteAsync(level, category, file, line, log);
+		}
+		else
+		{
+			std::string formattedMessage;
+			AppendPrefix(formattedMessage, level, category, file, line, static_cast<uint32>(::GetCurrentThreadId()), std::chrono::system_clock::now());
+			formattedMessage.append(log);
+			formattedMessage.append(Eol);
+
+			WriteToSinks(level, category, formattedMessage);
 		}
 
 		if (EnumMaskContains(level, ELogLevel::Fatal))
 		{
+			Flush();
 			ASSERT(false);
 		}
 	}
+
+	void FLogManager::WriteAsync(ELogLevel level, std::string_view category, std::string_view file, uint32 line, std::string_view log)
+	{
+		const FLogRecordHeader header = MakeRecordHeader(level, category, file, line);
+
+		FLogThreadBuffer& buffer = GetThreadBuffer();
+		const std::string_view message = log.substr(0, buffer.Ring.GetMaxRecordSize() - sizeof(FLogRecordHeader));
+
+		uint8* record = ReserveRecord(buffer, level, sizeof(header) + message.size());
+		if (record != nullptr)
+		{
+			std::memcpy(record, &header, sizeof(header));
+			std::memcpy(record + sizeof(header), message.data(), message.size());
+			CommitRecord(buffer);
+		}
+	}
+
+	uint8* FLogManager::BeginDeferred(ELogLevel level, std::string_view category, std::string_view file, uint32 line, std::string_view format,
+		FLogFormatFunc formatFunc, size_t argumentsSize)
+	{
+		FLogRecordHeader header = MakeRecordHeader(level, category, file, line);
+		header.Format = format.data();
+		header.FormatLength = static_cast<uint32>(format.size());
+		header.FormatFunc = formatFunc;
+
+		uint8* record = ReserveRecord(GetThreadBuffer(), level, sizeof(header) + argumentsSize);
+		if (record == nullptr)
+		{
+			return nullptr;
+		}
+
+		std::memcpy(record, &header, sizeof(header));
+		return record + sizeof(header);
+	}
+
+	void FLogManager::EndDeferred()
+	{
+		CommitRecord(GetThreadBuffer());
+	}
+
+	size_t FLogManager::GetMaxDeferredSize()
+	{
+		return GetThreadBuffer().Ring.GetMaxRecordSize() - sizeof(FLogRecordHeader);
+	}
+
+	uint8* FLogManager::ReserveRecord(FLogThreadBuffer& buffer, ELogLevel level, size_t size)
+	{
+		FSPSCByteRing& ring = buffer.Ring;
+
+		// A fatal message is followed by a break into the debugger, it must not be lost.
+		const ELogOverflowPolicy policy = EnumMaskContains(level, ELogLevel::Fatal) ? ELogOverflowPolicy::Block : mOverflowPolicy;
+
+		if (policy == ELogOverflowPolicy::Sample && ring.GetUsedBytes() > ring.GetCapacity() / 2 && level < ELogLevel::Warning
+			&& ++buffer.SampleCounter % GLogSampleInterval != 0)
+		{
+			mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		uint8* record = ring.BeginPush(size);
+		if (record == nullptr)
+		{
+			// Only the log thread drains its own buffer, a formatter logging there cannot wait for room.
+			if (policy != ELogOverflowPolicy::Block || std::this_thread::get_id() == mLogThread.get_id())
+			{
+				mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+				WakeLogThread();
+				return nullptr;
+			}
+
+			do
+			{
+				WakeLogThread();
+				std::this_thread::yield();
+				record = ring.BeginPush(size);
+			} while (record == nullptr);
+		}
+
+		return record;
+	}
+
+	void FLogManager::CommitRecord(FLogThreadBuffer& buffer)
+	{
+		buffer.Ring.EndPush();
+
+		if (buffer.Ring.GetUsedBytes() > buffer.Ring.GetCapacity() / 2)
+		{
+			WakeLogThread();
+		}
+	}
+
+	void FLogManager::WriteToSinks(ELogLevel level, std::string_view category, const std::string& log)
+	{
+		GStatLogMessages.Increment();
+
+		for (ILogSink* sink : mLogSinks)
+		{
+			sink->Log(level, category, log);
+		}
+	}
+
+	FLogManager::FLogThreadBuffer& FLogManager::GetThreadBuffer()
+	{
+		if (GLogThread.Buffer != nullptr)
+		{
+			return *GLogThread.Buffer;
+		}
+
+		std::lock_guard<std::mutex> lock(mThreadBuffersLock);
+
+		for (const std::unique_ptr<FLogThreadBuffer>& buffer : mThreadBuffers)
+		{
+			if (buffer->bFree)
+			{
+				buffer->bFree = false;
+				GLogThread.Buffer = buffer.get();
+				return *buffer;
+			}
+		}
+
+		mThreadBuffers.push_back(std::make_unique<FLogThreadBuffer>());
+		GLogThread.Buffer = mThreadBuffers.back().get();
+		return *mThreadBuffers.back();
+	}
+
+	void FLogManager::ReleaseThreadBuffer(FLogThreadBuffer* buffer)
+	{
+		std::lock_guard<std::mutex> lock(mThreadBuffersLock);
+		buffer->bFree = true;
+	}
+
+	void FLogManager::WakeLogThread()
+	{
+		// Not under the lock: a missed wake up only delays the log thread until its next interval.
+		mWakeCondition.notify_one();
+	}
+
+	void FLogManager::LogThreadMain()
+	{
+		std::unique_lock<std::mutex> lock(mLogThreadLock);
+		while (true)
+		{
+			mWakeCondition.wait_for(lock, GLogThreadInterval, [this]() { return mStopLogThread || mFlushRequested != mFlushCompleted; });
+
+			const bool bStop = mStopLogThread;
+			const uint64 flushRequested = mFlushRequested;
+			lock.unlock();
+
+			DrainThreadBuffers();
+
+			if (bStop || flushRequested != mFlushCompleted)
+			{
+				for (ILogSink* sink : mLogSinks)
+				{
+					sink->Flush();
+				}
+			}
+
+			lock.lock();
+
+			if (flushRequested != mFlushCompleted)
+			{
+				mFlushCompleted = flushRequested;
+				mFlushedCondition.notify_all();
+			}
+
+			if (bStop)
+			{
+				break;
+			}
+		}
+	}
+
+	void FLogManager::DrainThreadBuffers()
+	{
+		struct FBatchRecord
+		{
+			FLogRecordHeader Header;
+			size_t DataOffset;
+			size_t DataSize;
+		};
+
+		std::vector<FBatchRecord> records;
+		std::vector<uint8> recordData;
+
+		// Only copy the records out under the lock. Formatting runs user formatters, which may be slow or log
+		// themselves, and would hold up threads logging for the first time or exiting.
+		{
+			std::lock_guard<std::mutex> lock(mThreadBuffersLock);
+			for (const std::unique_ptr<FLogThreadBuffer>& buffer : mThreadBuffers)
+			{
+				buffer->Ring.ConsumeAll([&records, &recordData](const uint8* data, size_t size)
+				{
+					FBatchRecord& record = records.emplace_back();
+					std::memcpy(&record.Header, data, sizeof(FLogRecordHeader));
+					record.DataOffset = recordData.size();
+					record.DataSize = size - sizeof(FLogRecordHeader);
+					recordData.insert(recordData.end(), data + sizeof(FLogRecordHeader), data + size);
+				});
+			}
+		}
+
+		std::string formattedMessage;
+
+		const uint64 droppedCount = mDroppedCount.load(std::memory_order_relaxed);
+		if (droppedCount != mReportedDroppedCount)
+		{
+			AppendPrefix(formattedMessage, ELogLevel::Warning, "Log", {}, 0, static_cast<uint32>(::GetCurrentThreadId()), std::chrono::system_clock::now());
+			std::format_to(std::back_inserter(formattedMessage), "{} log messages dropped by the overflow policy.", droppedCount - mReportedDroppedCount);
+			formattedMessage.append(Eol);
+			WriteToSinks(ELogLevel::Warning, "Log", formattedMessage);
+
+			mReportedDroppedCount = droppedCount;
+		}
+
+		// Each buffer is in order already, interleave the threads by time.
+		std::stable_sort(records.begin(), records.end(), [](const FBatchRecord& a, const FBatchRecord& b) { return a.Header.Timestamp < b.Header.Timestamp; });
+
+		for (const FBatchRecord& record : records)
+		{
+			const FLogRecordHeader& header = record.Header;
+			const std::string_view category(header.Category, header.CategoryLength);
+			const std::chrono::system_clock::time_point time{ std::chrono::system_clock::duration(header.Timestamp) };
+
+			formattedMessage.clear();
+			AppendPrefix(formattedMessage, header.Level, category, std::string_view(header.File, header.FileLength), header.Line, header.ThreadId, time);
+
+			// Deferred arguments are formatted here, the strings they hold point into recordData.
+			const uint8* data = recordData.data() + record.DataOffset;
+			if (header.FormatFunc != nullptr)
+			{
+				header.FormatFunc(formattedMessage, std::string_view(header.Format, header.FormatLength), data);
+			}
+			else
+			{
+				formattedMessage.append(reinterpret_cast<const char*>(data), record.DataSize);
+			}
+			formattedMessage.append(Eol);
+
+			WriteToSinks(header.Level, category, formattedMessage);
+		}
+	}
 }
\ No newline at end of file
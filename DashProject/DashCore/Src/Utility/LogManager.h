@@ -4,7 +4,10 @@
 #include "Utility/BitwiseEnum.h"
 #include "Utility/StringUtility.h"
 #include "Utility/Assert.h"
+#include "Utility/LogArguments.h"
 #include <format>
+#include <condition_variable>
+#include <thread>
 
 namespace Dash
 {
@@ -21,6 +24,14 @@ namespace Dash
 
 	ENABLE_BITMASK_OPERATORS(ELogLevel);
 
+	// What a thread does when its asynchronous log buffer is full.
+	enum class ELogOverflowPolicy : uint8
+	{
+		Drop,		// Discard the message.
+		Block,		// Wait for the log thread to make room.
+		Sample,		// Past half full, keep one in GLogSampleInterval messages below Warning, drop the rest.
+	};
+
 	class ILogSink
 	{
 	public:
@@ -54,14 +65,32 @@ namespace Dash
 
 		virtual ~FLogManager() {};
 
-		void Init();
+		/**
+		 * @param bAsync hands messages to a background thread that timestamps, formats and writes them,
+		 *        otherwise the calling thread writes to the sinks.
+		 */
+		void Init(bool bAsync = true, ELogOverflowPolicy overflowPolicy = ELogOverflowPolicy::Drop);
 		void Shutdown();
 
-		template<typename T, typename... TArgs>
-		void Log(ELogLevel level, std::string_view category, std::string_view file, uint32 line, const T& Message, TArgs&&... Args)
-		{
-			DispatchLog(level, category, file, line, Message, std::forward<TArgs>(Args)...);
-		}
+		/**
+		 * Block until every message logged before the call reached the sinks, then flush the sinks.
+		 */
+		void Flush();
+
+		/**
+		 * @returns the number of messages dropped by the overflow policy so far.
+		 */
+		uint64 GetDroppedCount() const { return mDroppedCount.load(std::memory_order_relaxed); }
+
+		/**
+		 * The format string is checked against the arguments at compile time. In async mode, when every argument
+		 * can be deferred (see TLogArgument), the call only copies the arguments and the log thread formats them.
+		 */
+		template<typename... TArgs>
+		void Log(ELogLevel level, std::string_view category, std::string_view file, uint32 line, std::format_string<TArgs...> format, TArgs&&... args);
+
+		template<typename... TArgs>
+		void Log(ELogLevel level, std::string_view category, std::string_view file, uint32 line, std::wformat_string<TArgs...> format, TArgs&&... args);
 
 	private:
 		template<typename... Args>
@@ -85,29 +114,97 @@ namespace Dash
 			return std::wstring(buf.data(), static_cast<size_t>(n));
 		}
 
-		template<typename... TArgs>
-		void DispatchLog(ELogLevel level, std::string_view category, std::string_view file, uint32 line, std::string_view Message, TArgs&&... Args)
-		{
-			//std::string Buffer = string_format(Message.data(), std::forward<TArgs>(Args)...);
-			std::string buffer = std::vformat(Message, std::make_format_args(Args...));
-			Write(level, category, file, line, buffer);
-		}
+		void Write(ELogLevel level, std::string_view category, std::string_view file, uint32 line, std::string_view log);
 
-		template<typename... TArgs>
-		void DispatchLog(ELogLevel level, std::string_view category, std::string_view file, uint32 line, std::wstring_view Message, TArgs&&... Args)
-		{
-			//std::wstring WideBuffer = wstring_format(Message.data(), std::forward<TArgs>(Args)...);
-			std::wstring wideBuffer = std::vformat(Message, std::make_wformat_args(Args...));
-			std::string	buffer = FStringUtility::WideStringToUTF8(wideBuffer);
-			Write(level, category, file, line, buffer);
-		}
+		struct FLogThreadBuffer;
 
-		void Write(ELogLevel level, std::string_view category, std::string_view file, uint32 line, std::string_view log);
+		// Category and file are stored as views, they must outlive the log thread, which DASH_LOG guarantees.
+		void WriteAsync(ELogLevel level, std::string_view category, std::string_view file, uint32 line, std::string_view log);
+		void WriteToSinks(ELogLevel level, std::string_view category, const std::string& log);
+
+		// Deferred records: BeginDeferred returns where argumentsSize bytes of encoded arguments go, or nullptr if
+		// the message was dropped. EndDeferred publishes the record.
+		uint8* BeginDeferred(ELogLevel level, std::string_view category, std::string_view file, uint32 line, std::string_view format,
+			FLogFormatFunc formatFunc, size_t argumentsSize);
+		void EndDeferred();
+
+		/**
+		 * Largest argumentsSize BeginDeferred accepts, larger messages are formatted at the call site.
+		 */
+		size_t GetMaxDeferredSize();
+
+		// Reserves size bytes in the calling thread's buffer, or returns nullptr, according to the overflow policy.
+		uint8* ReserveRecord(FLogThreadBuffer& buffer, ELogLevel level, size_t size);
+		void CommitRecord(FLogThreadBuffer& buffer);
+
+		FLogThreadBuffer& GetThreadBuffer();
+		void ReleaseThreadBuffer(FLogThreadBuffer* buffer);
+		void WakeLogThread();
+
+		void LogThreadMain();
+		void DrainThreadBuffers();
+
+		friend struct FLogThreadHandle;
 
 	private:
 		std::vector<ILogSink*> mLogSinks;
+
+		std::atomic<bool> mAsync{ false };
+		ELogOverflowPolicy mOverflowPolicy = ELogOverflowPolicy::Drop;
+		std::atomic<uint64> mDroppedCount{ 0 };
+
+		// One buffer per logging thread, taken over by a new thread once its owner exits.
+		std::mutex mThreadBuffersLock;
+		std::vector<std::unique_ptr<FLogThreadBuffer>> mThreadBuffers;
+
+		std::thread mLogThread;
+		std::mutex mLogThreadLock;
+		std::condition_variable mWakeCondition;
+		std::condition_variable mFlushedCondition;
+		bool mStopLogThread = false;
+		uint64 mFlushRequested = 0;
+		uint64 mFlushCompleted = 0;
+
+		// Only touched by the log thread.
+		uint64 mReportedDroppedCount = 0;
 	};
 
+	// Member Function
+
+	// --Implementation-- //
+
+	template<typename... TArgs>
+	void FLogManager::Log(ELogLevel level, std::string_view category, std::string_view file, uint32 line, std::format_string<TArgs...> format, TArgs&&... args)
+	{
+		if constexpr (TLogArgumentsDeferrable<std::remove_cvref_t<TArgs>...>)
+		{
+			// Fatal messages are formatted right away, they are flushed and followed by a break anyway.
+			if (mAsync.load(std::memory_order_acquire) && !EnumMaskContains(level, ELogLevel::Fatal))
+			{
+				const size_t argumentsSize = (TLogArgument<std::remove_cvref_t<TArgs>>::GetSize(args) + ... + 0);
+				if (argumentsSize <= GetMaxDeferredSize())
+				{
+					uint8* arguments = BeginDeferred(level, category, file, line, format.get(), &FormatLogArguments<std::remove_cvref_t<TArgs>...>, argumentsSize);
+					if (arguments != nullptr)
+					{
+						((arguments = TLogArgument<std::remove_cvref_t<TArgs>>::Encode(arguments, args)), ...);
+						EndDeferred();
+					}
+					return;
+				}
+			}
+		}
+
+		Write(level, category, file, line, std::vformat(format.get(), std::make_format_args(args...)));
+	}
+
+	template<typename... TArgs>
+	void FLogManager::Log(ELogLevel level, std::string_view category, std::string_view file, uint32 line, std::wformat_string<TArgs...> format, TArgs&&... args)
+	{
+		std::wstring wideBuffer = std::vformat(format.get(), std::make_wformat_args(args...));
+		Write(level, category, file, line, FStringUtility::WideStringToUTF8(wideBuffer));
+	}
+
 	#define LOG_CONCATENATE(a, b) a##b
 
 	#define DECLARE_LOG_CATEGORY(Name, Level)					\
@@ -0,0 +1,683 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "CacheLine.h"
+
+namespace Dash
+{
+	// Lock-free multi producer multi consumer queues.
+	//
+	//   TMPMCBoundedQueue   fixed capacity ring (Vyukov), every cell carries a sequence number that tells
+	//                       producers and consumers whose turn it is. TryPush fails when the ring is full.
+	//   TMPMCQueue          unbounded, a linked list of fixed size segments. Producers and consumers claim slots
+	//                       with a fetch_add on the segment indices, a consumer that overtakes a producer marks the
+	//                       slot as taken and the producer moves on to the next one. Drained segments are retired
+	//                       and freed the next time no other operation is in flight.
+	//
+	// Both pop by moving the value out, so move-only types work. The indices of each queue live on separate
+	// cache lines so producers and consumers do not invalidate each other.
+
+	template<typename T>
+	class TMPMCBoundedQueue
+	{
+	public:
+		/**
+		 * @param capacity is rounded up to a power of two.
+		 */
+		explicit TMPMCBoundedQueue(size_t capacity);
+		~TMPMCBoundedQueue();
+
+		TMPMCBoundedQueue(const TMPMCBoundedQueue&) = delete;
+		TMPMCBoundedQueue& operator=(const TMPMCBoundedQueue&) = delete;
+
+		/**
+		 * Try to push a value into the back of the queue, the value is only moved from on success.
+		 * @returns false if the queue is full.
+		 */
+		bool TryPush(T&& value);
+		bool TryPush(const T& value);
+
+		/**
+		 * Try to pop a value from the front of the queue.
+		 * @returns false if the queue is empty.
+		 */
+		bool TryPop(T& value);
+
+		/**
+		 * Push up to count values with one index update, values are moved from in order.
+		 * @returns the number of values pushed, less than count if the queue filled up.
+		 */
+		size_t PushBulk(T* values, size_t count);
+
+		/**
+		 * Pop up to maxCount values with one index update.
+		 * @returns the number of values written to values.
+		 */
+		size_t PopBulk(T* values, size_t maxCount);
+
+		/**
+		 * Approximate, other threads may change the queue at any time.
+		 */
+		size_t Size() const;
+		bool Empty() const { return Size() == 0; }
+
+		size_t Capacity() const { return mMask + 1; }
+
+	private:
+		struct FCell
+		{
+			std::atomic<size_t> Sequence;
+			alignas(T) unsigned char Storage[sizeof(T)];
+
+			T* Value() { return std::launder(reinterpret_cast<T*>(Storage)); }
+		};
+
+		template<typename U>
+		bool Emplace(U&& value);
+
+	private:
+		alignas(GCacheLineSize) std::atomic<size_t> mEnqueuePos;
+		alignas(GCacheLineSize) std::atomic<size_t> mDequeuePos;
+		alignas(GCacheLineSize) std::unique_ptr<FCell[]> mCells;
+		size_t mMask;
+	};
+
+	template<typename T, size_t SegmentSize = 1024>
+	class TMPMCQueue
+	{
+	public:
+		TMPMCQueue();
+		~TMPMCQueue();
+
+		TMPMCQueue(const TMPMCQueue&) = delete;
+		TMPMCQueue& operator=(const TMPMCQueue&) = delete;
+
+		/**
+		 * Push a value into the back of the queue.
+		 */
+		void Push(T value);
+
+		/**
+		 * Try to pop a value from the front of the queue.
+		 * @returns false if the queue is empty.
+		 */
+		bool TryPop(T& value);
+
+		/**
+		 * Push count values, values are moved from in order.
+		 */
+		void PushBulk(T* values, size_t count);
+
+		/**
+		 * Pop up to maxCount values.
+		 * @returns the number of values written to values.
+		 */
+		size_t PopBulk(T* values, size_t maxCount);
+
+		/**
+		 * Approximate, other threads may change the queue at any time.
+		 */
+		bool Empty() const;
+
+	private:
+		enum class ESlotState : uint32
+		{
+			Empty,
+			Ready,
+			Taken,
+		};
+
+		struct FSlot
+		{
+			std::atomic<ESlotState> State{ ESlotState::Empty };
+			alignas(T) unsigned char Storage[sizeof(T)];
+
+			T* Value() { return std::launder(reinterpret_cast<T*>(Storage)); }
+		};
+
+		struct FSegment
+		{
+			alignas(GCacheLineSize) std::atomic<size_t> EnqueueIndex{ 0 };
+			alignas(GCacheLineSize) std::atomic<size_t> DequeueIndex{ 0 };
+			alignas(GCacheLineSize) std::atomic<FSegment*> Next{ nullptr };
+			FSegment* RetiredNext = nullptr;
+			FSlot Slots[SegmentSize];
+		};
+
+		// Counts the operations in flight, a retired segment can only be freed when no one else may still hold it.
+		struct FOperationScope
+		{
+			FOperationScope(const TMPMCQueue& queue) : Queue(queue) { Queue.mActiveOperations.fetch_add(1); }
+			~FOperationScope() { Queue.EndOperation(); }
+
+			const TMPMCQueue& Queue;
+		};
+
+		void PushInternal(T& value);
+		bool TryPopInternal(T& value);
+
+		void Retire(FSegment* segment);
+		void EndOperation() const;
+		void DestroySegment(FSegment* segment);
+
+	private:
+		alignas(GCacheLineSize) std::atomic<FSegment*> mHead;
+		alignas(GCacheLineSize) std::atomic<FSegment*> mTail;
+		alignas(GCacheLineSize) mutable std::atomic<uint32> mActiveOperations{ 0 };
+		mutable std::atomic<FSegment*> mRetired{ nullptr };
+	};
+
+	// Member Function
+
+	// --Implementation-- //
+
+	template<typename T>
+	TMPMCBoundedQueue<T>::TMPMCBoundedQueue(size_t capacity)
+		: mEnqueuePos(0)
+		, mDequeuePos(0)
+	{
+		size_t roundedCapacity = 2;
+		while (roundedCapacity < capacity)
+		{
+			roundedCapacity <<= 1;
+		}
+
+		mMask = roundedCapacity - 1;
+		mCells.reset(new FCell[roundedCapacity]);
+		for (size_t i = 0; i < roundedCapacity; ++i)
+		{
+			mCells[i].Sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	template<typename T>
+	TMPMCBoundedQueue<T>::~TMPMCBoundedQueue()
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			const size_t enqueuePos = mEnqueuePos.load();
+			for (size_t pos = mDequeuePos.load(); pos != enqueuePos; ++pos)
+			{
+				mCells[pos & mMask].Value()->~T();
+			}
+		}
+	}
+
+	template<typename T>
+	bool TMPMCBoundedQueue<T>::TryPush(T&& value)
+	{
+		return Emplace(std::move(value));
+	}
+
+	template<typename T>
+	bool TMPMCBoundedQueue<T>::TryPush(const T& value)
+	{
+		return Emplace(value);
+	}
+
+	template<typename T>
+	template<typename U>
+	bool TMPMCBoundedQueue<T>::Emplace(U&& value)
+	{
+		size_t pos = mEnqueuePos.load(std::memory_order_relaxed);
+		FCell* cell;
+		for (;;)
+		{
+			cell = &mCells[pos & mMask];
+			const size_t sequence = cell->Sequence.load(std::memory_order_acquire);
+			const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+			if (diff == 0)
+			{
+				if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				pos = mEnqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+
+		new (cell->Storage) T(std::forward<U>(value));
+		cell->Sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	template<typename T>
+	bool TMPMCBoundedQueue<T>::TryPop(T& value)
+	{
+		size_t pos = mDequeuePos.load(std::memory_order_relaxed);
+		FCell* cell;
+		for (;;)
+		{
+			cell = &mCells[pos & mMask];
+			const size_t sequence = cell->Sequence.load(std::memory_order_acquire);
+			const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+			if (diff == 0)
+			{
+				if (mDequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				pos = mDequeuePos.load(std::memory_order_relaxed);
+			}
+		}
+
+		value = std::move(*cell->Value());
+		cell->Value()->~T();
+		cell->Sequence.store(pos + mMask + 1, std::memory_order_release);
+		return true;
+	}
+
+	template<typename T>
+	size_t TMPMCBoundedQueue<T>::PushBulk(T* values, size_t count)
+	{
+		size_t pos = mEnqueuePos.load(std::memory_order_relaxed);
+		size_t claimed = 0;
+		while (count > 0)
+		{
+			// Every cell of the range has to be free for this lap, the first busy cell ends the batch.
+			claimed = 0;
+			intptr_t firstDiff = 0;
+			while (claimed < count)
+			{
+				const size_t sequence = mCells[(pos + claimed) & mMask].Sequence.load(std::memory_order_acquire);
+				const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + claimed);
+				if (claimed == 0)
+				{
+					firstDiff = diff;
+				}
+				if (diff != 0)
+				{
+					break;
+				}
+				++claimed;
+			}
+
+			if (claimed == 0)
+			{
+				if (firstDiff < 0)
+				{
+					return 0;
+				}
+				pos = mEnqueuePos.load(std::memory_order_relaxed);
+				continue;
+			}
+
+			if (mEnqueuePos.compare_exchange_weak(pos, pos + claimed, std::memory_order_relaxed))
+			{
+				break;
+			}
+		}
+
+		for (size_t i = 0; i < claimed; ++i)
+		{
+			FCell& cell = mCells[(pos + i) & mMask];
+			new (cell.Storage) T(std::move(values[i]));
+			cell.Sequence.store(pos + i + 1, std::memory_order_release);
+		}
+
+		return claimed;
+	}
+
+	template<typename T>
+	size_t TMPMCBoundedQueue<T>::PopBulk(T* values, size_t maxCount)
+	{
+		size_t pos = mDequeuePos.load(std::memory_order_relaxed);
+		size_t claimed = 0;
+		while (maxCount > 0)
+		{
+			claimed = 0;
+			intptr_t firstDiff = 0;
+			while (claimed < maxCount)
+			{
+				const size_t sequence = mCells[(pos + claimed) & mMask].Sequence.load(std::memory_order_acquire);
+				const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + claimed + 1);
+				if (claimed == 0)
+				{
+					firstDiff = diff;
+				}
+				if (diff != 0)
+				{
+					break;
+				}
+				++claimed;
+			}
+
+			if (claimed == 0)
+			{
+				if (firstDiff < 0)
+				{
+					return 0;
+				}
+				pos = mDequeuePos.load(std::memory_order_relaxed);
+				continue;
+			}
+
+			if (mDequeuePos.compare_exchange_weak(pos, pos + claimed, std::memory_order_relaxed))
+			{
+				break;
+			}
+		}
+
+		for (size_t i = 0; i < claimed; ++i)
+		{
+			FCell& cell = mCells[(pos + i) & mMask];
+			values[i] = std::move(*cell.Value());
+			cell.Value()->~T();
+			cell.Sequence.store(pos + i + mMask + 1, std::memory_order_release);
+		}
+
+		return claimed;
+	}
+
+	template<typename T>
+	size_t TMPMCBoundedQueue<T>::Size() const
+	{
+		const size_t dequeuePos = mDequeuePos.load(std::memory_order_relaxed);
+		const size_t enqueuePos = mEnqueuePos.load(std::memory_order_relaxed);
+		return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+	}
+
+	template<typename T, size_t SegmentSize>
+	TMPMCQueue<T, SegmentSize>::TMPMCQueue()
+	{
+		FSegment* segment = new FSegment();
+		mHead.store(segment);
+		mTail.store(segment);
+	}
+
+	template<typename T, size_t SegmentSize>
+	TMPMCQueue<T, SegmentSize>::~TMPMCQueue()
+	{
+		FSegment* segment = mHead.load();
+		while (segment != nullptr)
+		{
+			FSegment* next = segment->Next.load();
+			DestroySegment(segment);
+			segment = next;
+		}
+
+		segment = mRetired.load();
+		while (segment != nullptr)
+		{
+			FSegment* next = segment->RetiredNext;
+			delete segment;
+			segment = next;
+		}
+	}
+
+	template<typename T, size_t SegmentSize>
+	void TMPMCQueue<T, SegmentSize>::Push(T value)
+	{
+		FOperationScope scope(*this);
+		PushInternal(value);
+	}
+
+	template<typename T, size_t SegmentSize>
+	bool TMPMCQueue<T, SegmentSize>::TryPop(T& value)
+	{
+		FOperationScope scope(*this);
+		return TryPopInternal(value);
+	}
+
+	template<typename T, size_t SegmentSize>
+	void TMPMCQueue<T, SegmentSize>::PushBulk(T* values, size_t count)
+	{
+		FOperationScope scope(*this);
+
+		size_t pushed = 0;
+		while (pushed < count)
+		{
+			// Claim the whole range with one fetch_add, slots a consumer gave up on are skipped.
+			FSegment* tail = mTail.load();
+			const size_t claimCount = count - pushed;
+			const size_t index = tail->EnqueueIndex.fetch_add(claimCount);
+			const size_t end = std::min(index + claimCount, SegmentSize);
+			for (size_t slotIndex = index; slotIndex < end; ++slotIndex)
+			{
+				FSlot& slot = tail->Slots[slotIndex];
+				new (slot.Storage) T(std::move(values[pushed]));
+
+				ESlotState expected = ESlotState::Empty;
+				if (slot.State.compare_exchange_strong(expected, ESlotState::Ready, std::memory_order_release, std::memory_order_relaxed))
+				{
+					++pushed;
+				}
+				else
+				{
+					values[pushed] = std::move(*slot.Value());
+					slot.Value()->~T();
+				}
+			}
+
+			// The segment filled up, the single push moves on to the next one.
+			if (index + claimCount > SegmentSize && pushed < count)
+			{
+				PushInternal(values[pushed]);
+				++pushed;
+			}
+		}
+	}
+
+	template<typename T, size_t SegmentSize>
+	size_t TMPMCQueue<T, SegmentSize>::PopBulk(T* values, size_t maxCount)
+	{
+		FOperationScope scope(*this);
+
+		size_t count = 0;
+		while (count < maxCount)
+		{
+			FSegment* head = mHead.load();
+			const size_t dequeueIndex = head->DequeueIndex.load();
+			const size_t enqueueIndex = std::min(head->EnqueueIndex.load(), SegmentSize);
+			if (dequeueIndex < enqueueIndex)
+			{
+				const size_t claimCount = std::min(maxCount - count, enqueueIndex - dequeueIndex);
+				const size_t index = head->DequeueIndex.fetch_add(claimCount);
+				const size_t end = std::min(index + claimCount, SegmentSize);
+				for (size_t slotIndex = index; slotIndex < end; ++slotIndex)
+				{
+					FSlot& slot = head->Slots[slotIndex];
+					if (slot.State.exchange(ESlotState::Taken, std::memory_order_acquire) == ESlotState::Ready)
+					{
+						values[count++] = std::move(*slot.Value());
+						slot.Value()->~T();
+					}
+				}
+				continue;
+			}
+
+			// Nothing claimable in the head segment, the single pop handles moving to the next one.
+			if (!TryPopInternal(values[count]))
+			{
+				break;
+			}
+			++count;
+		}
+		return count;
+	}
+
+	template<typename T, size_t SegmentSize>
+	bool TMPMCQueue<T, SegmentSize>::Empty() const
+	{
+		FOperationScope scope(*this);
+		const FSegment* head = mHead.load();
+		return head->DequeueIndex.load() >= head->EnqueueIndex.load() && head->Next.load() == nullptr;
+	}
+
+	template<typename T, size_t SegmentSize>
+	void TMPMCQueue<T, SegmentSize>::PushInternal(T& value)
+	{
+		for (;;)
+		{
+			FSegment* tail = mTail.load();
+			const size_t index = tail->EnqueueIndex.fetch_add(1);
+			if (index < SegmentSize)
+			{
+				FSlot& slot = tail->Slots[index];
+				new (slot.Storage) T(std::move(value));
+
+				ESlotState expected = ESlotState::Empty;
+				if (slot.State.compare_exchange_strong(expected, ESlotState::Ready, std::memory_order_release, std::memory_order_relaxed))
+				{
+					return;
+				}
+
+				// A consumer overtook us and gave up on this slot, take the value back and try the next one.
+				value = std::move(*slot.Value());
+				slot.Value()->~T();
+				continue;
+			}
+
+			FSegment* next = tail->Next.load();
+			if (next == nullptr)
+			{
+				// The segment is full, publish a new one with the value already in its first slot.
+				FSegment* segment = new FSegment();
+				segment->EnqueueIndex.store(1, std::memory_order_relaxed);
+				new (segment->Slots[0].Storage) T(std::move(value));
+				segment->Slots[0].State.store(ESlotState::Ready, std::memory_order_relaxed);
+
+				if (tail->Next.compare_exchange_strong(next, segment))
+				{
+					mTail.compare_exchange_strong(tail, segment);
+					return;
+				}
+
+				value = std::move(*segment->Slots[0].Value());
+				segment->Slots[0].Value()->~T();
+				delete segment;
+			}
+
+			mTail.compare_exchange_strong(tail, next);
+		}
+	}
+
+	template<typename T, size_t SegmentSize>
+	bool TMPMCQueue<T, SegmentSize>::TryPopInternal(T& value)
+	{
+		for (;;)
+		{
+			FSegment* head = mHead.load();
+			if (head->DequeueIndex.load() >= head->EnqueueIndex.load() && head->Next.load() == nullptr)
+			{
+				return false;
+			}
+
+			const size_t index = head->DequeueIndex.fetch_add(1);
+			if (index < SegmentSize)
+			{
+				FSlot& slot = head->Slots[index];
+				if (slot.State.exchange(ESlotState::Taken, std::memory_order_acquire) == ESlotState::Ready)
+				{
+					value = std::move(*slot.Value());
+					slot.Value()->~T();
+					return true;
+				}
+
+				// The producer of this slot has not published yet, it will retry with another slot.
+				continue;
+			}
+
+			FSegment* next = head->Next.load();
+			if (next == nullptr)
+			{
+				return false;
+			}
+
+			if (mHead.compare_exchange_strong(head, next))
+			{
+				// Producers must not find the retired segment through the tail either.
+				FSegment* tail = head;
+				mTail.compare_exchange_strong(tail, next);
+				Retire(head);
+			}
+		}
+	}
+
+	template<typename T, size_t SegmentSize>
+	void TMPMCQueue<T, SegmentSize>::Retire(FSegment* segment)
+	{
+		FSegment* retired = mRetired.load();
+		do
+		{
+			segment->RetiredNext = retired;
+		} while (!mRetired.compare_exchange_weak(retired, segment));
+	}
+
+	template<typename T, size_t SegmentSize>
+	void TMPMCQueue<T, SegmentSize>::EndOperation() const
+	{
+		if (mRetired.load(std::memory_order_relaxed) != nullptr)
+		{
+			FSegment* retired = mRetired.exchange(nullptr);
+			if (retired != nullptr)
+			{
+				if (mActiveOperations.load() == 1)
+				{
+					// Retired segments are unlinked from head and tail, any thread still holding one
+					// started its operation before the unlink and would be counted here.
+					while (retired != nullptr)
+					{
+						FSegment* next = retired->RetiredNext;
+						delete retired;
+						retired = next;
+					}
+				}
+				else
+				{
+					FSegment* last = retired;
+					while (last->RetiredNext != nullptr)
+					{
+						last = last->RetiredNext;
+					}
+
+					FSegment* current = mRetired.load();
+					do
+					{
+						last->RetiredNext = current;
+					} while (!mRetired.compare_exchange_weak(current, retired));
+				}
+			}
+		}
+
+		mActiveOperations.fetch_sub(1);
+	}
+
+	template<typename T, size_t SegmentSize>
+	void TMPMCQueue<T, SegmentSize>::DestroySegment(FSegment* segment)
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			const size_t count = std::min(segment->EnqueueIndex.load(), SegmentSize);
+			for (size_t i = 0; i < count; ++i)
+			{
+				if (segment->Slots[i].State.load() == ESlotState::Ready)
+				{
+					segment->Slots[i].Value()->~T();
+				}
+			}
+		}
+
+		delete segment;
+	}
+}
@@ -0,0 +1,238 @@
+#include "PCH.h"
+#include "Name.h"
+#include "FlatHashMap.h"
+
+namespace Dash
+{
+	namespace
+	{
+		struct FNameEntry
+		{
+			uint64 Hash;
+			uint32 NoCaseIndex;
+			uint32 Length;
+			char Data[1];	// Length characters and a null terminator.
+
+			std::string_view ToStringView() const { return std::string_view(Data, Length); }
+		};
+
+		// Up to GNameChunkCount * GNameChunkSize names.
+		constexpr uint32 GNameChunkSize = 4096;
+		constexpr uint32 GNameChunkCount = 1024;
+
+		constexpr size_t GNameBlockSize = 64 * 1024;
+		constexpr uint32 GNameInitialSlots = 4096;
+
+		std::string ToLowerAscii(std::string_view name)
+		{
+			std::string lower(name);
+			for (char& character : lower)
+			{
+				if (character >= 'A' && character <= 'Z')
+				{
+					character = static_cast<char>(character - 'A' + 'a');
+				}
+			}
+			return lower;
+		}
+
+		// Open addressing table of name indices next to append only entry storage.
+		//
+		// A slot packs the upper half of the hash with the index, so a probe only reads an entry when the hash matches.
+		// Slots are filled once and never cleared, and a grown table is published as a whole while the old one stays
+		// alive, so readers probe without a lock. Whoever misses takes the lock, probes the current table again and adds.
+		class FNameTable
+		{
+		public:
+			static FNameTable& Get()
+			{
+				static FNameTable table;
+				return table;
+			}
+
+			uint32 FindOrAdd(std::string_view name, bool bAdd)
+			{
+				const uint64 hash = Hash64(name.data(), name.size());
+
+				uint32 index = Find(*mSlots.load(std::memory_order_acquire), name, hash);
+				if (index != 0 || !bAdd)
+				{
+					return index;
+				}
+
+				std::lock_guard<std::mutex> lock(mLock);
+
+				FSlotTable& slots = *mSlots.load(std::memory_order_relaxed);
+				index = Find(slots, name, hash);
+				if (index != 0)
+				{
+					return index;
+				}
+
+				index = AddEntry(name, hash);
+				Insert(slots, hash, index);
+
+				if (mNumEntries * 2 > slots.Capacity)
+				{
+					Grow();
+				}
+
+				return index;
+			}
+
+			const FNameEntry& GetEntry(uint32 index) const
+			{
+				return *mChunks[index / GNameChunkSize][index % GNameChunkSize];
+			}
+
+		private:
+			struct FSlotTable
+			{
+				explicit FSlotTable(uint32 capacity)
+					: Capacity(capacity)
+					, Slots(new std::atomic<uint64>[capacity])
+				{
+					for (uint32 slotIndex = 0; slotIndex < capacity; ++slotIndex)
+					{
+						Slots[slotIndex].store(0, std::memory_order_relaxed);
+					}
+				}
+
+				uint32 Capacity;
+				std::unique_ptr<std::atomic<uint64>[]> Slots;
+			};
+
+			FNameTable()
+			{
+				mSlotTables.push_back(std::make_unique<FSlotTable>(GNameInitialSlots));
+				mSlots.store(mSlotTables.back().get(), std::memory_order_release);
+
+				// Index 0 is None.
+				AddEntry("", Hash64("", 0));
+			}
+
+			static uint64 PackSlot(uint64 hash, uint32 index) { return (hash & 0xFFFFFFFF00000000ull) | index; }
+
+			uint32 Find(const FSlotTable& slots, std::string_view name, uint64 hash) const
+			{
+				const uint32 mask = slots.Capacity - 1;
+				for (uint32 slotIndex = static_cast<uint32>(hash) & mask; ; slotIndex = (slotIndex + 1) & mask)
+				{
+					const uint64 slot = slots.Slots[slotIndex].load(std::memory_order_acquire);
+					if (slot == 0)
+					{
+						return 0;
+					}
+
+					const uint32 index = static_cast<uint32>(slot);
+					if ((slot ^ hash) >> 32 == 0 && GetEntry(index).ToStringView() == name)
+					{
+						return index;
+					}
+				}
+			}
+
+			static void Insert(FSlotTable& slots, uint64 hash, uint32 index)
+			{
+				const uint32 mask = slots.Capacity - 1;
+				uint32 slotIndex = static_cast<uint32>(hash) & mask;
+				while (slots.Slots[slotIndex].load(std::memory_order_relaxed) != 0)
+				{
+					slotIndex = (slotIndex + 1) & mask;
+				}
+
+				slots.Slots[slotIndex].store(PackSlot(hash, index), std::memory_order_release);
+			}
+
+			void Grow()
+			{
+				const FSlotTable& oldSlots = *mSlotTables.back();
+				mSlotTables.push_back(std::make_unique<FSlotTable>(oldSlots.Capacity * 2));
+				FSlotTable& newSlots = *mSlotTables.back();
+
+				for (uint32 index = 1; index < mNumEntries; ++index)
+				{
+					Insert(newSlots, GetEntry(index).Hash, index);
+				}
+
+				// Old tables stay alive, a reader may still be probing them.
+				mSlots.store(&newSlots, std::memory_order_release);
+			}
+
+			uint32 AddEntry(std::string_view name, uint64 hash)
+			{
+				const uint32 index = mNumEntries++;
+				ASSERT_MSG(index < GNameChunkSize * GNameChunkCount, "Name table is full.");
+
+				const size_t entrySize = (offsetof(FNameEntry, Data) + name.size() + 1 + alignof(FNameEntry) - 1) & ~(alignof(FNameEntry) - 1);
+				if (mBlocks.empty() || mBlockOffset + entrySize > mBlockSize)
+				{
+					mBlockSize = std::max(GNameBlockSize, entrySize);
+					mBlocks.emplace_back(new uint8[mBlockSize]);
+					mBlockOffset = 0;
+				}
+
+				FNameEntry* entry = reinterpret_cast<FNameEntry*>(mBlocks.back().get() + mBlockOffset);
+				mBlockOffset += entrySize;
+
+				entry->Hash = hash;
+				entry->Length = static_cast<uint32>(name.size());
+				std::memcpy(entry->Data, name.data(), name.size());
+				entry->Data[name.size()] = '\0';
+
+				auto noCaseIter = mNoCaseIndices.try_emplace(ToLowerAscii(name), index).first;
+				entry->NoCaseIndex = noCaseIter->second;
+
+				std::unique_ptr<const FNameEntry*[]>& chunk = mChunks[index / GNameChunkSize];
+				if (chunk == nullptr)
+				{
+					chunk.reset(new const FNameEntry*[GNameChunkSize]);
+				}
+				chunk[index % GNameChunkSize] = entry;
+
+				return index;
+			}
+
+		private:
+			std::atomic<FSlotTable*> mSlots{ nullptr };
+
+			// Every table ever published, the last one is current.
+			std::vector<std::unique_ptr<FSlotTable>> mSlotTables;
+
+			std::unique_ptr<const FNameEntry*[]> mChunks[GNameChunkCount];
+
+			// Everything below is only touched under mLock.
+			std::mutex mLock;
+			uint32 mNumEntries = 0;
+
+			std::vector<std::unique_ptr<uint8[]>> mBlocks;
+			size_t mBlockSize = 0;
+			size_t mBlockOffset = 0;
+
+			// Lower case string to the index of its first spelling.
+			TFlatHashMap<std::string, uint32> mNoCaseIndices;
+		};
+	}
+
+	FName::FName(std::string_view name)
+		: mIndex(name.empty() ? 0 : FNameTable::Get().FindOrAdd(name, true))
+	{
+	}
+
+	FName FName::Find(std::string_view name)
+	{
+		FName result;
+		result.mIndex = name.empty() ? 0 : FNameTable::Get().FindOrAdd(name, false);
+		return result;
+	}
+
+	std::string_view FName::ToStringView() const
+	{
+		return FNameTable::Get().GetEntry(mIndex).ToStringView();
+	}
+
+	uint32 FName::GetNoCaseIndex() const
+	{
+		return FNameTable::Get().GetEntry(mIndex).NoCaseIndex;
+	}
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <format>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include "Hash.h"
+
+namespace Dash
+{
+	// Interned string, 4 bytes: an index into the global name table.
+	//
+	// Equal strings share one index, so copying, comparing and hashing a name never touches the characters.
+	// Interned strings live until the process exits. Looking up a string that is already in the table takes no
+	// lock, adding a new one takes the table lock, so build names once at load time rather than every frame.
+	class FName
+	{
+	public:
+		FName() = default;
+		FName(std::string_view name);
+		FName(const std::string& name) : FName(std::string_view(name)) {}
+		FName(const char* name) : FName(std::string_view(name)) {}
+
+		/**
+		 * Look a string up without adding it to the table.
+		 * @returns None if the string was never interned.
+		 */
+		static FName Find(std::string_view name);
+
+		uint32 GetIndex() const { return mIndex; }
+
+		/**
+		 * None is the empty string.
+		 */
+		bool IsNone() const { return mIndex == 0; }
+
+		std::string_view ToStringView() const;
+		std::string ToString() const { return std::string(ToStringView()); }
+
+		/**
+		 * @returns the interned characters, null terminated.
+		 */
+		const char* GetCString() const { return ToStringView().data(); }
+
+		/**
+		 * Index shared by all names that only differ in ASCII case, the index of the first of them that was interned.
+		 */
+		uint32 GetNoCaseIndex() const;
+
+		bool EqualsNoCase(FName other) const { return mIndex == other.mIndex || GetNoCaseIndex() == other.GetNoCaseIndex(); }
+
+		bool operator==(const FName& other) const = default;
+
+		// Orders by index: fast and stable for the run, but not alphabetical, see FNameLexicalLess.
+		bool operator<(const FName& other) const { return mIndex < other.mIndex; }
+
+	private:
+		uint32 mIndex = 0;
+	};
+
+	struct FNameLexicalLess
+	{
+		bool operator()(FName a, FName b) const { return a.ToStringView() < b.ToStringView(); }
+	};
+
+	// Hash and equality for containers whose name keys ignore case.
+	struct FNameNoCaseHash
+	{
+		uint64 operator()(FName name) const { return HashMix(name.GetNoCaseIndex(), 0x9E3779B97F4A7C15ull); }
+	};
+
+	struct FNameNoCaseEqual
+	{
+		bool operator()(FName a, FName b) const { return a.EqualsNoCase(b); }
+	};
+}
+
+template<>
+struct std::hash<Dash::FName>
+{
+	size_t operator()(Dash::FName name) const noexcept { return name.GetIndex(); }
+};
+
+template<>
+struct std::formatter<Dash::FName> : std::formatter<std::string_view>
+{
+	auto format(Dash::FName name, std::format_context& context) const
+	{
+		return std::formatter<std::string_view>::format(name.ToStringView(), context);
+	}
+};
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace Dash
+{
+	// Refers to an object in a TObjectPool. The generation changes every time the slot is freed,
+	// so a handle to a destroyed object stays detectably stale after the slot is reused.
+	template<typename T>
+	struct TObjectHandle
+	{
+		uint32 Index = UINT32_MAX;
+		uint32 Generation = 0;
+
+		bool IsValid() const { return Generation != 0; }
+
+		bool operator==(const TObjectHandle& other) const = default;
+	};
+
+	// Pool of objects of one type, allocated in fixed size slabs.
+	//
+	// Objects never move, so pointers stay valid until the object is destroyed. Freed slots are reused
+	// most recent first, and ForEach visits the live objects in slab order, which is memory order.
+	// Not thread safe.
+	template<typename T, size_t SlabSize = 64>
+	class TObjectPool
+	{
+	public:
+		using FHandle = TObjectHandle<T>;
+
+		TObjectPool() = default;
+		~TObjectPool();
+
+		TObjectPool(const TObjectPool&) = delete;
+		TObjectPool& operator=(const TObjectPool&) = delete;
+
+		template<typename... ArgTypes>
+		FHandle Create(ArgTypes&&... args);
+
+		/**
+		 * Destroy the object, stale handles are ignored.
+		 */
+		void Destroy(FHandle handle);
+
+		/**
+		 * @returns nullptr if the handle is stale.
+		 */
+		T* Get(FHandle handle) const;
+
+		/**
+		 * @returns the handle of an object that lives in this pool, or an invalid handle.
+		 */
+		FHandle GetHandle(const T* object) const;
+
+		/**
+		 * Call func(T&) for every live object in memory order.
+		 */
+		template<typename FuncType>
+		void ForEach(FuncType&& func);
+
+		size_t GetSize() const { return mSize; }
+		size_t GetCapacity() const { return mGenerations.size(); }
+
+	private:
+		struct FStorage
+		{
+			alignas(T) uint8 Bytes[sizeof(T)];
+		};
+
+		T* GetObject(uint32 index) const
+		{
+			return std::launder(reinterpret_cast<T*>(mSlabs[index / SlabSize][index % SlabSize].Bytes));
+		}
+
+	private:
+		std::vector<std::unique_ptr<FStorage[]>> mSlabs;
+
+		// Per slot, even generations are free, odd ones are alive.
+		std::vector<uint32> mGenerations;
+		std::vector<uint32> mFreeSlots;
+		size_t mSize = 0;
+	};
+
+	// Member Function
+
+	// --Implementation-- //
+
+	template<typename T, size_t SlabSize>
+	TObjectPool<T, SlabSize>::~TObjectPool()
+	{
+		ForEach([](T& object) { object.~T(); });
+	}
+
+	template<typename T, size_t SlabSize>
+	template<typename... ArgTypes>
+	typename TObjectPool<T, SlabSize>::FHandle TObjectPool<T, SlabSize>::Create(ArgTypes&&... args)
+	{
+		if (mFreeSlots.empty())
+		{
+			const uint32 firstIndex = static_cast<uint32>(mGenerations.size());
+			mSlabs.emplace_back(new FStorage[SlabSize]);
+			mGenerations.resize(mGenerations.size() + SlabSize, 0);
+
+			// Reversed, so the slab fills from its first slot.
+			for (uint32 index = firstIndex + SlabSize; index > firstIndex; --index)
+			{
+				mFreeSlots.push_back(index - 1);
+			}
+		}
+
+		const uint32 index = mFreeSlots.back();
+		mFreeSlots.pop_back();
+
+		try
+		{
+			new (mSlabs[index / SlabSize][index % SlabSize].Bytes) T(std::forward<ArgTypes>(args)...);
+		}
+		catch (...)
+		{
+			// The slot stays free, its generation did not change.
+			mFreeSlots.push_back(index);
+			throw;
+		}
+
+		++mGenerations[index];
+		++mSize;
+		return FHandle{ index, mGenerations[index] };
+	}
+
+	template<typename T, size_t SlabSize>
+	void TObjectPool<T, SlabSize>::Destroy(FHandle handle)
+	{
+		if (Get(handle) == nullptr)
+		{
+			return;
+		}
+
+		GetObject(handle.Index)->~T();
+
+		++mGenerations[handle.Index];
+		mFreeSlots.push_back(handle.Index);
+		--mSize;
+	}
+
+	template<typename T, size_t SlabSize>
+	T* TObjectPool<T, SlabSize>::Get(FHandle handle) const
+	{
+		if (handle.Index >= mGenerations.size() || mGenerations[handle.Index] != handle.Generation || (handle.Generation & 1) == 0)
+		{
+			return nullptr;
+		}
+
+		return GetObject(handle.Index);
+	}
+
+	template<typename T, size_t SlabSize>
+	typename TObjectPool<T, SlabSize>::FHandle TObjectPool<T, SlabSize>::GetHandle(const T* object) const
+	{
+		const uint8* address = reinterpret_cast<const uint8*>(object);
+		for (size_t slabIndex = 0; slabIndex < mSlabs.size(); ++slabIndex)
+		{
+			const uint8* slabBegin = mSlabs[slabIndex][0].Bytes;
+			if (address >= slabBegin && address < slabBegin + SlabSize * sizeof(FStorage))
+			{
+				const uint32 index = static_cast<uint32>(slabIndex * SlabSize + (address - slabBegin) / sizeof(FStorage));
+				if ((mGenerations[index] & 1) != 0)
+				{
+					return FHandle{ index, mGenerations[index] };
+				}
+				break;
+			}
+		}
+
+		return FHandle{};
+	}
+
+	template<typename T, size_t SlabSize>
+	template<typename FuncType>
+	void TObjectPool<T, SlabSize>::ForEach(FuncType&& func)
+	{
+		const uint32 capacity = static_cast<uint32>(mGenerations.size());
+		for (uint32 index = 0; index < capacity; ++index)
+		{
+			if ((mGenerations[index] & 1) != 0)
+			{
+				func(*GetObject(index));
+			}
+		}
+	}
+}
@@ -0,0 +1,553 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "JobSystem.h"
+
+namespace Dash
+{
+	// Data parallel loops on top of FJobSystem.
+	//
+	// A range is cut into chunks, the calling thread and up to one helper job per worker take chunks from a
+	// shared atomic index until none are left, then the caller waits for the helpers. The helper jobs only
+	// capture a pointer to a context on the caller's stack and the job system reuses its jobs, so a parallel
+	// loop does not allocate. Without a running job system everything runs on the calling thread.
+	//
+	// ParallelFor sizes its chunks from the worker count. ParallelReduce and the scans size them from the
+	// element count and the grain size only, and combine the chunk results in chunk order, so the result of a
+	// non-associative operation, like a float sum, does not change with the number of threads.
+	//
+	// Spans of math types, e.g. std::span<FVector3f> or std::span<FAffineMatrix3x4>, work directly.
+
+	// Most chunks of a deterministic algorithm, the chunk results live in a fixed array on the stack.
+	constexpr size_t GParallelMaxChunks = 64;
+
+	// Default grain size of the deterministic algorithms, in elements.
+	constexpr size_t GParallelDefaultGrainSize = 1024;
+
+	// Ranges shorter than this are sorted on the calling thread.
+	constexpr size_t GParallelSortMinSize = 4096;
+
+	/**
+	 * Call func(chunkIndex) for every chunk in [0, chunkCount), in any order and on any thread.
+	 */
+	template<typename FuncType>
+	void ParallelForChunks(size_t chunkCount, FuncType&& func, const char* name = "ParallelFor");
+
+	/**
+	 * Call func(begin, end) for consecutive ranges covering [0, count).
+	 * @param grainSize is the smallest range, 0 splits into a few chunks per thread.
+	 */
+	template<typename FuncType>
+	void ParallelForRange(size_t count, FuncType&& func, size_t grainSize = 0, const char* name = "ParallelFor");
+
+	/**
+	 * Call func(index) for every index in [0, count).
+	 */
+	template<typename FuncType>
+	void ParallelFor(size_t count, FuncType&& func, size_t grainSize = 0, const char* name = "ParallelFor");
+
+	/**
+	 * Call func(element) for every element of data.
+	 */
+	template<typename T, typename FuncType>
+	void ParallelFor(std::span<T> data, FuncType&& func, size_t grainSize = 0, const char* name = "ParallelFor");
+
+	/**
+	 * Reduce [0, count): every chunk computes rangeFunc(begin, end, identity), the chunk results are
+	 * combined from left to right with combine(left, right).
+	 * @returns identity if count is zero.
+	 */
+	template<typename ValueType, typename RangeFuncType, typename CombineFuncType>
+	ValueType ParallelReduce(size_t count, const ValueType& identity, RangeFuncType&& rangeFunc, CombineFuncType&& combine, size_t grainSize = 0, const char* name = "ParallelReduce");
+
+	/**
+	 * Combine transform(element) over data with combine, in element order within a chunk and chunk order across chunks.
+	 */
+	template<typename T, typename ValueType, typename TransformFuncType, typename CombineFuncType>
+	ValueType ParallelTransformReduce(std::span<T> data, const ValueType& identity, TransformFuncType&& transform, CombineFuncType&& combine, size_t grainSize = 0, const char* name = "ParallelReduce");
+
+	/**
+	 * output[i] = input[0] op ... op input[i]. op must be associative, output may alias input.
+	 */
+	template<typename T, typename OpType = std::plus<>>
+	void ParallelInclusiveScan(std::span<const T> input, std::span<T> output, OpType&& op = {}, size_t grainSize = 0, const char* name = "ParallelScan");
+
+	/**
+	 * output[i] = init op input[0] op ... op input[i - 1]. op must be associative, output may alias input.
+	 */
+	template<typename T, typename OpType = std::plus<>>
+	void ParallelExclusiveScan(std::span<const T> input, std::span<T> output, const T& init, OpType&& op = {}, size_t grainSize = 0, const char* name = "ParallelScan");
+
+	/**
+	 * Sort chunks in parallel and merge them pairwise with merge path splits, scratch must be as large as data.
+	 * Not stable, equal elements keep the order std::sort gives them within a chunk.
+	 */
+	template<typename T, typename CompareType = std::less<>>
+	void ParallelSort(std::span<T> data, std::span<T> scratch, CompareType&& comp = {}, const char* name = "ParallelSort");
+
+	/**
+	 * Same as above with a temporary scratch buffer, allocates on every call.
+	 */
+	template<typename T, typename CompareType = std::less<>> requires std::predicate<CompareType&, const T&, const T&>
+	void ParallelSort(std::span<T> data, CompareType&& comp = {}, const char* name = "ParallelSort");
+
+	/**
+	 * Stable LSD radix sort on the unsigned integer keyFunc(element), one byte per pass, scratch must be as large as data.
+	 * Passes where every key has the same byte are skipped.
+	 */
+	template<typename T, typename KeyFuncType>
+	void ParallelRadixSort(std::span<T> data, std::span<T> scratch, KeyFuncType&& keyFunc, const char* name = "ParallelRadixSort");
+
+	/**
+	 * Radix sort of unsigned integers by their value.
+	 */
+	template<typename T> requires std::is_unsigned_v<T>
+	void ParallelRadixSort(std::span<T> data, std::span<T> scratch, const char* name = "ParallelRadixSort");
+
+	// Non-member Function
+
+	// --Implementation-- //
+
+	template<typename FuncType>
+	void ParallelForChunks(size_t chunkCount, FuncType&& func, const char* name)
+	{
+		FJobSystem& jobSystem = FJobSystem::Get();
+		if (chunkCount <= 1 || !jobSystem.IsRunning() || jobSystem.GetNumWorkers() == 0)
+		{
+			for (size_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+			{
+				func(chunkIndex);
+			}
+			return;
+		}
+
+		struct FChunkContext
+		{
+			std::atomic<size_t> NextChunk{ 0 };
+			size_t ChunkCount;
+			std::remove_reference_t<FuncType>* Func;
+
+			void Process()
+			{
+				for (;;)
+				{
+					const size_t chunkIndex = NextChunk.fetch_add(1, std::memory_order_relaxed);
+					if (chunkIndex >= ChunkCount)
+					{
+						return;
+					}
+					(*Func)(chunkIndex);
+				}
+			}
+		};
+
+		FChunkContext context;
+		context.ChunkCount = chunkCount;
+		context.Func = &func;
+
+		// Helpers that start after the chunks ran out return right away, so there is no point in more than one per worker.
+		const size_t helperCount = std::min<size_t>(jobSystem.GetNumWorkers(), chunkCount - 1);
+
+		// One batch, so the counter holds every helper before the first one can finish and Wait cannot return while
+		// a helper that points at context is still queued.
+		std::vector<FJobDesc> helpers(helperCount, FJobDesc{ [contextPtr = &context]() { contextPtr->Process(); }, name, EJobPriority::High });
+
+		FJobCounter counter;
+		jobSystem.Run(std::span<FJobDesc>(helpers), &counter);
+
+		context.Process();
+		jobSystem.Wait(counter);
+	}
+
+	template<typename FuncType>
+	void ParallelForRange(size_t count, FuncType&& func, size_t grainSize, const char* name)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		if (grainSize == 0)
+		{
+			// A few chunks per thread, so a slow chunk does not hold up the whole loop.
+			const size_t targetChunkCount = (static_cast<size_t>(FJobSystem::Get().GetNumWorkers()) + 1) * 4;
+			grainSize = (count + targetChunkCount - 1) / targetChunkCount;
+		}
+
+		const size_t chunkCount = (count + grainSize - 1) / grainSize;
+		ParallelForChunks(chunkCount, [&](size_t chunkIndex)
+		{
+			const size_t begin = chunkIndex * grainSize;
+			func(begin, std::min(begin + grainSize, count));
+		}, name);
+	}
+
+	template<typename FuncType>
+	void ParallelFor(size_t count, FuncType&& func, size_t grainSize, const char* name)
+	{
+		ParallelForRange(count, [&](size_t begin, size_t end)
+		{
+			for (size_t index = begin; index < end; ++index)
+			{
+				func(index);
+			}
+		}, grainSize, name);
+	}
+
+	template<typename T, typename FuncType>
+	void ParallelFor(std::span<T> data, FuncType&& func, size_t grainSize, const char* name)
+	{
+		ParallelForRange(data.size(), [&](size_t begin, size_t end)
+		{
+			for (size_t index = begin; index < end; ++index)
+			{
+				func(data[index]);
+			}
+		}, grainSize, name);
+	}
+
+	// Chunking of the deterministic algorithms, only depends on count and grainSize.
+	struct FParallelChunking
+	{
+		size_t Count;
+		size_t ChunkCount;
+
+		FParallelChunking(size_t count, size_t grainSize, size_t maxChunkCount = GParallelMaxChunks)
+			: Count(count)
+		{
+			grainSize = grainSize == 0 ? GParallelDefaultGrainSize : grainSize;
+			ChunkCount = std::clamp<size_t>((count + grainSize - 1) / grainSize, 1, maxChunkCount);
+		}
+
+		size_t GetBegin(size_t chunkIndex) const { return Count * chunkIndex / ChunkCount; }
+		size_t GetEnd(size_t chunkIndex) const { return Count * (chunkIndex + 1) / ChunkCount; }
+	};
+
+	template<typename ValueType, typename RangeFuncType, typename CombineFuncType>
+	ValueType ParallelReduce(size_t count, const ValueType& identity, RangeFuncType&& rangeFunc, CombineFuncType&& combine, size_t grainSize, const char* name)
+	{
+		if (count == 0)
+		{
+			return identity;
+		}
+
+		const FParallelChunking chunking(count, grainSize);
+		if (chunking.ChunkCount == 1)
+		{
+			return rangeFunc(size_t(0), count, identity);
+		}
+
+		std::array<ValueType, GParallelMaxChunks> partials;
+		ParallelForChunks(chunking.ChunkCount, [&](size_t chunkIndex)
+		{
+			partials[chunkIndex] = rangeFunc(chunking.GetBegin(chunkIndex), chunking.GetEnd(chunkIndex), identity);
+		}, name);
+
+		ValueType result = partials[0];
+		for (size_t chunkIndex = 1; chunkIndex < chunking.ChunkCount; ++chunkIndex)
+		{
+			result = combine(result, partials[chunkIndex]);
+		}
+		return result;
+	}
+
+	template<typename T, typename ValueType, typename TransformFuncType, typename CombineFuncType>
+	ValueType ParallelTransformReduce(std::span<T> data, const ValueType& identity, TransformFuncType&& transform, CombineFuncType&& combine, size_t grainSize, const char* name)
+	{
+		return ParallelReduce(data.size(), identity, [&](size_t begin, size_t end, ValueType value)
+		{
+			for (size_t index = begin; index < end; ++index)
+			{
+				value = combine(value, transform(data[index]));
+			}
+			return value;
+		}, combine, grainSize, name);
+	}
+
+	// Three passes: chunk totals in parallel, their prefix on the calling thread, then every chunk scans
+	// starting from the total of the chunks before it.
+	template<typename T, typename OpType>
+	void ParallelScanImpl(std::span<const T> input, std::span<T> output, const T* init, OpType& op, size_t grainSize, const char* name)
+	{
+		ASSERT(output.size() >= input.size());
+
+		const size_t count = input.size();
+		if (count == 0)
+		{
+			return;
+		}
+
+		const FParallelChunking chunking(count, grainSize);
+
+		// Total of everything before the chunk, including init. Unset for the first chunk of an inclusive scan.
+		std::array<T, GParallelMaxChunks> carries;
+
+		if (chunking.ChunkCount > 1)
+		{
+			std::array<T, GParallelMaxChunks> totals;
+			ParallelForChunks(chunking.ChunkCount - 1, [&](size_t chunkIndex)
+			{
+				const size_t end = chunking.GetEnd(chunkIndex);
+				T total = input[chunking.GetBegin(chunkIndex)];
+				for (size_t index = chunking.GetBegin(chunkIndex) + 1; index < end; ++index)
+				{
+					total = op(total, input[index]);
+				}
+				totals[chunkIndex] = total;
+			}, name);
+
+			carries[1] = init != nullptr ? op(*init, totals[0]) : totals[0];
+			for (size_t chunkIndex = 2; chunkIndex < chunking.ChunkCount; ++chunkIndex)
+			{
+				carries[chunkIndex] = op(carries[chunkIndex - 1], totals[chunkIndex - 1]);
+			}
+		}
+
+		ParallelForChunks(chunking.ChunkCount, [&](size_t chunkIndex)
+		{
+			const size_t begin = chunking.GetBegin(chunkIndex);
+			const size_t end = chunking.GetEnd(chunkIndex);
+
+			if (init != nullptr)
+			{
+				T running = chunkIndex == 0 ? *init : carries[chunkIndex];
+				for (size_t index = begin; index < end; ++index)
+				{
+					// Read before the write, output may alias input.
+					const T value = input[index];
+					output[index] = running;
+					running = op(running, value);
+				}
+			}
+			else
+			{
+				T running = chunkIndex == 0 ? input[begin] : op(carries[chunkIndex], input[begin]);
+				output[begin] = running;
+				for (size_t index = begin + 1; index < end; ++index)
+				{
+					running = op(running, input[index]);
+					output[index] = running;
+				}
+			}
+		}, name);
+	}
+
+	template<typename T, typename OpType>
+	void ParallelInclusiveScan(std::span<const T> input, std::span<T> output, OpType&& op, size_t grainSize, const char* name)
+	{
+		ParallelScanImpl<T>(input, output, nullptr, op, grainSize, name);
+	}
+
+	template<typename T, typename OpType>
+	void ParallelExclusiveScan(std::span<const T> input, std::span<T> output, const T& init, OpType&& op, size_t grainSize, const char* name)
+	{
+		ParallelScanImpl<T>(input, output, &init, op, grainSize, name);
+	}
+
+	/**
+	 * @returns how many of the first diagonal elements of a stable merge of left and right come from left.
+	 */
+	template<typename T, typename CompareType>
+	size_t MergePathSplit(std::span<const T> left, std::span<const T> right, size_t diagonal, CompareType& comp)
+	{
+		size_t low = diagonal > right.size() ? diagonal - right.size() : 0;
+		size_t high = std::min(diagonal, left.size());
+		while (low < high)
+		{
+			const size_t leftCount = (low + high) / 2;
+
+			// On equal elements the stable merge takes left first.
+			if (!comp(right[diagonal - leftCount - 1], left[leftCount]))
+			{
+				low = leftCount + 1;
+			}
+			else
+			{
+				high = leftCount;
+			}
+		}
+		return low;
+	}
+
+	template<typename T, typename CompareType>
+	void ParallelSort(std::span<T> data, std::span<T> scratch, CompareType&& comp, const char* name)
+	{
+		ASSERT(scratch.size() >= data.size());
+
+		const size_t count = data.size();
+		FJobSystem& jobSystem = FJobSystem::Get();
+		if (count < GParallelSortMinSize || !jobSystem.IsRunning() || jobSystem.GetNumWorkers() == 0)
+		{
+			std::sort(data.begin(), data.end(), comp);
+			return;
+		}
+
+		// A power of two, so every merge pass pairs up all runs.
+		size_t chunkCount = 1;
+		while (chunkCount * 2 <= GParallelMaxChunks && count / (chunkCount * 2) >= GParallelSortMinSize / 2)
+		{
+			chunkCount *= 2;
+		}
+
+		auto chunkBegin = [&](size_t chunkIndex) { return count * chunkIndex / chunkCount; };
+
+		ParallelForChunks(chunkCount, [&](size_t chunkIndex)
+		{
+			std::sort(data.begin() + chunkBegin(chunkIndex), data.begin() + chunkBegin(chunkIndex + 1), comp);
+		}, name);
+
+		std::span<T> source = data;
+		std::span<T> destination = scratch.first(count);
+
+		// Every pass splits each pair of runs into as many merge tasks as it has chunks, so a pass always has chunkCount tasks.
+		for (size_t runChunks = 1; runChunks < chunkCount; runChunks *= 2)
+		{
+			const size_t pairChunks = runChunks * 2;
+			ParallelForChunks(chunkCount, [&](size_t taskIndex)
+			{
+				const size_t pairIndex = taskIndex / pairChunks;
+				const size_t partIndex = taskIndex % pairChunks;
+
+				const size_t pairBegin = chunkBegin(pairIndex * pairChunks);
+				const size_t pairMiddle = chunkBegin(pairIndex * pairChunks + runChunks);
+				const size_t pairEnd = chunkBegin((pairIndex + 1) * pairChunks);
+
+				const std::span<const T> left(source.data() + pairBegin, pairMiddle - pairBegin);
+				const std::span<const T> right(source.data() + pairMiddle, pairEnd - pairMiddle);
+
+				const size_t pairCount = pairEnd - pairBegin;
+				const size_t outputBegin = pairCount * partIndex / pairChunks;
+				const size_t outputEnd = pairCount * (partIndex + 1) / pairChunks;
+
+				const size_t leftBegin = MergePathSplit(left, right, outputBegin, comp);
+				const size_t leftEnd = MergePathSplit(left, right, outputEnd, comp);
+
+				std::merge(std::make_move_iterator(source.begin() + pairBegin + leftBegin), std::make_move_iterator(source.begin() + pairBegin + leftEnd),
+					std::make_move_iterator(source.begin() + pairMiddle + (outputBegin - leftBegin)), std::make_move_iterator(source.begin() + pairMiddle + (outputEnd - leftEnd)),
+					destination.begin() + pairBegin + outputBegin, comp);
+			}, name);
+
+			std::swap(source, destination);
+		}
+
+		if (source.data() != data.data())
+		{
+			ParallelForChunks(chunkCount, [&](size_t chunkIndex)
+			{
+				std::move(source.begin() + chunkBegin(chunkIndex), source.begin() + chunkBegin(chunkIndex + 1), data.begin() + chunkBegin(chunkIndex));
+			}, name);
+		}
+	}
+
+	template<typename T, typename CompareType> requires std::predicate<CompareType&, const T&, const T&>
+	void ParallelSort(std::span<T> data, CompareType&& comp, const char* name)
+	{
+		std::vector<T> scratch(data.size());
+		ParallelSort(data, std::span<T>(scratch), comp, name);
+	}
+
+	template<typename T, typename KeyFuncType>
+	void ParallelRadixSort(std::span<T> data, std::span<T> scratch, KeyFuncType&& keyFunc, const char* name)
+	{
+		using KeyType = std::invoke_result_t<KeyFuncType&, const T&>;
+		static_assert(std::is_unsigned_v<KeyType>, "Radix sort key must be an unsigned integer");
+
+		constexpr size_t RadixBits = 8;
+		constexpr size_t RadixSize = size_t(1) << RadixBits;
+		constexpr size_t MaxChunkCount = 32;
+
+		ASSERT(scratch.size() >= data.size());
+		ASSERT(data.size() <= UINT32_MAX);
+
+		const size_t count = data.size();
+		if (count <= 1)
+		{
+			return;
+		}
+
+		const FParallelChunking chunking(count, GParallelSortMinSize, MaxChunkCount);
+
+		// Per chunk digit counts, turned into the chunk's first output position of every digit.
+		std::array<std::array<uint32, RadixSize>, MaxChunkCount> offsets;
+
+		std::span<T> source = data;
+		std::span<T> destination = scratch.first(count);
+
+		for (size_t shift = 0; shift < sizeof(KeyType) * 8; shift += RadixBits)
+		{
+			ParallelForChunks(chunking.ChunkCount, [&](size_t chunkIndex)
+			{
+				std::array<uint32, RadixSize>& histogram = offsets[chunkIndex];
+				histogram.fill(0);
+
+				const size_t end = chunking.GetEnd(chunkIndex);
+				for (size_t index = chunking.GetBegin(chunkIndex); index < end; ++index)
+				{
+					++histogram[(keyFunc(source[index]) >> shift) & (RadixSize - 1)];
+				}
+			}, name);
+
+			// Digit major, chunk minor, which keeps equal digits in input order.
+			uint32 position = 0;
+			bool bSingleDigit = false;
+			for (size_t digit = 0; digit < RadixSize; ++digit)
+			{
+				const uint32 digitBegin = position;
+				for (size_t chunkIndex = 0; chunkIndex < chunking.ChunkCount; ++chunkIndex)
+				{
+					const uint32 digitCount = offsets[chunkIndex][digit];
+					offsets[chunkIndex][digit] = position;
+					position += digitCount;
+				}
+
+				if (position - digitBegin == count)
+				{
+					bSingleDigit = true;
+					break;
+				}
+			}
+
+			if (bSingleDigit)
+			{
+				continue;
+			}
+
+			ParallelForChunks(chunking.ChunkCount, [&](size_t chunkIndex)
+			{
+				std::array<uint32, RadixSize>& chunkOffsets = offsets[chunkIndex];
+
+				const size_t end = chunking.GetEnd(chunkIndex);
+				for (size_t index = chunking.GetBegin(chunkIndex); index < end; ++index)
+				{
+					const size_t digit = (keyFunc(source[index]) >> shift) & (RadixSize - 1);
+					destination[chunkOffsets[digit]++] = std::move(source[index]);
+				}
+			}, name);
+
+			std::swap(source, destination);
+		}
+
+		if (source.data() != data.data())
+		{
+			ParallelForChunks(chunking.ChunkCount, [&](size_t chunkIndex)
+			{
+				std::move(source.begin() + chunking.GetBegin(chunkIndex), source.begin() + chunking.GetEnd(chunkIndex), data.begin() + chunking.GetBegin(chunkIndex));
+			}, name);
+		}
+	}
+
+	template<typename T> requires std::is_unsigned_v<T>
+	void ParallelRadixSort(std::span<T> data, std::span<T> scratch, const char* name)
+	{
+		ParallelRadixSort(data, scratch, [](const T& value) { return value; }, name);
+	}
+}
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+
+#include "CacheLine.h"
+
+namespace Dash
+{
+	// Lock-free single producer single consumer ring of variable sized records.
+	//
+	// Every record starts on an 8 byte boundary behind an 8 byte size prefix and is never split by the end of the
+	// buffer: a record that does not fit before the end leaves a skip marker and starts over at the beginning.
+	// The consumer therefore reads records in place, and a record's bytes stay untouched until its callback returns.
+	class FSPSCByteRing
+	{
+	public:
+		/**
+		 * @param capacity in bytes, rounded up to a power of two.
+		 */
+		explicit FSPSCByteRing(size_t capacity);
+
+		FSPSCByteRing(const FSPSCByteRing&) = delete;
+		FSPSCByteRing& operator=(const FSPSCByteRing&) = delete;
+
+		/**
+		 * Producer only. Append one record made of a header and a payload, which are stored back to back.
+		 * @returns false if the ring has no room for it right now.
+		 */
+		bool TryPush(const void* header, size_t headerSize, const void* payload, size_t payloadSize);
+
+		/**
+		 * Producer only. Reserve size bytes for a record that is written in place, EndPush publishes it.
+		 * @returns nullptr if the ring has no room for it right now, EndPush must not be called then.
+		 */
+		uint8* BeginPush(size_t size);
+		void EndPush() { mHead.store(mPendingHead, std::memory_order_release); }
+
+		/**
+		 * Consumer only. Call func(const uint8* data, size_t size) for every record in push order.
+		 * @returns the number of records consumed.
+		 */
+		template<typename FuncType>
+		size_t ConsumeAll(FuncType&& func);
+
+		/**
+		 * Largest record TryPush can ever accept.
+		 */
+		size_t GetMaxRecordSize() const { return mCapacity / 2 - PrefixSize; }
+
+		size_t GetCapacity() const { return mCapacity; }
+
+		/**
+		 * Bytes in use, exact on the consumer, an upper bound on the producer.
+		 */
+		size_t GetUsedBytes() const { return static_cast<size_t>(mHead.load(std::memory_order_acquire) - mTail.load(std::memory_order_acquire)); }
+
+	private:
+		static constexpr size_t PrefixSize = 8;
+		static constexpr uint32 SkipMarker = UINT32_MAX;
+
+		static size_t AlignRecord(size_t size) { return (size + 7) & ~size_t(7); }
+
+	private:
+		size_t mCapacity;
+		size_t mMask;
+		std::unique_ptr<uint64[]> mBuffer;
+
+		alignas(GCacheLineSize) std::atomic<uint64> mHead{ 0 };
+		uint64 mPendingHead = 0;
+		alignas(GCacheLineSize) std::atomic<uint64> mTail{ 0 };
+	};
+
+	// Member Function
+
+	// --Implementation-- //
+
+	inline FSPSCByteRing::FSPSCByteRing(size_t capacity)
+	{
+		mCapacity = 64;
+		while (mCapacity < capacity)
+		{
+			mCapacity *= 2;
+		}
+
+		mMask = mCapacity - 1;
+		mBuffer.reset(new uint64[mCapacity / sizeof(uint64)]);
+	}
+
+	inline bool FSPSCByteRing::TryPush(const void* header, size_t headerSize, const void* payload, size_t payloadSize)
+	{
+		uint8* record = BeginPush(headerSize + payloadSize);
+		if (record == nullptr)
+		{
+			return false;
+		}
+
+		std::memcpy(record, header, headerSize);
+		if (payloadSize > 0)
+		{
+			std::memcpy(record + headerSize, payload, payloadSize);
+		}
+
+		EndPush();
+		return true;
+	}
+
+	inline uint8* FSPSCByteRing::BeginPush(size_t size)
+	{
+		if (size > GetMaxRecordSize())
+		{
+			return nullptr;
+		}
+
+		const size_t recordSize = AlignRecord(PrefixSize + size);
+
+		uint64 head = mHead.load(std::memory_order_relaxed);
+		const uint64 tail = mTail.load(std::memory_order_acquire);
+
+		const size_t offset = static_cast<size_t>(head & mMask);
+		const size_t spaceToEnd = mCapacity - offset;
+		const size_t required = recordSize <= spaceToEnd ? recordSize : spaceToEnd + recordSize;
+
+		if (head - tail + required > mCapacity)
+		{
+			return nullptr;
+		}
+
+		uint8* bytes = reinterpret_cast<uint8*>(mBuffer.get());
+
+		if (recordSize > spaceToEnd)
+		{
+			const uint32 skip = SkipMarker;
+			std::memcpy(bytes + offset, &skip, sizeof(skip));
+			head += spaceToEnd;
+		}
+
+		uint8* record = bytes + (head & mMask);
+		const uint32 recordDataSize = static_cast<uint32>(size);
+		std::memcpy(record, &recordDataSize, sizeof(recordDataSize));
+
+		mPendingHead = head + recordSize;
+		return record + PrefixSize;
+	}
+
+	template<typename FuncType>
+	size_t FSPSCByteRing::ConsumeAll(FuncType&& func)
+	{
+		const uint8* bytes = reinterpret_cast<const uint8*>(mBuffer.get());
+
+		uint64 tail = mTail.load(std::memory_order_relaxed);
+		const uint64 head = mHead.load(std::memory_order_acquire);
+
+		size_t count = 0;
+		while (tail != head)
+		{
+			const size_t offset = static_cast<size_t>(tail & mMask);
+
+			uint32 size;
+			std::memcpy(&size, bytes + offset, sizeof(size));
+
+			if (size == SkipMarker)
+			{
+				tail += mCapacity - offset;
+				continue;
+			}
+
+			func(bytes + offset + PrefixSize, static_cast<size_t>(size));
+			++count;
+
+			// Released per record, so a blocked producer gets room while the rest is still being consumed.
+			tail += AlignRecord(PrefixSize + size);
+			mTail.store(tail, std::memory_order_release);
+		}
+
+		mTail.store(tail, std::memory_order_release);
+		return count;
+	}
+}
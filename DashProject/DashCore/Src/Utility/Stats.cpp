@@ -0,0 +1,251 @@
+#include "PCH.h"
+#include "Stats.h"
+#include "FileUtility.h"
+
+namespace Dash
+{
+	// Frames kept per stat, a power of two.
+	static constexpr uint32 GStatsHistorySize = 256;
+
+	static std::string_view GetStatTypeName(EStatType type)
+	{
+		return type == EStatType::Counter ? "Counter" : "Gauge";
+	}
+
+	FStat::FStat(std::string_view name, EStatType type)
+		: mName(name)
+		, mType(type)
+	{
+		FStats::Get().Register(this);
+	}
+
+	FStat::~FStat()
+	{
+		FStats::Get().Unregister(this);
+	}
+
+	FStats& FStats::Get()
+	{
+		static FStats instance;
+		return instance;
+	}
+
+	void FStats::BeginFrame()
+	{
+		std::lock_guard<std::mutex> lock(mLock);
+
+		for (FStatEntry& entry : mEntries)
+		{
+			entry.History[mHistoryHead] = entry.Stat->Snapshot();
+			entry.NumSamples = std::min(entry.NumSamples + 1, GStatsHistorySize);
+		}
+
+		mHistoryHead = (mHistoryHead + 1) & (GStatsHistorySize - 1);
+		++mFrameIndex;
+	}
+
+	bool FStats::GetSummary(std::string_view name, FStatSummary& outSummary) const
+	{
+		std::lock_guard<std::mutex> lock(mLock);
+
+		for (const FStatEntry& entry : mEntries)
+		{
+			if (entry.Stat->GetName() == name)
+			{
+				outSummary = Summarize(entry);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	std::vector<FStatSummary> FStats::GetSummaries() const
+	{
+		std::lock_guard<std::mutex> lock(mLock);
+
+		std::vector<FStatSummary> summaries;
+		for (const FStatEntry* entry : GetSortedEntries())
+		{
+			summaries.push_back(Summarize(*entry));
+		}
+
+		return summaries;
+	}
+
+	bool FStats::DumpCsv(const std::string& filePath) const
+	{
+		std::string csv;
+
+		{
+			std::lock_guard<std::mutex> lock(mLock);
+
+			const std::vector<const FStatEntry*> entries = GetSortedEntries();
+
+			uint32 numFrames = 0;
+			for (const FStatEntry* entry : entries)
+			{
+				numFrames = std::max(numFrames, entry->NumSamples);
+			}
+
+			csv += "Frame";
+			for (const FStatEntry* entry : entries)
+			{
+				csv += ',';
+				csv += entry->Stat->GetName();
+			}
+			csv += '\n';
+
+			for (uint32 frame = 0; frame < numFrames; ++frame)
+			{
+				std::format_to(std::back_inserter(csv), "{}", mFrameIndex - numFrames + frame);
+
+				for (const FStatEntry* entry : entries)
+				{
+					csv += ',';
+
+					// Frame i of numFrames is sample i - (numFrames - NumSamples) of the entry, if it has one.
+					const uint32 missing = numFrames - entry->NumSamples;
+					if (frame >= missing)
+					{
+						std::format_to(std::back_inserter(csv), "{}", GetSample(*entry, entry->NumSamples, frame - missing));
+					}
+				}
+				csv += '\n';
+			}
+		}
+
+		if (!FFileUtility::WriteTextFileSync(filePath, csv))
+		{
+			DASH_LOG(LogTemp, Error, "Failed to write stats to {}.", filePath);
+			return false;
+		}
+
+		return true;
+	}
+
+	bool FStats::DumpJson(const std::string& filePath) const
+	{
+		std::string json;
+
+		{
+			std::lock_guard<std::mutex> lock(mLock);
+
+			std::format_to(std::back_inserter(json), "{{\"frame\":{},\"stats\":[", mFrameIndex);
+
+			bool first = true;
+			for (const FStatEntry* entry : GetSortedEntries())
+			{
+				const FStatSummary summary = Summarize(*entry);
+
+				// Stat names are plain identifiers and paths, they need no escaping.
+				std::format_to(std::back_inserter(json), "{}\n{{\"name\":\"{}\",\"type\":\"{}\",\"last\":{},\"min\":{},\"max\":{},\"average\":{:.3f},\"p99\":{},\"history\":[",
+					first ? "" : ",", summary.Name, GetStatTypeName(summary.Type), summary.Last, summary.Min, summary.Max, summary.Average, summary.P99);
+				first = false;
+
+				for (uint32 i = 0; i < entry->NumSamples; ++i)
+				{
+					std::format_to(std::back_inserter(json), "{}{}", i == 0 ? "" : ",", GetSample(*entry, entry->NumSamples, i));
+				}
+				json += "]}";
+			}
+
+			json += "\n]}\n";
+		}
+
+		if (!FFileUtility::WriteTextFileSync(filePath, json))
+		{
+			DASH_LOG(LogTemp, Error, "Failed to write stats to {}.", filePath);
+			return false;
+		}
+
+		return true;
+	}
+
+	uint32 FStats::GetHistorySize() const
+	{
+		return GStatsHistorySize;
+	}
+
+	uint64 FStats::GetFrameIndex() const
+	{
+		std::lock_guard<std::mutex> lock(mLock);
+		return mFrameIndex;
+	}
+
+	void FStats::Register(FStat* stat)
+	{
+		std::lock_guard<std::mutex> lock(mLock);
+
+		for (const FStatEntry& entry : mEntries)
+		{
+			ASSERT_MSG(entry.Stat->GetName() != stat->GetName(), "Stat %s is defined twice.", stat->GetName().c_str());
+		}
+
+		FStatEntry& entry = mEntries.emplace_back();
+		entry.Stat = stat;
+		entry.History.resize(GStatsHistorySize, 0);
+	}
+
+	void FStats::Unregister(FStat* stat)
+	{
+		std::lock_guard<std::mutex> lock(mLock);
+
+		std::erase_if(mEntries, [stat](const FStatEntry& entry) { return entry.Stat == stat; });
+	}
+
+	int64 FStats::GetSample(const FStatEntry& entry, uint32 count, uint32 i) const
+	{
+		return entry.History[(mHistoryHead - count + i) & (GStatsHistorySize - 1)];
+	}
+
+	FStatSummary FStats::Summarize(const FStatEntry& entry) const
+	{
+		FStatSummary summary;
+		summary.Name = entry.Stat->GetName();
+		summary.Type = entry.Stat->GetType();
+		summary.NumSamples = entry.NumSamples;
+
+		if (entry.NumSamples == 0)
+		{
+			return summary;
+		}
+
+		int64 samples[GStatsHistorySize];
+		int64 sum = 0;
+		for (uint32 i = 0; i < entry.NumSamples; ++i)
+		{
+			samples[i] = GetSample(entry, entry.NumSamples, i);
+			sum += samples[i];
+		}
+
+		summary.Last = samples[entry.NumSamples - 1];
+		summary.Min = *std::min_element(samples, samples + entry.NumSamples);
+		summary.Max = *std::max_element(samples, samples + entry.NumSamples);
+		summary.Average = static_cast<double>(sum) / entry.NumSamples;
+
+		// Nearest rank: the smallest sample at or above 99% of all samples.
+		const uint32 rank = (entry.NumSamples * 99 + 99) / 100 - 1;
+		std::nth_element(samples, samples + rank, samples + entry.NumSamples);
+		summary.P99 = samples[rank];
+
+		return summary;
+	}
+
+	std::vector<const FStats::FStatEntry*> FStats::GetSortedEntries() const
+	{
+		std::vector<const FStatEntry*> entries;
+		entries.reserve(mEntries.size());
+		for (const FStatEntry& entry : mEntries)
+		{
+			entries.push_back(&entry);
+		}
+
+		std::sort(entries.begin(), entries.end(), [](const FStatEntry* a, const FStatEntry* b)
+		{
+			return a->Stat->GetName() < b->Stat->GetName();
+		});
+
+		return entries;
+	}
+}
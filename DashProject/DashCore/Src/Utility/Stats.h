@@ -0,0 +1,182 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ThreadSafeCounter.h"
+
+namespace Dash
+{
+	enum class EStatType : uint8
+	{
+		// Summed over a frame and reset when the frame is snapshotted, such as draw calls.
+		Counter,
+
+		// A level that carries over from frame to frame, such as pages in a pool.
+		Gauge,
+	};
+
+	struct FStatSummary
+	{
+		std::string Name;
+		EStatType Type = EStatType::Counter;
+
+		// Over the frames in the history.
+		uint32 NumSamples = 0;
+		int64 Last = 0;
+		int64 Min = 0;
+		int64 Max = 0;
+		double Average = 0.0;
+		int64 P99 = 0;
+	};
+
+	// A named statistic, defined once at file scope next to the code that feeds it:
+	//
+	//     static FStatCounter GStatDrawCalls("Graphics/DrawCalls");
+	//     GStatDrawCalls.Increment();
+	//
+	// Constructing one registers it with FStats, names must be unique.
+	class FStat
+	{
+	public:
+		FStat(std::string_view name, EStatType type);
+		virtual ~FStat();
+
+		FStat(const FStat&) = delete;
+		FStat& operator=(const FStat&) = delete;
+
+		const std::string& GetName() const { return mName; }
+		EStatType GetType() const { return mType; }
+
+	protected:
+		friend class FStats;
+
+		/**
+		 * The value for the frame that just ended, counters start over from zero.
+		 */
+		virtual int64 Snapshot() = 0;
+
+	private:
+		std::string mName;
+		EStatType mType;
+	};
+
+	class FStatCounter : public FStat
+	{
+	public:
+		explicit FStatCounter(std::string_view name) : FStat(name, EStatType::Counter) {}
+
+		void Add(int64 amount) { mValue.Add(amount); }
+		void Increment() { mValue.Increment(); }
+
+		/**
+		 * So far in the current frame.
+		 */
+		int64 GetValue() const { return mValue.GetValue(); }
+
+	protected:
+		int64 Snapshot() override { return mValue.Reset(); }
+
+	private:
+		FThreadSafeShardedCounter mValue;
+	};
+
+	class FStatGauge : public FStat
+	{
+	public:
+		explicit FStatGauge(std::string_view name) : FStat(name, EStatType::Gauge) {}
+
+		void Set(int64 value) { mValue.store(value, std::memory_order_relaxed); }
+		void Add(int64 amount) { mValue.fetch_add(amount, std::memory_order_relaxed); }
+		void Subtract(int64 amount) { mValue.fetch_sub(amount, std::memory_order_relaxed); }
+
+		int64 GetValue() const { return mValue.load(std::memory_order_relaxed); }
+
+	protected:
+		int64 Snapshot() override { return GetValue(); }
+
+	private:
+		alignas(GCacheLineSize) std::atomic<int64> mValue{ 0 };
+	};
+
+	// Registry of every FStat.
+	//
+	// BeginFrame snapshots all stats into a ring holding the last GetHistorySize frames, from which the summaries
+	// and the CSV and JSON dumps are made.
+	class FStats
+	{
+	public:
+		static FStats& Get();
+
+		/**
+		 * Snapshot the frame that just ended. Called once per frame by the main loop.
+		 */
+		void BeginFrame();
+
+		/**
+		 * @returns false if no stat has that name.
+		 */
+		bool GetSummary(std::string_view name, FStatSummary& outSummary) const;
+
+		/**
+		 * Every stat, by name.
+		 */
+		std::vector<FStatSummary> GetSummaries() const;
+
+		/**
+		 * One row per frame in the history, one column per stat. Stats registered later leave their first cells empty.
+		 * @returns false if the file could not be written.
+		 */
+		bool DumpCsv(const std::string& filePath) const;
+
+		/**
+		 * The summary and the history of every stat.
+		 * @returns false if the file could not be written.
+		 */
+		bool DumpJson(const std::string& filePath) const;
+
+		uint32 GetHistorySize() const;
+
+		uint64 GetFrameIndex() const;
+
+	private:
+		FStats() = default;
+
+		friend class FStat;
+
+		void Register(FStat* stat);
+		void Unregister(FStat* stat);
+
+		struct FStatEntry
+		{
+			FStat* Stat = nullptr;
+
+			// Ring indexed like every other entry, see mHistoryHead.
+			std::vector<int64> History;
+
+			// Frames snapshotted since the stat was registered, up to the history size.
+			uint32 NumSamples = 0;
+		};
+
+		// Sample i of the last count, oldest first.
+		int64 GetSample(const FStatEntry& entry, uint32 count, uint32 i) const;
+
+		FStatSummary Summarize(const FStatEntry& entry) const;
+
+		std::vector<const FStatEntry*> GetSortedEntries() const;
+
+	private:
+		mutable std::mutex mLock;
+
+		std::vector<FStatEntry> mEntries;
+
+		// Where the next snapshot of every entry goes.
+		uint32 mHistoryHead = 0;
+
+		// Frames snapshotted so far.
+		uint64 mFrameIndex = 0;
+	};
+}
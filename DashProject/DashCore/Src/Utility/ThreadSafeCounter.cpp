@@ -3,7 +3,12 @@
 
 namespace Dash
 {
-
+	uint32 FThreadSafeShardedCounter::GetShardIndex()
+	{
+		static std::atomic<uint32> nextShardIndex{ 0 };
+		static thread_local uint32 shardIndex = nextShardIndex.fetch_add(1, std::memory_order_relaxed) % NumShards;
+		return shardIndex;
+	}
 }
 
 
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <atomic>
+
+#include "CacheLine.h"
+
 namespace Dash
 {
 	class FThreadSafeCounter
@@ -61,6 +65,65 @@ namespace Dash
 		std::atomic<int32> mCounter;
 	};
 
+	// Counter for values that many threads add to often and few read, such as per frame statistics.
+	//
+	// Every thread adds to one of several shards, each on its own cache line, so concurrent adds do not fight over
+	// a single line. Reading sums the shards and is only exact while nobody adds.
+	class FThreadSafeShardedCounter
+	{
+	public:
+		static constexpr uint32 NumShards = 16;
+
+		FThreadSafeShardedCounter() = default;
+
+		FThreadSafeShardedCounter(const FThreadSafeShardedCounter&) = delete;
+		FThreadSafeShardedCounter& operator=(const FThreadSafeShardedCounter&) = delete;
+
+		void Add(int64 amount)
+		{
+			mShards[GetShardIndex()].Value.fetch_add(amount, std::memory_order_relaxed);
+		}
+
+		void Increment()
+		{
+			Add(1);
+		}
+
+		int64 GetValue() const
+		{
+			int64 value = 0;
+			for (const FShard& shard : mShards)
+			{
+				value += shard.Value.load(std::memory_order_relaxed);
+			}
+			return value;
+		}
+
+		/**
+		 * @returns the value before the reset, adds that race with it count towards the next value instead.
+		 */
+		int64 Reset()
+		{
+			int64 value = 0;
+			for (FShard& shard : mShards)
+			{
+				value += shard.Value.exchange(0, std::memory_order_relaxed);
+			}
+			return value;
+		}
+
+	private:
+		struct alignas(GCacheLineSize) FShard
+		{
+			std::atomic<int64> Value{ 0 };
+		};
+
+		// Threads are spread over the shards in the order they first add to any sharded counter.
+		static uint32 GetShardIndex();
+
+		FShard mShards[NumShards];
+	};
+
 	class FRefCount
 	{
 	public:
@@ -63,7 +63,7 @@ namespace Dash
 		if (mQueue.empty())
 			return false;
 
-		value = mQueue.front();
+		value = std::move(mQueue.front());
 		mQueue.pop();
 
 		return true;
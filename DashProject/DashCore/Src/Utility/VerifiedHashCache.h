@@ -0,0 +1,201 @@
+#pragma once
+
+#include "Assert.h"
+
+#include <span>
+#include <string_view>
+#include <vector>
+#include <cstring>
+#include <type_traits>
+
+namespace Dash
+{
+	// Open addressing cache for objects created from a description, like pipeline states and root signatures.
+	// Every entry keeps the canonical key bytes next to its 64 bit hash and a lookup only hits when both match,
+	// so a hash collision costs one more probe instead of returning the wrong object.
+	// Linear probing over a power of two table that grows at 50% load. Not thread safe, the owner holds the lock.
+
+	struct FHashCacheStats
+	{
+		uint64 Hits = 0;
+		uint64 Misses = 0;
+
+		// The hash matched an entry whose key bytes did not.
+		uint64 Collisions = 0;
+	};
+
+	class FCacheKeyWriter
+	{
+	public:
+		FCacheKeyWriter(std::vector<uint8>& bytes)
+			: mBytes(bytes)
+		{
+			mBytes.clear();
+		}
+
+		template<typename T> requires std::is_trivially_copyable_v<T>
+		void Write(const T& value)
+		{
+			Write(&value, sizeof(T));
+		}
+
+		void Write(const void* data, size_t size)
+		{
+			const uint8* bytes = static_cast<const uint8*>(data);
+			mBytes.insert(mBytes.end(), bytes, bytes + size);
+		}
+
+		/**
+		 * Write the string content with its length, nullptr is written as an empty string.
+		 */
+		void WriteString(const char* str)
+		{
+			std::string_view view = str ? std::string_view(str) : std::string_view();
+			Write(static_cast<uint32>(view.size()));
+			Write(view.data(), view.size());
+		}
+
+	private:
+		std::vector<uint8>& mBytes;
+	};
+
+	template<typename ValueType>
+	class TVerifiedHashCache
+	{
+	public:
+		/**
+		 * Find the value stored for hash and key.
+		 * @returns nullptr if there is no entry with the same key bytes.
+		 */
+		ValueType* Find(uint64 hash, std::span<const uint8> key);
+
+		/**
+		 * Add a value for a key that is not in the cache yet.
+		 */
+		void Add(uint64 hash, std::span<const uint8> key, ValueType* value);
+
+		template<typename FuncType>
+		void ForEach(FuncType&& func) const;
+
+		void Clear();
+
+		size_t GetSize() const { return mSize; }
+
+		const FHashCacheStats& GetStats() const { return mStats; }
+
+	private:
+		struct FEntry
+		{
+			uint64 Hash = 0;
+			std::vector<uint8> Key;
+			ValueType* Value = nullptr;
+		};
+
+		void Grow();
+
+	private:
+		std::vector<FEntry> mEntries;
+		size_t mSize = 0;
+		FHashCacheStats mStats;
+	};
+
+	template<typename ValueType>
+	ValueType* TVerifiedHashCache<ValueType>::Find(uint64 hash, std::span<const uint8> key)
+	{
+		if (mEntries.empty())
+		{
+			++mStats.Misses;
+			return nullptr;
+		}
+
+		const size_t mask = mEntries.size() - 1;
+		for (size_t index = static_cast<size_t>(hash) & mask; ; index = (index + 1) & mask)
+		{
+			const FEntry& entry = mEntries[index];
+			if (entry.Value == nullptr)
+			{
+				++mStats.Misses;
+				return nullptr;
+			}
+
+			if (entry.Hash == hash)
+			{
+				if (entry.Key.size() == key.size() && std::memcmp(entry.Key.data(), key.data(), key.size()) == 0)
+				{
+					++mStats.Hits;
+					return entry.Value;
+				}
+
+				++mStats.Collisions;
+			}
+		}
+	}
+
+	template<typename ValueType>
+	void TVerifiedHashCache<ValueType>::Add(uint64 hash, std::span<const uint8> key, ValueType* value)
+	{
+		ASSERT(value != nullptr);
+
+		if ((mSize + 1) * 2 > mEntries.size())
+		{
+			Grow();
+		}
+
+		const size_t mask = mEntries.size() - 1;
+		size_t index = static_cast<size_t>(hash) & mask;
+		while (mEntries[index].Value != nullptr)
+		{
+			index = (index + 1) & mask;
+		}
+
+		FEntry& entry = mEntries[index];
+		entry.Hash = hash;
+		entry.Key.assign(key.begin(), key.end());
+		entry.Value = value;
+		++mSize;
+	}
+
+	template<typename ValueType>
+	template<typename FuncType>
+	void TVerifiedHashCache<ValueType>::ForEach(FuncType&& func) const
+	{
+		for (const FEntry& entry : mEntries)
+		{
+			if (entry.Value != nullptr)
+			{
+				func(entry.Value);
+			}
+		}
+	}
+
+	template<typename ValueType>
+	void TVerifiedHashCache<ValueType>::Clear()
+	{
+		mEntries.clear();
+		mSize = 0;
+	}
+
+	template<typename ValueType>
+	void TVerifiedHashCache<ValueType>::Grow()
+	{
+		std::vector<FEntry> oldEntries = std::move(mEntries);
+		mEntries = std::vector<FEntry>(oldEntries.empty() ? 16 : oldEntries.size() * 2);
+
+		const size_t mask = mEntries.size() - 1;
+		for (FEntry& oldEntry : oldEntries)
+		{
+			if (oldEntry.Value == nullptr)
+			{
+				continue;
+			}
+
+			size_t index = static_cast<size_t>(oldEntry.Hash) & mask;
+			while (mEntries[index].Value != nullptr)
+			{
+				index = (index + 1) & mask;
+			}
+
+			mEntries[index] = std::move(oldEntry);
+		}
+	}
+}
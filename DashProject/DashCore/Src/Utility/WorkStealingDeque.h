@@ -0,0 +1,142 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "CacheLine.h"
+
+namespace Dash
+{
+	// Chase-Lev work stealing deque of pointers with a fixed power of two capacity, after
+	// "Correct and Efficient Work-Stealing for Weak Memory Models" (Le et al. 2013).
+	// Only the owning thread may Push and Pop, they work at the bottom end in LIFO order.
+	// Any thread may Steal from the top end, the oldest item first.
+	template<typename T>
+	class TWorkStealingDeque
+	{
+	public:
+		/**
+		 * @param capacity is rounded up to a power of two.
+		 */
+		explicit TWorkStealingDeque(size_t capacity = 4096);
+
+		TWorkStealingDeque(const TWorkStealingDeque&) = delete;
+		TWorkStealingDeque& operator=(const TWorkStealingDeque&) = delete;
+
+		/**
+		 * Owner only.
+		 * @returns false if the deque is full.
+		 */
+		bool Push(T* item);
+
+		/**
+		 * Owner only.
+		 * @returns nullptr if the deque is empty.
+		 */
+		T* Pop();
+
+		/**
+		 * @returns nullptr if the deque is empty or another thread won the race for the top item.
+		 */
+		T* Steal();
+
+		/**
+		 * Approximate when called from other threads.
+		 */
+		bool Empty() const;
+
+	private:
+		alignas(GCacheLineSize) std::atomic<int64> mTop;
+		alignas(GCacheLineSize) std::atomic<int64> mBottom;
+		alignas(GCacheLineSize) std::unique_ptr<std::atomic<T*>[]> mItems;
+		int64 mMask;
+	};
+
+	// Member Function
+
+	// --Implementation-- //
+
+	template<typename T>
+	TWorkStealingDeque<T>::TWorkStealingDeque(size_t capacity)
+		: mTop(0)
+		, mBottom(0)
+	{
+		size_t roundedCapacity = 2;
+		while (roundedCapacity < capacity)
+		{
+			roundedCapacity <<= 1;
+		}
+
+		mMask = static_cast<int64>(roundedCapacity) - 1;
+		mItems.reset(new std::atomic<T*>[roundedCapacity]);
+	}
+
+	template<typename T>
+	bool TWorkStealingDeque<T>::Push(T* item)
+	{
+		const int64 bottom = mBottom.load(std::memory_order_relaxed);
+		const int64 top = mTop.load(std::memory_order_acquire);
+		if (bottom - top > mMask)
+		{
+			return false;
+		}
+
+		mItems[bottom & mMask].store(item, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		mBottom.store(bottom + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	template<typename T>
+	T* TWorkStealingDeque<T>::Pop()
+	{
+		const int64 bottom = mBottom.load(std::memory_order_relaxed) - 1;
+		mBottom.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64 top = mTop.load(std::memory_order_relaxed);
+
+		if (top > bottom)
+		{
+			mBottom.store(bottom + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		T* item = mItems[bottom & mMask].load(std::memory_order_relaxed);
+		if (top == bottom)
+		{
+			// Last item, race the thieves for it.
+			if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				item = nullptr;
+			}
+			mBottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+		return item;
+	}
+
+	template<typename T>
+	T* TWorkStealingDeque<T>::Steal()
+	{
+		int64 top = mTop.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const int64 bottom = mBottom.load(std::memory_order_acquire);
+
+		if (top >= bottom)
+		{
+			return nullptr;
+		}
+
+		T* item = mItems[top & mMask].load(std::memory_order_relaxed);
+		if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		{
+			return nullptr;
+		}
+		return item;
+	}
+
+	template<typename T>
+	bool TWorkStealingDeque<T>::Empty() const
+	{
+		return mTop.load(std::memory_order_relaxed) >= mBottom.load(std::memory_order_relaxed);
+	}
+}
@@ -85,6 +85,8 @@ project "DashCore"
 
     defines{"DASH_PLATFORM_WINDOWS"}
     defines { 'ENGINE_PATH="' .. path.join(path.getabsolute(""), "%{prj.name}") .. '"' }
+    -- MSVC has no __FMA__ macro: a configuration built with vectorextensions "AVX2" also adds defines "DASH_USE_FMA"
+    -- to fuse the SIMD multiply-adds. AVX2 alone does not guarantee FMA.
 
     filter "configurations:Debug"
         defines "DASH_DEBUG"
@@ -176,4 +178,42 @@ project "DashProject"
 
     filter "configurations:Distribution"
         defines "DASH_DISTRIBUTION"
-        optimize "On"
\ No newline at end of file
+        optimize "On"
+
+-- Math / hash microbenchmarks, only depends on the portable parts of DashCore.
+-- On Linux use DashBenchmark/Makefile, which builds a scalar and a USE_SSE variant side by side.
+project "DashBenchmark"
+    location "DashBenchmark"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++20"
+    staticruntime "On"
+
+    targetdir ("Bin/"..outputdir.."/%{prj.name}")
+    objdir ("Bin-Intermediate/"..outputdir.."/%{prj.name}")
+
+    files
+    {
+        "%{prj.name}/Src/**.h",
+        "%{prj.name}/Src/**.cpp",
+        "DashCore/Src/Math/Color.cpp",
+        "DashCore/Src/Math/MathType.cpp",
+        "DashCore/Src/Math/SIMDMath.cpp",
+        "DashCore/Src/Math/TransformHierarchy.cpp",
+        "DashCore/Src/Utility/CpuFeatures.cpp",
+        "DashCore/Src/Utility/Hash.cpp",
+        "DashCore/Src/Utility/JobSystem.cpp",
+    }
+
+    includedirs
+    {
+        "%{prj.name}/Src",
+        "DashCore/Src",
+    }
+
+    -- Always optimized, timings of unoptimized code are meaningless.
+    optimize "On"
+    defines { "NDEBUG" }
+
+    filter "system:windows"
+        systemversion "latest"